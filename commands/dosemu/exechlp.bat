@@ -0,0 +1 @@
+../../2.0-pre9/bat/exechlp.bat
\ No newline at end of file
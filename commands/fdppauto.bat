@@ -0,0 +1 @@
+../src/bindist/fdppauto.bat
\ No newline at end of file
@@ -48,6 +48,7 @@
 #include "sound.h"
 #include "cpu-emu.h"
 #include "sig.h"
+#include "twheel.h"
 
 /* Variables for keeping track of signals */
 #define MAX_SIG_QUEUE_SIZE 50
@@ -74,9 +75,12 @@ static int chd_hndl_num;
 #define MAX_SIGALRM_HANDLERS 50
 struct sigalrm_hndl {
   void (*handler)(void);
+  int (*busy)(void);
 };
 static struct sigalrm_hndl alrm_hndl[MAX_SIGALRM_HANDLERS];
 static int alrm_hndl_num;
+static int alrm_stretched;
+static unsigned alrm_ticks, alrm_leave_ticks;
 
 struct callback_s {
   void (*func)(void *);
@@ -270,9 +274,17 @@ static void sig_child(siginfo_t *si)
 }
 
 int sigalrm_register_handler(void (*handler)(void))
+{
+  return sigalrm_register_idle_handler(handler, NULL);
+}
+
+/* busy() tells if the handler needs the periodic tick while the guest
+ * sleeps. Handlers registered without it always need it. */
+int sigalrm_register_idle_handler(void (*handler)(void), int (*busy)(void))
 {
   assert(alrm_hndl_num < MAX_SIGALRM_HANDLERS);
   alrm_hndl[alrm_hndl_num].handler = handler;
+  alrm_hndl[alrm_hndl_num].busy = busy;
   alrm_hndl_num++;
   return 0;
 }
@@ -642,8 +654,11 @@ static void SIGALRM_call(void *arg)
     first = 1;
   }
 
+  if (config.sound_vtime)
+    vtime_advance();
   uncache_time();
   timer_tick();
+  alrm_ticks++;
 
   if ((pic_sys_time-cnt10) >= (PIT_TICK_RATE/100) || dosemu_frozen) {
     cnt10 = pic_sys_time;
@@ -687,6 +702,70 @@ static void SIGALRM_call(void *arg)
   }
 }
 
+static void set_alrm_timer(int first_us, int us)
+{
+  struct itimerval itv;
+
+  itv.it_value.tv_sec = first_us / 1000000;
+  itv.it_value.tv_usec = first_us % 1000000;
+  itv.it_interval.tv_sec = us / 1000000;
+  itv.it_interval.tv_usec = us % 1000000;
+  setitimer(ITIMER_REAL, &itv, NULL);
+}
+
+/* While the guest sleeps, nothing but the busy SIGALRM handlers needs
+ * the periodic tick: PIT and RTC interrupts come from their own timers,
+ * and I/O wakes us up with SIGIO. So if no one is busy, slow down to
+ * 1/PARTIALS sec for the floppy and printer timeouts. If the guest ran
+ * without a tick since it woke up, one more regular tick updates the
+ * screen first. */
+void sigalrm_idle_enter(void)
+{
+  int delta = config.update / TIMER_DIVISOR;
+  int first, i;
+  hitimer_t next, now;
+
+  if (!config.tickless_idle || alrm_stretched)
+    return;
+  for (i = 0; i < alrm_hndl_num; i++) {
+    if (!alrm_hndl[i].busy || alrm_hndl[i].busy())
+      return;
+  }
+  first = (alrm_ticks == alrm_leave_ticks ? delta : 1000000 / PARTIALS);
+  /* wake up for the device timers */
+  next = twheel_next();
+  if (next != TWHEEL_NEVER) {
+    now = GETusTIME(0);
+    if (next <= now + delta)
+      return;
+    if (next - now < first)
+      first = next - now;
+  }
+  set_alrm_timer(first, 1000000 / PARTIALS);
+  alrm_stretched = 1;
+}
+
+void sigalrm_idle_leave(void)
+{
+  int delta = config.update / TIMER_DIVISOR;
+
+  if (!alrm_stretched)
+    return;
+  set_alrm_timer(delta, delta);
+  alrm_stretched = 0;
+  alrm_leave_ticks = alrm_ticks;
+}
+
+/* Used in virtual time mode instead of waiting for the real SIGALRM. */
+void sigalrm_fast_forward(void)
+{
+  sigset_t old_mask;
+
+  pthread_sigmask(SIG_BLOCK, &q_mask, &old_mask);
+  SIGNAL_save(SIGALRM_call, NULL, 0, __func__);
+  pthread_sigmask(SIG_SETMASK, &old_mask, NULL);
+}
+
 /* DANG_BEGIN_FUNCTION SIGNAL_save
  *
  * arguments:
@@ -28,7 +28,6 @@
 #include <setjmp.h>
 #include <inttypes.h>
 #include <unistd.h>
-#include <sys/mman.h>
 #include <assert.h>
 #include <pthread.h>
 #ifdef HAVE_EXECINFO
@@ -36,6 +35,7 @@
 #endif
 #include "emu.h"
 #include "utilities.h"
+#include "timers.h"
 #include "libpcl/pcl.h"
 #include "coopth.h"
 #include "coopth_be.h"
@@ -121,6 +121,7 @@ struct coopth_t {
     int max_thr;
     int detached:1;
     int custom:1;
+    int queued:1;
     coopth_func_t func;
     struct coopth_ctx_handlers_t ctxh;
     struct coopth_sleep_handlers_t sleeph;
@@ -129,6 +130,11 @@ struct coopth_t {
     struct coopth_per_thread_t *post_pth;
     const struct coopth_be_ops *ops;
     pthread_t pthread;
+    /* scheduling statistics */
+    uint64_t runs;
+    hitimer_t ready_time;
+    hitimer_t lat_total;
+    hitimer_t lat_max;
 };
 
 static __TLS cohandle_t co_handle;
@@ -144,6 +150,9 @@ static __TLS int threads_total;
 #define MAX_ACT_THRS 10
 static __TLS int threads_active;
 static __TLS int active_tids[MAX_ACT_THRS];
+/* detached threads that coopth_run() has to run, sleepers are not here */
+static __TLS int threads_ready;
+static __TLS int ready_tids[MAX_ACT_THRS];
 static __TLS void (*nothread_notifier)(void);
 
 static void coopth_callf_chk(struct coopth_t *thr,
@@ -155,6 +164,8 @@ static void do_del_thread(struct coopth_t *thr,
 static void do_call_post(struct coopth_t *thr,
 	struct coopth_per_thread_t *pth);
 static void check_tid(int tid);
+static void ready_del(struct coopth_t *thr);
+static void ready_check(struct coopth_t *thr);
 
 #define COOP_STK_SIZE() (512 * getpagesize())
 
@@ -309,6 +320,10 @@ static void do_del_thread(struct coopth_t *thr,
 	}
 	assert(found);
 	threads_active--;
+	ready_del(thr);
+    } else {
+	/* previous level may be runnable */
+	ready_check(thr);
     }
     threads_total--;
 
@@ -517,6 +532,8 @@ struct crun_ret coopth_run_thread_internal(int tid)
 	exit(2);
     }
     term = thread_run(thr, pth);
+    /* could have detached */
+    ready_check(thr);
     if (term) {
 	ret.term = term;
 	ret.idx = CIDX(tid, term - 1);
@@ -649,9 +666,9 @@ static int do_start(struct coopth_t *thr, struct coopth_state_t st, void *arg)
     if (thr->cur_thr > thr->max_thr) {
 	size_t stk_size = COOP_STK_SIZE();
 	thr->max_thr = thr->cur_thr;
-	pth->stack = mmap(NULL, stk_size, PROT_READ | PROT_WRITE,
-		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-	if (pth->stack == MAP_FAILED) {
+	/* kept for the next start, measured and freed in coopth_done() */
+	pth->stack = co_stack_alloc(stk_size);
+	if (!pth->stack) {
 	    error("Unable to allocate stack\n");
 	    exit(21);
 	    return -1;
@@ -717,6 +734,7 @@ static int do_start_internal(struct coopth_t *thr, void *arg,
 	pth->retf = retf;
 	coopth_callf(thr, pth);
     }
+    ready_check(thr);
     return CIDX(thr->tid, num);
 }
 
@@ -847,7 +865,9 @@ static void do_detach(struct coopth_t *thr, struct coopth_per_thread_t *pth)
         /* run thread so it can reach cancellation point */
         enum CoopthRet tret = do_run_thread(thr, pth);
         assert(tret == COOPTH_DELETE);
+        return;
     }
+    ready_check(thr);
 }
 
 int coopth_unsafe_detach(int tid, const char *who)
@@ -863,50 +883,108 @@ int coopth_unsafe_detach(int tid, const char *who)
     return 0;
 }
 
-static int run_traverser(int (*pred)(struct coopth_per_thread_t *, void*),
-	void *pred_arg, void (*post)(struct coopth_per_thread_t *))
+static int is_ready(struct coopth_per_thread_t *pth)
+{
+    /* only detached threads are run from coopth_run() */
+    if (pth->data.attached || pth->data.left)
+	return 0;
+    return (pth->st.state == COOPTHS_RUNNING ||
+	    pth->st.state == COOPTHS_SWITCH);
+}
+
+static void ready_add(struct coopth_t *thr)
+{
+    if (thr->queued)
+	return;
+    assert(threads_ready < MAX_ACT_THRS);
+    ready_tids[threads_ready++] = thr->tid;
+    thr->queued = 1;
+    thr->ready_time = GETusTIME(0);
+}
+
+static void ready_del(struct coopth_t *thr)
 {
     int i;
-    int cnt = 0;
-    for (i = 0; i < threads_active; i++) {
-	int tid = active_tids[i];
-	struct coopth_t *thr = &coopthreads[tid];
-	struct coopth_per_thread_t *pth = current_thr(thr);
-	/* only run detached threads here */
-	if (pth->data.attached)
-	    continue;
-	if (pth->data.left) {
-	    if (!left_running)
-		error("coopth: switching to left thread?\n");
-	    continue;
-	}
-	if (pred && !pred(pth, pred_arg))
-	    continue;
-	thread_run(thr, pth);
-	if (post)
-	    post(pth);
-	cnt++;
+
+    if (!thr->queued)
+	return;
+    for (i = 0; i < threads_ready; i++) {
+	if (ready_tids[i] == thr->tid)
+	    break;
     }
-    return cnt;
+    assert(i < threads_ready);
+    memmove(&ready_tids[i], &ready_tids[i + 1],
+	    (threads_ready - i - 1) * sizeof(ready_tids[0]));
+    threads_ready--;
+    thr->queued = 0;
 }
 
-static int quick_sched_pred(struct coopth_per_thread_t *pth, void *arg)
+/* queue the thread if it is up to coopth_run() to run it */
+static void ready_check(struct coopth_t *thr)
 {
-    return pth->quick_sched;
+    if (thr->cur_thr && is_ready(current_thr(thr)))
+	ready_add(thr);
 }
 
-static void quick_sched_post(struct coopth_per_thread_t *pth)
+static void run_ready(struct coopth_t *thr)
 {
+    struct coopth_per_thread_t *pth;
+    hitimer_t lat;
+
+    /* could be deleted or put to sleep since it was queued */
+    if (!thr->cur_thr)
+	return;
+    pth = current_thr(thr);
+    if (!is_ready(pth))
+	return;
+    lat = GETusTIME(0) - thr->ready_time;
+    thr->lat_total += lat;
+    if (lat > thr->lat_max)
+	thr->lat_max = lat;
+    thr->runs++;
     pth->quick_sched = 0;
+    thread_run(thr, pth);
+    ready_check(thr);
+}
+
+static int run_quick(void)
+{
+    int i = 0;
+    int cnt = 0;
+
+    while (i < threads_ready) {
+	struct coopth_t *thr = &coopthreads[ready_tids[i]];
+	struct coopth_per_thread_t *pth = current_thr(thr);
+	if (!pth->quick_sched) {
+	    i++;
+	    continue;
+	}
+	ready_del(thr);
+	run_ready(thr);
+	cnt++;
+    }
+    return cnt;
 }
 
 void coopth_run(void)
 {
+    int tids[MAX_ACT_THRS];
+    int i, n;
+
     assert(DETACHED_RUNNING >= 0);
     if (DETACHED_RUNNING)
 	return;
-    run_traverser(NULL, NULL, NULL);
-    while (run_traverser(quick_sched_pred, NULL, quick_sched_post));
+    /* run the threads that were ready before we started, those
+     * that stay runnable are queued again for the next round */
+    n = threads_ready;
+    memcpy(tids, ready_tids, n * sizeof(tids[0]));
+    threads_ready = 0;
+    for (i = 0; i < n; i++)
+	coopthreads[tids[i]].queued = 0;
+    for (i = 0; i < n; i++)
+	run_ready(&coopthreads[tids[i]]);
+    /* then the ones that were woken up meanwhile */
+    while (run_quick());
 }
 
 void coopth_run_tid(int tid)
@@ -918,6 +996,7 @@ void coopth_run_tid(int tid)
 	return;
     assert(!pth->data.attached && !pth->data.left);
     thread_run(thr, pth);
+    ready_check(thr);
 }
 
 static int __coopth_is_in_thread(int warn, const char *f)
@@ -935,6 +1014,11 @@ static int __coopth_is_in_thread(int warn, const char *f)
 #define _coopth_is_in_thread() __coopth_is_in_thread(1, __func__)
 #define _coopth_is_in_thread_nowarn() __coopth_is_in_thread(0, __func__)
 
+int coopth_is_in_thread(void)
+{
+    return _coopth_is_in_thread_nowarn();
+}
+
 int coopth_get_tid(void)
 {
     struct coopth_thrdata_t *thdata;
@@ -1258,8 +1342,10 @@ static void do_awake(struct coopth_per_thread_t *pth)
 	return;
     }
     pth->st = SW_ST(AWAKEN);
-    if (!pth->data.attached)
+    if (!pth->data.attached) {
 	pth->quick_sched = 1;	// optimize DPMI switches
+	ready_check(&coopthreads[*pth->data.tid]);
+    }
 }
 
 void coopth_wake_up(int tid)
@@ -1421,12 +1507,25 @@ again:
 
 	if (!pthread_equal(thr->pthread, pthread_self()))
 	    continue;
+	if (thr->runs)
+	    g_printf("coopth: \"%s\" ran %"PRIu64" times, latency avg %"
+		    PRIu64" max %"PRIu64" us\n", thr->name, thr->runs,
+		    thr->lat_total / thr->runs, thr->lat_max);
+	if (thr->max_thr) {
+	    int used = 0;
+	    for (j = 0; j < thr->max_thr; j++) {
+		struct coopth_per_thread_t *pth = &thr->pth[j];
+		used = _max(used, co_stack_used(pth->stack, pth->stk_size));
+	    }
+	    g_printf("coopth: \"%s\" used %i of %zu stack bytes\n",
+		    thr->name, used, thr->pth[0].stk_size);
+	}
 	/* don't free own thread */
 	if (thdata && *thdata->tid == i)
 	    continue;
 	for (j = thr->cur_thr; j < thr->max_thr; j++) {
 	    struct coopth_per_thread_t *pth = &thr->pth[j];
-	    munmap(pth->stack, pth->stk_size);
+	    co_stack_free(pth->stack, pth->stk_size);
 	}
     }
     if (!threads_total)
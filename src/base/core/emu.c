@@ -96,6 +96,7 @@
 #include "cpu-emu.h"
 #endif
 #include "kvm.h"
+#include "twheel.h"
 
 static int ld_tid;
 static int can_leavedos;
@@ -485,6 +486,7 @@ static void __leavedos_main(int code, int sig)
     /* now it is safe to shut down coopth. Can be done any later, if need be */
     coopth_done();
     dbug_printf("coopthreads stopped\n");
+    twheel_done();
 
     video_close();
     if (config.cpu_vm == CPUVM_KVM || config.cpu_vm_dpmi == CPUVM_KVM)
@@ -534,6 +536,7 @@ static void __leavedos_main(int code, int sig)
     g_printf("calling shared memory exit\n");
     g_printf("calling HMA exit\n");
     hma_exit();
+    mapping_report_hugepages();
     g_printf("calling mapping_close()\n");
     mapping_close();
 
@@ -585,6 +588,6 @@ void hardware_run(void)
 {
 	run_sb(); /* Beat Karcher to this one .. 8-) - AM */
 	keyb_server_run();
-	rtc_run();
+	twheel_run();
 }
 
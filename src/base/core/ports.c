@@ -66,6 +66,8 @@ static const char *crit_sect_caller;
 
 #define SET_HANDLE(p,h)		port_handle_table[(Bit16u)(p)]=(h)
 #define EMU_HANDLER(port)	port_handler[port_handle_table[(Bit16u)(port)]]
+/* in virtual time mode, the port accesses are what moves the clock */
+#define VTIME_IO()		do { if (config.sound_vtime) vtime_io(); } while (0)
 enum{TYPE_INB, TYPE_OUTB, TYPE_INW, TYPE_OUTW, TYPE_IND, TYPE_OUTD, TYPE_PCI, TYPE_EXIT};
 
 /* ---------------------------------------------------------------------- */
@@ -189,6 +191,7 @@ static void log_port_write_d(ioport_t port, Bit32u w)
 Bit8u port_inb(ioport_t port)
 {
 	Bit8u res;
+	VTIME_IO();
 	res = EMU_HANDLER(port).read_portb(port, EMU_HANDLER(port).arg);
 	return LOG_PORT_READ(port, res);
 }
@@ -202,6 +205,7 @@ Bit8u port_inb(ioport_t port)
  */
 void port_outb(ioport_t port, Bit8u byte)
 {
+	VTIME_IO();
 	LOG_PORT_WRITE(port, byte);
 	EMU_HANDLER(port).write_portb(port, byte, EMU_HANDLER(port).arg);
 }
@@ -220,6 +224,7 @@ Bit16u port_inw(ioport_t port)
 	Bit16u res;
 
 	if (EMU_HANDLER(port).read_portw != NULL) {
+		VTIME_IO();
 		res = EMU_HANDLER(port).read_portw(port, EMU_HANDLER(port).arg);
 		return LOG_PORT_READ_W(port, res);
 	}
@@ -239,6 +244,7 @@ Bit16u port_inw(ioport_t port)
 void port_outw(ioport_t port, Bit16u word)
 {
 	if (EMU_HANDLER(port).write_portw != NULL) {
+		VTIME_IO();
 		LOG_PORT_WRITE_W(port, word);
 		EMU_HANDLER(port).write_portw(port, word, EMU_HANDLER(port).arg);
 	}
@@ -261,6 +267,7 @@ Bit32u port_ind(ioport_t port)
 	Bit32u res;
 
 	if (EMU_HANDLER(port).read_portd != NULL) {
+		VTIME_IO();
 		res = EMU_HANDLER(port).read_portd(port, EMU_HANDLER(port).arg);
 	}
 	else {
@@ -273,6 +280,7 @@ void port_outd(ioport_t port, Bit32u dword)
 {
 	LOG_PORT_WRITE_D(port, dword);
 	if (EMU_HANDLER(port).write_portd != NULL) {
+		VTIME_IO();
 		EMU_HANDLER(port).write_portd(port, dword, EMU_HANDLER(port).arg);
 	}
 	else {
@@ -0,0 +1,252 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Purpose: deadline timers for the emulated devices.
+ *
+ * Deadlines are in GETusTIME() microseconds and the timers are kept in
+ * a hierarchical wheel: a slot of level L covers TW_SIZE^L microseconds.
+ * A timer goes to the lowest level where its deadline is less than
+ * TW_SIZE slots ahead, so a slot only holds the timers of one period.
+ * Once the time reaches that period, the timers of the slot either
+ * expire or move down a level.
+ *
+ * twheel_run() is called from the main loop and returns at once if
+ * nothing is due. twheel_next() tells when the next timer is due, so
+ * that the idle code knows when to wake up.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "emu.h"
+#include "timers.h"
+#include "utilities.h"
+#include "twheel.h"
+
+#define TW_BITS 6
+#define TW_SIZE (1 << TW_BITS)
+#define TW_MASK (TW_SIZE - 1)
+#define TW_LEVELS 5
+
+#define TW_IDLE -1
+#define TW_EXPIRED -2
+
+struct twheel_tmr {
+  struct twheel_tmr *next;	/* in the slot */
+  struct twheel_tmr *enext;	/* in the expired list */
+  struct twheel_tmr *all_next;
+  const char *name;
+  void (*cbk)(void *);
+  void *arg;
+  hitimer_t deadline;
+  int level;			/* or TW_IDLE, TW_EXPIRED */
+  int slot;
+  /* statistics */
+  uint64_t fired;
+  hitimer_t jitter_total;
+  hitimer_t jitter_max;
+};
+
+static struct {
+  struct twheel_tmr *slots[TW_LEVELS][TW_SIZE];
+  uint64_t busy[TW_LEVELS];
+  hitimer_t clk;		/* the time of the last run */
+  hitimer_t next;		/* earliest deadline, can be too early */
+  struct twheel_tmr *all;
+} tw = { .next = TWHEEL_NEVER };
+
+static void tw_place(struct twheel_tmr *t)
+{
+  hitimer_t d = _max(t->deadline, tw.clk);
+  int lvl, shift = 0;
+
+  for (lvl = 0; lvl < TW_LEVELS; lvl++) {
+    shift = TW_BITS * lvl;
+    if ((d >> shift) - (tw.clk >> shift) < TW_SIZE)
+      break;
+  }
+  if (lvl == TW_LEVELS) {
+    /* too far away: park it in the last slot, it moves on from there */
+    lvl--;
+    d = ((tw.clk >> shift) + TW_SIZE - 1) << shift;
+  }
+  t->level = lvl;
+  t->slot = (d >> shift) & TW_MASK;
+  t->next = tw.slots[lvl][t->slot];
+  tw.slots[lvl][t->slot] = t;
+  tw.busy[lvl] |= 1ULL << t->slot;
+}
+
+static void tw_unlink(struct twheel_tmr *t)
+{
+  struct twheel_tmr **p;
+
+  if (t->level < 0) {
+    t->level = TW_IDLE;
+    return;
+  }
+  for (p = &tw.slots[t->level][t->slot]; *p != t; p = &(*p)->next);
+  *p = t->next;
+  if (!tw.slots[t->level][t->slot])
+    tw.busy[t->level] &= ~(1ULL << t->slot);
+  t->level = TW_IDLE;
+}
+
+static void tw_update_next(void)
+{
+  struct twheel_tmr *t;
+
+  tw.next = TWHEEL_NEVER;
+  for (t = tw.all; t; t = t->all_next) {
+    if (t->level >= 0 && t->deadline < tw.next)
+      tw.next = t->deadline;
+  }
+}
+
+void *twheel_create(const char *name, void (*cbk)(void *), void *arg)
+{
+  struct twheel_tmr *t = calloc(1, sizeof(*t));
+
+  t->name = name;
+  t->cbk = cbk;
+  t->arg = arg;
+  t->level = TW_IDLE;
+  t->all_next = tw.all;
+  tw.all = t;
+  return t;
+}
+
+void twheel_arm(void *tmr, hitimer_t deadline)
+{
+  struct twheel_tmr *t = tmr;
+
+  if (!tw.clk)
+    tw.clk = GETusTIME(0);
+  tw_unlink(t);
+  t->deadline = deadline;
+  tw_place(t);
+  if (deadline < tw.next)
+    tw.next = deadline;
+}
+
+void twheel_arm_rel(void *tmr, hitimer_t us)
+{
+  twheel_arm(tmr, GETusTIME(0) + us);
+}
+
+void twheel_disarm(void *tmr)
+{
+  /* tw.next is left as is, the next run will fix it up */
+  tw_unlink(tmr);
+}
+
+void twheel_run(void)
+{
+  struct twheel_tmr *expired = NULL, **tail = &expired, *t, *list;
+  hitimer_t now, from, p, end;
+  int lvl, shift, slot;
+
+  if (tw.next == TWHEEL_NEVER)
+    return;
+  now = GETusTIME(0);
+  if (now < tw.next)
+    return;
+
+  from = tw.clk;
+  tw.clk = now;
+  /* top-down, as the timers move to the lower levels */
+  for (lvl = TW_LEVELS - 1; lvl >= 0; lvl--) {
+    shift = TW_BITS * lvl;
+    end = now >> shift;
+    p = from >> shift;
+    if (end - p >= TW_SIZE)
+      p = end - TW_SIZE + 1;
+    for (; p <= end; p++) {
+      slot = p & TW_MASK;
+      if (!(tw.busy[lvl] & (1ULL << slot)))
+	continue;
+      list = tw.slots[lvl][slot];
+      tw.slots[lvl][slot] = NULL;
+      tw.busy[lvl] &= ~(1ULL << slot);
+      while ((t = list)) {
+	list = t->next;
+	if (t->deadline <= now) {
+	  t->level = TW_EXPIRED;
+	  t->enext = NULL;
+	  *tail = t;
+	  tail = &t->enext;
+	} else {
+	  tw_place(t);
+	}
+      }
+    }
+  }
+
+  while ((t = expired)) {
+    hitimer_t jitter = now - t->deadline;
+
+    expired = t->enext;
+    /* could be disarmed or re-armed by the previous callbacks */
+    if (t->level != TW_EXPIRED)
+      continue;
+    t->level = TW_IDLE;
+    t->fired++;
+    t->jitter_total += jitter;
+    if (jitter > t->jitter_max)
+      t->jitter_max = jitter;
+    t->cbk(t->arg);
+  }
+  tw_update_next();
+}
+
+hitimer_t twheel_next(void)
+{
+  return tw.next;
+}
+
+void twheel_dump(void)
+{
+  struct twheel_tmr *t;
+  hitimer_t now = GETusTIME(0);
+
+  g_printf("TWHEEL: timers at %"PRIu64" us\n", now);
+  for (t = tw.all; t; t = t->all_next) {
+    if (t->level >= 0)
+      g_printf("\t%s: due in %"PRIi64" us (level %i)", t->name,
+	  (int64_t)(t->deadline - now), t->level);
+    else
+      g_printf("\t%s: idle", t->name);
+    g_printf(", fired %"PRIu64" times, jitter avg %"PRIu64" max %"PRIu64
+	" us\n", t->fired, t->fired ? t->jitter_total / t->fired : 0,
+	t->jitter_max);
+  }
+}
+
+void twheel_done(void)
+{
+  struct twheel_tmr *t;
+
+  if (tw.all)
+    twheel_dump();
+  while ((t = tw.all)) {
+    tw.all = t->all_next;
+    free(t);
+  }
+  memset(tw.slots, 0, sizeof(tw.slots));
+  memset(tw.busy, 0, sizeof(tw.busy));
+  tw.next = TWHEEL_NEVER;
+}
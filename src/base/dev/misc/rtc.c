@@ -19,11 +19,13 @@
 #include "int.h"
 #include "vtmr.h"
 #include "iodev.h"
+#include "twheel.h"
 
 long   sys_base_ticks = 0;
 long   usr_delta_ticks = 0;
 unsigned long   last_ticks = 0;
 static unsigned long long q_ticks_m = 0;
+static void *rtc_tmr;
 
 static int rtc_get_rate(Bit8u div)
 {
@@ -34,6 +36,23 @@ static int rtc_get_rate(Bit8u div)
   return (65536 >> div);
 }
 
+/* arm the timer for the next periodic interrupt */
+static void rtc_arm(void)
+{
+  int rate = rtc_get_rate(GET_CMOS(CMOS_STATUSA) & 0x0f);
+
+  if (!rtc_tmr)
+    return;
+  if (!(GET_CMOS(CMOS_STATUSB) & 0x40) || !rate) {
+    twheel_disarm(rtc_tmr);
+    return;
+  }
+  if (q_ticks_m < 1000000)
+    twheel_arm_rel(rtc_tmr, (1000000 - q_ticks_m + rate - 1) / rate);
+  else
+    twheel_arm_rel(rtc_tmr, 1000000 / rate);
+}
+
 void rtc_run(void)
 {
   static hitimer_t last_time = -1;
@@ -42,6 +61,7 @@ void rtc_run(void)
   if (last_time == -1 || last_time > cur_time ||
       !(GET_CMOS(CMOS_STATUSB) & 0x40)) {
     last_time = cur_time;
+    rtc_arm();
     return;
   }
   rate = rtc_get_rate(GET_CMOS(CMOS_STATUSA) & 0x0f);
@@ -69,6 +89,12 @@ void rtc_run(void)
     if (!(old_c & 0x40))
       q_ticks_m -= 1000000;
   }
+  rtc_arm();
+}
+
+static void rtc_tmr_cbk(void *arg)
+{
+  rtc_run();
 }
 
 Bit8u rtc_read(Bit8u reg)
@@ -118,6 +144,8 @@ Bit8u rtc_read(Bit8u reg)
 
 void rtc_write(Bit8u reg, Bit8u byte)
 {
+  /* account the ticks at the old rate */
+  rtc_run();
   switch (reg) {
     case CMOS_SEC:
     case CMOS_MIN:
@@ -156,6 +184,7 @@ void rtc_write(Bit8u reg, Bit8u byte)
       SET_CMOS(reg, byte);
   }
   q_ticks_m = 0;
+  rtc_arm();
 }
 
 static void rtc_alarm_check (void)
@@ -292,6 +321,7 @@ void rtc_init(void)
   /* NOTE: vtmr is only used in tweaked mode, so we set it to 1 beforehands,
    * but may not actually use */
   vtmr_set_tweaked(VTMR_RTC, 1, 0);
+  rtc_tmr = twheel_create("rtc", rtc_tmr_cbk, NULL);
 }
 
 /* ========================================================================= */
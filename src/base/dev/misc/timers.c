@@ -38,6 +38,7 @@
 #include "emudpmi.h"
 #include "vtmr.h"
 #include "evtimer.h"
+#include "twheel.h"
 #include "timers.h"
 
 #undef  DEBUG_PIT
@@ -279,13 +280,102 @@ static int _pit_latch(int latch, uint64_t cur)
   return ret;
 }
 
+/*
+ * In virtual time mode the PIT counts the emulated time rather than
+ * CLOCK_MONOTONIC, so that its interrupts keep in step with the clock
+ * the guest reads. Its deadlines then go to the timer wheel, where the
+ * idle fast-forward stops.
+ */
+struct pit_vtmr {
+  void *tw;
+  uint64_t start;		/* all in ns of GETusTIME() */
+  uint64_t next;
+  uint64_t period;		/* 0 if not periodic */
+};
+static struct pit_vtmr pit_vt[PIT_TIMERS];
+
+static void timer_activate(int ticks, void *arg);
+
+static uint64_t pit_vt_now(void)
+{
+  return GETusTIME(0) * 1000;
+}
+
+static void pit_vt_arm(struct pit_vtmr *v)
+{
+  twheel_arm(v->tw, (v->next + 999) / 1000);
+}
+
+static void pit_vt_cbk(void *arg)
+{
+  int pit_num = (uintptr_t)arg;
+  struct pit_vtmr *v = &pit_vt[pit_num];
+  uint64_t now = pit_vt_now();
+  int ticks = 1;
+
+  if (now < v->next) {
+    pit_vt_arm(v);
+    return;
+  }
+  if (v->period) {
+    ticks = (now - v->next) / v->period + 1;
+    v->next += ticks * v->period;
+    pit_vt_arm(v);
+  }
+  timer_activate(ticks, arg);
+}
+
+static void pit_tmr_set_rel(int num, uint64_t ns, int periodic)
+{
+  struct pit_vtmr *v = &pit_vt[num];
+
+  if (!config.sound_vtime) {
+    evtimer_set_rel(pit[num].evtmr, ns, periodic);
+    return;
+  }
+  v->start = pit_vt_now();
+  v->next = v->start + ns;
+  v->period = periodic ? ns : 0;
+  pit_vt_arm(v);
+}
+
+static uint64_t pit_tmr_gettime(int num)
+{
+  if (!config.sound_vtime)
+    return evtimer_gettime(pit[num].evtmr);
+  return pit_vt_now() - pit_vt[num].start;
+}
+
+static void pit_tmr_stop(int num)
+{
+  if (!config.sound_vtime) {
+    evtimer_stop(pit[num].evtmr);
+    return;
+  }
+  twheel_disarm(pit_vt[num].tw);
+  pit_vt[num].start = pit_vt_now();
+}
+
+/* the wheel runs in the main thread, nothing to block there */
+static void pit_tmr_block(int num)
+{
+  if (!config.sound_vtime)
+    evtimer_block(pit[num].evtmr);
+}
+
+static void pit_tmr_unblock(int num)
+{
+  if (!config.sound_vtime)
+    evtimer_unblock(pit[num].evtmr);
+}
+
 static int do_pit_latch(int latch)
 {
   int ret;
   uint64_t cur_time;
 
-  evtimer_block(pit[latch].evtmr);
-  cur_time = evtimer_gettime(pit[latch].evtmr);
+  pit_tmr_block(latch);
+  cur_time = pit_tmr_gettime(latch);
   /* if timer is lagging we run it by hands */
   if (cur_time > pic_itime[latch] &&
       __sync_bool_compare_and_swap(&pit[latch].q_ticks, 0, 1)) {
@@ -300,7 +390,7 @@ static int do_pit_latch(int latch)
   }
   ret = _pit_latch(latch, cur_time);
   vtmr_sync(VTMR_PIT);
-  evtimer_unblock(pit[latch].evtmr);
+  pit_tmr_unblock(latch);
   return ret;
 }
 
@@ -407,9 +497,9 @@ void pit_outp(ioport_t port, Bit8u val, void *arg)
       pit[port].cntr = pit[port].write_latch;
 
     if (!port)
-      evtimer_set_rel(pit[port].evtmr, TICKS_TO_NS(pit[port].cntr), 1);
+      pit_tmr_set_rel(port, TICKS_TO_NS(pit[port].cntr), 1);
     else
-      evtimer_stop(pit[port].evtmr);
+      pit_tmr_stop(port);
     h_printf("PIT: timer %i set to %i ticks\n", port, pit[port].cntr);
     pit[port].time.td = 0;
     pic_itime[port] = TICKS_TO_NS(pit[port].cntr);
@@ -470,7 +560,7 @@ void pit_control_outp(ioport_t port, Bit8u val, void *arg)
           /* set the time base for the counter - safety code for programs
            * which use a non-periodical mode without reloading the counter
            */
-          pit[latch].time.td = evtimer_gettime(pit[latch].evtmr);
+          pit[latch].time.td = pit_tmr_gettime(latch);
         }
       }
 #ifdef DEBUG_PIT
@@ -510,7 +600,7 @@ static void timer_activate(int ticks, void *arg)
   q = __sync_fetch_and_add(&pit[pit_num].q_ticks, ticks);
   h_printf("PIT: timer %i expired, %i\n", pit_num, q);
   if (pit_num) {
-    pit[pit_num].time.td = evtimer_gettime(pit[pit_num].evtmr);
+    pit[pit_num].time.td = pit_tmr_gettime(pit_num);
     return;
   }
   if (!q) {
@@ -640,6 +730,12 @@ void pit_init(void)
   vtmr_register_latch(VTMR_PIT, pit_latch_hndl);
   vtmr_set_tweaked(VTMR_PIT, config.timer_tweaks, 0);
 
+  if (config.sound_vtime) {
+    pit_vt[0].tw = twheel_create("PIT0", pit_vt_cbk, (void *)(uintptr_t)0);
+    pit_vt[1].tw = twheel_create("PIT1", pit_vt_cbk, (void *)(uintptr_t)1);
+    pit_vt[2].tw = twheel_create("PIT2", pit_vt_cbk, (void *)(uintptr_t)2);
+    return;
+  }
   pit[0].evtmr = evtimer_create(timer_activate, (void *)(uintptr_t)0);
   pit[1].evtmr = evtimer_create(timer_activate, (void *)(uintptr_t)1);
   pit[2].evtmr = evtimer_create(timer_activate, (void *)(uintptr_t)2);
@@ -647,6 +743,9 @@ void pit_init(void)
 
 void pit_done(void)
 {
+  /* the wheel timers are freed by twheel_done() */
+  if (config.sound_vtime)
+    return;
   evtimer_delete(pit[0].evtmr);
   evtimer_delete(pit[1].evtmr);
   evtimer_delete(pit[2].evtmr);
@@ -663,7 +762,7 @@ void pit_reset(void)
   pit[0].read_state  = 3;
   pit[0].write_state = 3;
   pit[0].q_ticks     = 0;
-  evtimer_stop(pit[0].evtmr);
+  pit_tmr_stop(0);
 
   pit[1].mode        = 2;
   pit[1].outpin      = 0;
@@ -674,7 +773,7 @@ void pit_reset(void)
   pit[1].read_state  = 3;
   pit[1].write_state = 3;
   pit[1].q_ticks     = 0;
-  evtimer_stop(pit[1].evtmr);
+  pit_tmr_stop(1);
 
   pit[2].mode        = 0;
   pit[2].outpin      = 0;
@@ -685,7 +784,7 @@ void pit_reset(void)
   pit[2].read_state  = 3;
   pit[2].write_state = 3;
   pit[2].q_ticks     = 0;
-  evtimer_stop(pit[2].evtmr);
+  pit_tmr_stop(2);
 
   pit[3].mode        = 0;
   pit[3].outpin      = 0;
@@ -703,7 +802,7 @@ void pit_reset(void)
 
 void pit_late_init(void)
 {
-  evtimer_set_rel(pit[0].evtmr, TICKS_TO_NS(pit[0].cntr), 1);
+  pit_tmr_set_rel(0, TICKS_TO_NS(pit[0].cntr), 1);
   pit[0].time.td = 0;
   pic_itime[0] = TICKS_TO_NS(pit[0].cntr);
 }
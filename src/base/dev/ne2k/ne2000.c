@@ -293,23 +293,25 @@ static void ne2000_ether_send(NE2000State *s, uint8_t *buf, int len)
     N_printf("NE2000: ne2000_ether_send(%p, %d)\n", buf, len);
     N_printhdr(buf);
 #endif
-    slen = write(s->fdnet, buf, len);
+    slen = pkt_write(s->fdnet, buf, len);
     if (slen < 0)
-        N_printf("NE2000: write() call failed: %s\n", strerror(errno));
+        N_printf("NE2000: pkt_write() call failed: %s\n", strerror(errno));
     else if (slen < len)
-        N_printf("NE2000: write() call underrun: %d/%d\n", slen, len);
+        N_printf("NE2000: pkt_write() call underrun: %d/%d\n", slen, len);
 }
 
 static int ne2000_ether_recv(NE2000State *s, uint8_t *buf, int bufsiz)
 {
     int ret;
 
-    ret = read(s->fdnet, buf, bufsiz);
+    ret = pkt_read(s->fdnet, buf, bufsiz);
     ioselect_complete(s->fdnet);
     if (ret < 0) {
         N_printf("NE2000: ne2000_ether_recv() read failed\n");
         return -1;
     }
+    if (ret == 0)
+        return -1;
 
     N_printf("NE2000: ne2000_ether_recv() read %d bytes\n", ret);
     N_printhdr(buf);
@@ -24,6 +24,7 @@
 #include "port.h"
 #include "sig.h"
 #include "dosemu_debug.h"
+#include "timers.h"
 #include "i8259.h"
 #include "i8259_internal.h"
 #include "pic.h"
@@ -31,6 +32,12 @@
 static PICCommonState pic[2];
 PICCommonState *slave_pic;
 static pthread_mutex_t pic_mtx = PTHREAD_MUTEX_INITIALIZER;
+/* interrupt latency, from the request until the guest takes the irq */
+static struct {
+    hitimer_t req_time;
+    unsigned long long cnt;
+    hitimer_t total, max;
+} lat[16];
 
 static void write_pic0(ioport_t port, Bit8u value, void *arg)
 {
@@ -111,6 +118,7 @@ static void write_firr(ioport_t port, Bit8u value, void *arg)
 void pic_request(int irq)
 {
     PICCommonState *p = pic;
+    int num = irq;
 
     r_printf("PIC: Requested irq lvl %x\n", irq);
     if (irq >= 8) {
@@ -119,6 +127,8 @@ void pic_request(int irq)
     }
     pthread_mutex_lock(&pic_mtx);
     pic_set_irq(p, irq, 1);
+    if (!lat[num].req_time)
+        lat[num].req_time = GETusTIME(0);
     pthread_mutex_unlock(&pic_mtx);
     r_printf("PIC%i: isr=%x imr=%x irr=%x\n",
             p->master ? 0 : 1, p->isr, p->imr, p->irr);
@@ -127,6 +137,7 @@ void pic_request(int irq)
 void pic_untrigger(int irq)
 {
     PICCommonState *p = pic;
+    int num = irq;
 
     r_printf("PIC: irq lvl %x untriggered\n", irq);
     if (irq >= 8) {
@@ -135,11 +146,37 @@ void pic_untrigger(int irq)
     }
     pthread_mutex_lock(&pic_mtx);
     pic_set_irq(p, irq, 0);
+    /* edge-triggered requests stay pending after the line drops */
+    if (!(p->irr & (1 << irq)))
+        lat[num].req_time = 0;
     pthread_mutex_unlock(&pic_mtx);
     r_printf("PIC%i: isr=%x imr=%x irr=%x\n",
             p->master ? 0 : 1, p->isr, p->imr, p->irr);
 }
 
+static void pic_account_latency(int inum)
+{
+    /* running under mutex */
+    int irq;
+    hitimer_t t;
+
+    if (inum >= pic[0].irq_base && inum < pic[0].irq_base + 8 &&
+            inum != pic[0].irq_base + 2)
+        irq = inum - pic[0].irq_base;
+    else if (inum >= pic[1].irq_base && inum < pic[1].irq_base + 8)
+        irq = inum - pic[1].irq_base + 8;
+    else
+        return;
+    if (!lat[irq].req_time)
+        return;
+    t = GETusTIME(0) - lat[irq].req_time;
+    lat[irq].req_time = 0;
+    lat[irq].cnt++;
+    lat[irq].total += t;
+    if (t > lat[irq].max)
+        lat[irq].max = t;
+}
+
 int pic_get_inum(void)
 {
     int inum;
@@ -148,6 +185,7 @@ int pic_get_inum(void)
     if (!slave_pic)
         slave_pic = &pic[1];
     inum = pic_read_irq(&pic[0]);
+    pic_account_latency(inum);
     pthread_mutex_unlock(&pic_mtx);
     r_printf("PIC: Running interrupt %x\n", inum);
     return inum;
@@ -236,6 +274,19 @@ void pic_reset(void)
     qemu_pic_reset(&pic[1]);
 }
 
+void pic_done(void)
+{
+    int i;
+
+    for (i = 0; i < 16; i++) {
+        if (!lat[i].cnt)
+            continue;
+        r_printf("PIC: irq %i delivered %llu times, latency avg %llu max %llu us\n",
+                i, lat[i].cnt, (unsigned long long)(lat[i].total / lat[i].cnt),
+                (unsigned long long)lat[i].max);
+    }
+}
+
 /* PIC extensions */
 
 Bit8u pic0_get_base(void)
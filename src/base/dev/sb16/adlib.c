@@ -226,6 +226,12 @@ void adlib_timer(void)
 {
     if (!oplops->Generate)
 	return;
+    /* in virtual time mode render synchronously to stay deterministic */
+    if (config.sound_vtime) {
+	if (adlib_running)
+	    adlib_run();
+	return;
+    }
     sem_post(&syn_sem);
 }
 
@@ -117,6 +117,11 @@ static void run_sound(void)
     pcm_timer();
 }
 
+static int sound_busy(void)
+{
+    return config.sound && (sb_dma_active() || pcm_is_playing());
+}
+
 static int dspio_out_fifo_len(struct dspio_dma *dma)
 {
     return dma->dsp_fifo_enabled ? DSP_OUT_FIFO_TRIGGER : 2;
@@ -242,45 +247,102 @@ static uint8_t decode_adpcm4(struct dspio_dma *dma, uint8_t val)
     return sample;
 }
 
-static int dspio_get_output_sample(struct dspio_state *state,
-	sndbuf_t buf[PCM_MAX_BUF][SNDBUF_CHANS], int i, int j)
+/* Block decoders: convert n fifo entries at once, returning the
+ * amount of frames produced. ADPCM is always mono. */
+static inline int decode_pcm_block(sndbuf_t buf[][SNDBUF_CHANS],
+	const uint16_t *src, int n, const int nch)
+{
+    int i, j;
+    for (i = 0; i < n / nch; i++)
+	for (j = 0; j < nch; j++)
+	    buf[i][j] = src[i * nch + j];
+    return i;
+}
+
+static int decode_adpcm2_block(struct dspio_dma *dma,
+	sndbuf_t buf[][SNDBUF_CHANS], const uint16_t *src, int n)
+{
+    int i, k;
+    for (i = 0; i < n; i++)
+	for (k = 0; k < 4; k++)
+	    buf[i * 4 + k][0] = decode_adpcm2(dma,
+		    (src[i] >> (6 - k * 2)) & 0x3);
+    return n * 4;
+}
+
+static int decode_adpcm3_block(struct dspio_dma *dma,
+	sndbuf_t buf[][SNDBUF_CHANS], const uint16_t *src, int n)
+{
+    int i, k;
+    for (i = 0; i < n; i++) {
+	/* 2.6bits, not 3, see dosbox */
+	for (k = 0; k < 2; k++)
+	    buf[i * 3 + k][0] = decode_adpcm3(dma,
+		    (src[i] >> (5 - k * 3)) & 0x7);
+	buf[i * 3 + k][0] = decode_adpcm3(dma, (src[i] & 0x3) << 1);
+    }
+    return n * 3;
+}
+
+static int decode_adpcm4_block(struct dspio_dma *dma,
+	sndbuf_t buf[][SNDBUF_CHANS], const uint16_t *src, int n)
+{
+    int i, k;
+    for (i = 0; i < n; i++)
+	for (k = 0; k < 2; k++)
+	    buf[i * 2 + k][0] = decode_adpcm4(dma,
+		    (src[i] >> (4 - k * 4)) & 0xf);
+    return n * 2;
+}
+
+static int adpcm_frames_per_entry(int adpcm)
 {
-    int k;
-    uint16_t val;
+    switch (adpcm) {
+    case 2:
+	return 4;
+    case 3:
+	return 3;
+    case 4:
+	return 2;
+    }
+    return 1;
+}
+
+/* decode up to nfr frames from the output fifo into buf[i] onwards */
+static int dspio_get_output_frames(struct dspio_state *state,
+	sndbuf_t buf[PCM_MAX_BUF][SNDBUF_CHANS], int i, int nfr)
+{
+    uint16_t src[DSP_FIFO_SIZE];
+    int nch = state->dma.stereo + 1;
     int cnt = rng_count(&state->fifo_out);
-    if (!cnt)
+    int n;
+
+    if (state->dma.adpcm) {
+	int k = adpcm_frames_per_entry(state->dma.adpcm);
+	n = (nfr - i + k - 1) / k;
+	if (i + n * k > PCM_MAX_BUF)
+	    n = (PCM_MAX_BUF - i) / k;
+    } else {
+	n = (nfr - i) * nch;
+	/* leave incomplete frame in fifo */
+	cnt -= cnt % nch;
+    }
+    if (n > cnt)
+	n = cnt;
+    if (n <= 0)
 	return 0;
-    rng_get(&state->fifo_out, &val);
+    rng_remove(&state->fifo_out, n, src);
     switch (state->dma.adpcm) {
-	case 0:
-	    buf[i][j] = val;
-	    return 1;
-	case 2:
-	    assert(!j);
-	    if (i + 4 > PCM_MAX_BUF)
-		return 0;
-	    for (k = 0; k < 4; k++)
-		buf[i + k][j] = decode_adpcm2(&state->dma,
-			(val >> (6 - k * 2)) & 0x3);
-	    return k;
-	case 3:
-	    assert(!j);
-	    if (i + 3 > PCM_MAX_BUF)
-		return 0;
-	    /* 2.6bits, not 3, see dosbox */
-	    for (k = 0; k < 2; k++)
-		buf[i + k][j] = decode_adpcm3(&state->dma,
-			(val >> (5 - k * 3)) & 0x7);
-	    buf[i + k][j] = decode_adpcm3(&state->dma, (val & 0x3) << 1);
-	    return k + 1;
-	case 4:
-	    assert(!j);
-	    if (i + 2 > PCM_MAX_BUF)
-		return 0;
-	    for (k = 0; k < 2; k++)
-		buf[i + k][j] = decode_adpcm4(&state->dma,
-			(val >> (4 - k * 4)) & 0xf);
-	    return k;
+    case 0:
+	if (nch == 1)
+	    return decode_pcm_block(&buf[i], src, n, 1);
+	return decode_pcm_block(&buf[i], src, n, 2);
+    case 2:
+	return decode_adpcm2_block(&state->dma, &buf[i], src, n);
+    case 3:
+	return decode_adpcm3_block(&state->dma, &buf[i], src, n);
+    case 4:
+	return decode_adpcm4_block(&state->dma, &buf[i], src, n);
     }
     error("should not be here, %i\n", state->dma.adpcm);
     return 0;
@@ -378,7 +440,7 @@ struct dspio_state *dspio_init(void)
 
     midi_init();
 
-    sigalrm_register_handler(run_sound);
+    sigalrm_register_idle_handler(run_sound, sound_busy);
     return state;
 }
 
@@ -661,10 +723,9 @@ static int calc_nframes(struct dspio_state *state,
 
 static void dspio_process_dma(struct dspio_state *state)
 {
-    int dma_cnt, nfr, in_fifo_cnt, out_fifo_cnt, i, j;
+    int dma_cnt, nfr, in_fifo_cnt, out_fifo_cnt, i, j, n;
     unsigned long long time_dst;
     double output_time_cur = 0;
-    int n[SNDBUF_CHANS];
     sndbuf_t buf[PCM_MAX_BUF][SNDBUF_CHANS];
     static int warned;
 
@@ -692,32 +753,15 @@ static void dspio_process_dma(struct dspio_state *state)
     if (nfr > PCM_MAX_BUF)
 	nfr = PCM_MAX_BUF;
     for (i = 0; i < nfr;) {
-	memset(n, 0, sizeof(n));
-	for (j = 0; j < state->dma.stereo + 1; j++) {
-	    if (state->dma.running && !dspio_output_fifo_filled(state)) {
-		if (!dspio_run_dma(state))
-		    break;
-		dma_cnt++;
-	    }
-	    n[j] = dspio_get_output_sample(state, buf, i, j);
-	    if (!n[j]) {
-		if (out_fifo_cnt && debug_level('S') >= 5)
-		    S_printf("SB: no output samples\n");
-		break;
-	    }
-	    if (j)
-		assert(n[j] == n[0]);
-#if 0
-	    /* if speaker disabled, overwrite DMA data with silence */
-	    /* on SB16 is not used */
-	    if (!state->speaker)
-		dma_get_silence(state->dma.samp_signed,
-			state->dma.is16bit, &buf[i][j]);
-#endif
-	}
-	if (j != state->dma.stereo + 1)
+	/* refill the fifo, then decode everything it holds at once */
+	dma_cnt += dspio_fill_output(state);
+	n = dspio_get_output_frames(state, buf, i, nfr);
+	if (!n) {
+	    if (i && debug_level('S') >= 5)
+		S_printf("SB: no output samples\n");
 	    break;
-	i += n[0];
+	}
+	i += n;
     }
     out_fifo_cnt = i;
     if (out_fifo_cnt && state->dma.rate) {
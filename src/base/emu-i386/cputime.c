@@ -25,6 +25,7 @@
 #include "speaker.h"
 #include "dosemu_config.h"
 #include "sig.h"
+#include "twheel.h"
 
 /* --------------------------------------------------------------------- */
 /*
@@ -86,6 +87,10 @@ static hitimer_t LastTimeRead = 0;
 static hitimer_t StopTimeBase = 0;
 int cpu_time_stop = 0;
 static hitimer_t cached_time;
+static hitimer_t vtime_cur;
+static hitimer_t vtime_tick;	/* the time of the last tick */
+static hitimer_t vtime_seen;	/* vtime_cur at the last real tick */
+static int vtime_due;		/* the idle code wants the next tick */
 static pthread_mutex_t ctime_mtx = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t trigger_mtx = PTHREAD_MUTEX_INITIALIZER;
 static int        idle_tid;
@@ -126,6 +131,80 @@ static hitimer_t rawC4time(void)
   return ctime;
 }
 
+/*
+ * In virtual time mode the clock is advanced by what the guest does
+ * rather than by the host clock: every port access costs VTIME_IO_US,
+ * and when the guest idles the clock jumps to the next timer deadline.
+ * This makes the run reproducible, except for the code that spins
+ * without touching any port, see vtime_advance().
+ */
+#define VTIME_IO_US 1
+static hitimer_t rawVtime(void)
+{
+  hitimer_t ctime;
+
+  pthread_mutex_lock(&ctime_mtx);
+  ctime = vtime_cur;
+  pthread_mutex_unlock(&ctime_mtx);
+  return ctime;
+}
+
+void vtime_io(void)
+{
+  pthread_mutex_lock(&ctime_mtx);
+  vtime_cur += VTIME_IO_US;
+  pthread_mutex_unlock(&ctime_mtx);
+}
+
+/*
+ * Called on every tick, real or fast-forwarded. The tick only counts
+ * once the virtual clock got there. If the guest made no progress
+ * for a whole real tick, it spins on memory (the BIOS tick count, say)
+ * and the clock is moved on by a tick so that it can't hang.
+ */
+void vtime_advance(void)
+{
+  hitimer_t period = config.update / TIMER_DIVISOR;
+
+  pthread_mutex_lock(&ctime_mtx);
+  if (vtime_due) {
+    vtime_due = 0;
+  } else {
+    if (vtime_cur == vtime_seen && vtime_cur < vtime_tick + period)
+      vtime_cur = vtime_tick + period;
+    vtime_seen = vtime_cur;
+  }
+  if (vtime_cur >= vtime_tick + period)
+    vtime_tick = vtime_cur - (vtime_cur - vtime_tick) % period;
+  pthread_mutex_unlock(&ctime_mtx);
+}
+
+/*
+ * Jump to the deadline of a device timer (GETusTIME() based) if it
+ * comes before the next tick, else to the tick. Returns 0 in the
+ * latter case, the tick is then due.
+ */
+static int vtime_advance_to(hitimer_t deadline)
+{
+  hitimer_t to = deadline + ZeroTimeBase.td;
+  hitimer_t next;
+  int ret = 0;
+
+  pthread_mutex_lock(&ctime_mtx);
+  next = vtime_tick + config.update / TIMER_DIVISOR;
+  if (deadline != TWHEEL_NEVER && to < next) {
+    if (vtime_cur < to)
+      vtime_cur = to;
+    ret = 1;
+  } else {
+    if (vtime_cur < next)
+      vtime_cur = next;
+    vtime_due = 1;
+  }
+  pthread_mutex_unlock(&ctime_mtx);
+  return ret;
+}
+
 void uncache_time(void)
 {
   pthread_mutex_lock(&ctime_mtx);
@@ -149,6 +228,12 @@ static hitimer_t getC4time(void)
   return (rawC4time() - ZeroTimeBase.td);
 }
 
+static hitimer_t getVtime(void)
+{
+  if (cpu_time_stop) return LastTimeRead;
+  return (rawVtime() - ZeroTimeBase.td);
+}
+
 /*
  * SIDOC_BEGIN_FUNCTION GETusTIME(sc)
  *
@@ -192,6 +277,13 @@ hitimer_t GETusSYSTIME(void)
 
 void get_time_init(void)
 {
+  if (config.sound_vtime) {
+    RAWcpuTIME = rawVtime;
+    ZeroTimeBase.td = rawVtime();
+    GETcpuTIME = getVtime;
+    g_printf("TIMER: using virtual time\n");
+    return;
+  }
   ZeroTimeBase.td = rawC4time();
   RAWcpuTIME = rawC4time;		/* in usecs */
   GETcpuTIME = getC4time;		/* in usecs */
@@ -304,9 +396,18 @@ void untrigger_idle(void)
 void dosemu_sleep(void)
 {
   sigset_t mask;
+  if (config.sound_vtime && !dosemu_frozen) {
+    /* nothing to wait for: fast-forward to the next device timer, which
+     * twheel_run() then fires, or else to the next tick */
+    if (!signal_pending() && !vtime_advance_to(twheel_next()))
+      sigalrm_fast_forward();
+    return;
+  }
   uncache_time();
+  sigalrm_idle_enter();
   pthread_sigmask(SIG_SETMASK, NULL, &mask);
   sigsuspend(&mask);
+  sigalrm_idle_leave();
 }
 
 /* "strong" idle callers will have threshold1 = 0 so only the
@@ -28,6 +28,7 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <limits.h>
+#include <stdarg.h>
 #include <sys/mman.h>
 #include <sys/ioctl.h>
 #include <linux/kvm.h>
@@ -42,6 +43,7 @@
 #include "dos2linux.h"
 #include "mapping.h"
 #include "sig.h"
+#include "timers.h"
 
 #ifndef X86_EFLAGS_FIXED
 #define X86_EFLAGS_FIXED 2
@@ -152,6 +154,24 @@ static struct kvm_cpuid2 *cpuid;
 static struct kvm_run *run;
 static int kvmfd, vmfd, vcpufd;
 static struct kvm_sregs sregs;
+/* writes to ROM are collected in this ring instead of exiting */
+static struct kvm_coalesced_mmio_ring *coalesced_ring;
+static int coalesced_mmio;
+static unsigned long long mmio_exits, mmio_coalesced;
+
+/* exit profiling */
+#define KVM_STAT_REASONS 64
+#define KVM_STAT_MAXTOP 64
+static struct {
+  unsigned long long exits[KVM_STAT_REASONS];
+  hitimer_t time[KVM_STAT_REASONS];	/* handling, until the next KVM_RUN */
+  unsigned long long traps[0x100];
+  unsigned long long ports[0x10000];
+  unsigned long long mmio[0x10000];	/* by 64K ranges */
+  unsigned long long insns[0x100];	/* kvm_handle_vm86_fault() */
+  unsigned exit_reason;
+  hitimer_t exit_time;
+} kst;
 
 #define MAXSLOT 400
 static struct kvm_userspace_memory_region maps[MAXSLOT];
@@ -484,6 +504,9 @@ static int init_kvm_vcpu(void)
     return 0;
   }
   run->exit_reason = KVM_EXIT_INTR;
+  if (coalesced_mmio && coalesced_mmio * PAGE_SIZE < mmap_size)
+    coalesced_ring = (void *)((unsigned char *)run +
+	coalesced_mmio * PAGE_SIZE);
   return 1;
 }
 
@@ -533,6 +556,10 @@ int init_kvm_cpu(void)
   goto errcap;
 #endif
 
+  ret = ioctl(kvmfd, KVM_CHECK_EXTENSION, KVM_CAP_COALESCED_MMIO);
+  /* the value is the page offset of the ring in the vcpu mapping */
+  coalesced_mmio = (ret > 0 ? ret : 0);
+
   vmfd = ioctl(kvmfd, KVM_CREATE_VM, (unsigned long)0);
   if (vmfd == -1) {
     warn("KVM: KVM_CREATE_VM: %s\n", strerror(errno));
@@ -740,6 +767,12 @@ void kvm_set_readonly(dosaddr_t base, dosaddr_t size)
 				    (base - p->guest_phys_addr)));
   do_munmap_kvm(base, size);
   mmap_kvm_no_overlap(base, addr, size, KVM_MEM_READONLY);
+  if (coalesced_mmio) {
+    /* the writes are ignored anyway, so don't exit for them */
+    struct kvm_coalesced_mmio_zone zone = { .addr = base, .size = size };
+    if (ioctl(vmfd, KVM_REGISTER_COALESCED_MMIO, &zone) == -1)
+      error("KVM: KVM_REGISTER_COALESCED_MMIO: %s\n", strerror(errno));
+  }
 }
 
 void kvm_set_mmio(dosaddr_t base, dosaddr_t size, int on)
@@ -806,6 +839,109 @@ void kvm_get_dirty_map(dosaddr_t base, unsigned char *bitmap)
      exception of IOPL. IOPL is always set to 0 on the CPU,
      and to 3 on the stack with PUSHF
 */
+static void kvm_stat_enter(void)
+{
+  if (!kst.exit_reason)
+    return;
+  kst.time[kst.exit_reason] += GETusTIME(0) - kst.exit_time;
+  kst.exit_reason = 0;
+}
+
+static void kvm_stat_exit(unsigned exit_reason)
+{
+  if (exit_reason >= KVM_STAT_REASONS)
+    return;
+  kst.exits[exit_reason]++;
+  kst.exit_reason = exit_reason;
+  kst.exit_time = GETusTIME(0);
+}
+
+/* count the port of an in/out instruction that trapped with #GP */
+static void kvm_stat_port(dosaddr_t addr, unsigned edx)
+{
+  int i;
+
+  for (i = 0; i < 15; i++) {
+    switch (READ_BYTE(addr + i)) {
+    case 0x66: case 0x67: case 0x2e: case 0x3e: case 0x26: case 0x36:
+    case 0x64: case 0x65: case 0xf2: case 0xf3:
+      continue;
+    case 0xe4: case 0xe5: case 0xe6: case 0xe7:
+      kst.ports[READ_BYTE(addr + i + 1)]++;
+      return;
+    case 0x6c: case 0x6d: case 0x6e: case 0x6f:
+    case 0xec: case 0xed: case 0xee: case 0xef:
+      kst.ports[edx & 0xffff]++;
+      return;
+    }
+    return;
+  }
+}
+
+static void kvm_stat_top(const unsigned long long *cnt, int n, int top,
+    int shift, const char *fmt, void (*prn)(const char *, ...))
+{
+  int idx[KVM_STAT_MAXTOP];
+  int i, j, k, m = 0;
+
+  for (i = 0; i < n; i++) {
+    if (!cnt[i])
+      continue;
+    for (j = m; j > 0 && cnt[idx[j - 1]] < cnt[i]; j--);
+    if (j >= top)
+      continue;
+    if (m < top)
+      m++;
+    for (k = m - 1; k > j; k--)
+      idx[k] = idx[k - 1];
+    idx[j] = i;
+  }
+  for (i = 0; i < m; i++)
+    prn(fmt, idx[i] << shift, cnt[idx[i]]);
+}
+
+void kvm_print_stats(int top, void (*prn)(const char *, ...))
+{
+  static const char *names[KVM_STAT_REASONS] = {
+    [KVM_EXIT_HLT] = "HLT",
+    [KVM_EXIT_MMIO] = "MMIO",
+    [KVM_EXIT_IRQ_WINDOW_OPEN] = "IRQ_WINDOW_OPEN",
+    [KVM_EXIT_INTR] = "INTR",
+  };
+  int i;
+
+  if (top > KVM_STAT_MAXTOP)
+    top = KVM_STAT_MAXTOP;
+  prn("KVM exits:\n");
+  for (i = 0; i < KVM_STAT_REASONS; i++) {
+    if (!kst.exits[i])
+      continue;
+    prn("  %-16s %12llu, handled in %llu ms, avg %llu us\n",
+	names[i] ?: "?", kst.exits[i],
+	(unsigned long long)kst.time[i] / 1000,
+	(unsigned long long)kst.time[i] / kst.exits[i]);
+  }
+  prn("  %llu MMIO exits, %llu writes coalesced\n", mmio_exits,
+      mmio_coalesced);
+  prn("Top exceptions:\n");
+  kvm_stat_top(kst.traps, 0x100, top, 0, "  #%02x %16llu\n", prn);
+  prn("Top ports:\n");
+  kvm_stat_top(kst.ports, 0x10000, top, 0, "  %04x %15llu\n", prn);
+  prn("Top MMIO ranges (64K):\n");
+  kvm_stat_top(kst.mmio, 0x10000, top, 16, "  %08x %11llu\n", prn);
+  prn("Top instructions emulated:\n");
+  kvm_stat_top(kst.insns, 0x100, top, 0, "  %02x %17llu\n", prn);
+}
+
+static void kvm_stat_log(const char *fmt, ...)
+{
+  va_list args;
+
+  va_start(args, fmt);
+  vlog_printf(debug_level('Q'), fmt, args);
+  va_end(args);
+}
+
 static int kvm_handle_vm86_fault(struct vm86_regs *regs, unsigned int cpu_type)
 {
   unsigned char opcode;
@@ -902,6 +1038,7 @@ static int kvm_handle_vm86_fault(struct vm86_regs *regs, unsigned int cpu_type)
     return VM86_UNKNOWN;
   }
 
+  kst.insns[opcode]++;
   regs->esp = (regs->esp & 0xffff0000) | sp;
   regs->eip = (regs->eip & 0xffff0000) | ip;
   if (ret != -1)
@@ -1064,6 +1201,36 @@ static int kvm_post_run(struct vm86_regs *regs, struct kvm_regs *kregs)
   return 1;
 }
 
+static void kvm_mmio_write(dosaddr_t addr, unsigned char *data, int len)
+{
+  /* for ROM: simply ignore the write */
+  if (memcheck_is_rom(addr))
+    return;
+  switch(len) {
+  case 1: write_byte(addr, data[0]); break;
+  case 2: write_word(addr, *(uint16_t*)data); break;
+  case 4: write_dword(addr, *(uint32_t*)data); break;
+  case 8: write_qword(addr, *(uint64_t*)data); break;
+  }
+}
+
+/* process the writes collected in the coalesced MMIO ring */
+static void kvm_drain_coalesced_mmio(void)
+{
+  struct kvm_coalesced_mmio_ring *ring = coalesced_ring;
+
+  if (!ring)
+    return;
+  while (ring->first != ring->last) {
+    struct kvm_coalesced_mmio *m = &ring->coalesced_mmio[ring->first];
+
+    kvm_mmio_write(m->phys_addr, m->data, m->len);
+    __sync_synchronize();
+    ring->first = (ring->first + 1) % KVM_COALESCED_MMIO_MAX;
+    mmio_coalesced++;
+  }
+}
+
 /* Inner loop for KVM, runs until HLT or signal */
 static unsigned int kvm_run(void)
 {
@@ -1072,6 +1239,7 @@ static unsigned int kvm_run(void)
   static struct vm86_regs saved_regs;
   struct vm86_regs *regs = &monitor->regs;
 
+  kvm_stat_enter();
   if (run->exit_reason != KVM_EXIT_HLT &&
       memcmp(regs, &saved_regs, sizeof(*regs))) {
     /* Only set registers if changes happened, usually
@@ -1121,6 +1289,8 @@ static unsigned int kvm_run(void)
     int ret = ioctl(vcpufd, KVM_RUN, NULL);
     int errn = errno;
 
+    kvm_drain_coalesced_mmio();
+
     /* KVM should only exit for four reasons:
        1. KVM_EXIT_HLT: at the hlt in kvmmon.S following an exception.
           In this case the registers are pushed on and popped from the stack.
@@ -1151,6 +1321,8 @@ static unsigned int kvm_run(void)
       exit_reason = KVM_EXIT_HLT;
       break;
     case KVM_EXIT_MMIO:
+      mmio_exits++;
+      kst.mmio[run->mmio.phys_addr >> 16 & 0xffff]++;
       /* for ROM: simply ignore the write and continue */
       if (memcheck_is_rom(run->mmio.phys_addr))
 	break;
@@ -1164,12 +1336,7 @@ static unsigned int kvm_run(void)
 	dosaddr_t addr = (dosaddr_t)run->mmio.phys_addr;
 	unsigned char *data = run->mmio.data;
 	if (run->mmio.is_write) {
-	  switch(run->mmio.len) {
-	  case 1: write_byte(addr, data[0]); break;
-	  case 2: write_word(addr, *(uint16_t*)data); break;
-	  case 4: write_dword(addr, *(uint32_t*)data); break;
-	  case 8: write_qword(addr, *(uint64_t*)data); break;
-	  }
+	  kvm_mmio_write(addr, data, run->mmio.len);
 	} else {
 	  switch(run->mmio.len) {
 	  case 1: data[0] = read_byte(addr); break;
@@ -1179,6 +1346,7 @@ static unsigned int kvm_run(void)
 	  }
 	}
 	ret = ioctl(vcpufd, KVM_RUN, NULL);
+	kvm_drain_coalesced_mmio();
 	/* read-modify-write instructions give two KVM_EXIT_MMIO
 	   exits in a row before the signal exit */
       } while (ret == 0 && run->exit_reason == KVM_EXIT_MMIO);
@@ -1214,6 +1382,7 @@ static unsigned int kvm_run(void)
       break;
     }
   }
+  kvm_stat_exit(exit_reason);
   return exit_reason;
 }
 
@@ -1267,6 +1436,9 @@ int kvm_vm86(struct vm86_struct *info)
     /* high word(orig_eax) = exception number */
     /* low word(orig_eax) = error code */
     trapno = (regs->orig_eax >> 16) & 0xff;
+    kst.traps[trapno]++;
+    if (trapno == 0xd)
+      kvm_stat_port(SEGOFF2LINEAR(regs->cs, regs->eip), regs->edx);
 #if 1
     if (trapno == 1 && (sregs.cr4 & X86_CR4_VME))
       kvm_vme_tf_popf_fixup(regs);
@@ -1361,6 +1533,9 @@ int kvm_dpmi(cpuctx_t *scp)
       _cr2 = monitor->cr2;
       _trapno = (regs->orig_eax >> 16) & 0xff;
       _err = regs->orig_eax & 0xffff;
+      kst.traps[_trapno]++;
+      if (_trapno == 0xd)
+	kvm_stat_port(GetSegmentBase(_cs) + _eip, _edx);
       if (_trapno > 0x10) {
 	// convert software ints into the GPFs that the DPMI code expects
 	_err = (_trapno << 3) + 2;
@@ -1408,6 +1583,8 @@ int kvm_dpmi(cpuctx_t *scp)
 
 void kvm_done(void)
 {
+  if (debug_level('Q'))
+    kvm_print_stats(10, kvm_stat_log);
   close(vcpufd);
   close(vmfd);
   close(kvmfd);
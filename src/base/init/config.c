@@ -185,6 +185,7 @@ void dump_config_status(void (*printfunc)(const char *, ...))
         config.umb_a0, config.umb_b0, config.umb_f0, config.dos_up);
     (*print)("dpmi 0x%x\ndpmi_base 0x%x\npm_dos_api %i\nignore_djgpp_null_derefs %i\n",
         config.dpmi, config.dpmi_base, config.pm_dos_api, config.no_null_checks);
+    (*print)("hugepages %d\n", config.hugepages);
     (*print)("mapped_bios %d\nvbios_file %s\n",
         config.mapped_bios, (config.vbios_file ? config.vbios_file :""));
     (*print)("vbios_copy %d\nvbios_seg 0x%x\nvbios_size 0x%x\n",
@@ -233,6 +234,7 @@ void dump_config_status(void (*printfunc)(const char *, ...))
     }
     (*print)("config.X %d\nhogthreshold %d\nchipset \"%s\"\n",
         config.X, config.hogthreshold, s);
+    (*print)("tickless_idle %d\n", config.tickless_idle);
     switch (config.cardtype) {
       case CARD_VGA: s = "VGA"; break;
       case CARD_MDA: s = "MGA"; break;
@@ -258,6 +260,10 @@ void dump_config_status(void (*printfunc)(const char *, ...))
         config.tty_lockdir, config.tty_lockfile, config.tty_lockbinary);
     (*print)("num_ser %d\nnum_lpt %d\nfastfloppy %d\nfile_lock_limit %d\n",
         config.num_ser, config.num_lpt, config.fastfloppy, config.file_lock_limit);
+    (*print)("file_open_limit %d\n", config.file_open_limit);
+    (*print)("disk_uring %d\ndisk_cache %d\ndisk_cache_wb %d\n",
+        config.disk_uring, config.disk_cache, config.disk_cache_wb);
+    (*print)("fatfs_write %d\n", config.fatfs_write);
     (*print)("emusys \"%s\"\n",
         (config.emusys ? config.emusys : ""));
     (*print)("vbios_post %d\ndetach %d\n",
@@ -293,6 +299,8 @@ void dump_config_status(void (*printfunc)(const char *, ...))
     list_hardware_ram(print);
     (*print)("ipxsup %d\nvnet %d\npktflags 0x%x\n",
 	config.ipxsup, config.vnet, config.pktflags);
+    (*print)("ethdev %s\nethring %d\n",
+	(config.ethdev ? config.ethdev : ""), config.eth_ring);
 
     {
         int i;
@@ -312,8 +320,9 @@ void dump_config_status(void (*printfunc)(const char *, ...))
 	"mpu401_base 0x%x\nmpu401_irq %i\nsound_driver \"%s\"\n",
         config.sound, config.sb_base, config.sb_dma, config.sb_hdma, config.sb_irq,
 	config.mpu401_base, config.mpu401_irq, config.sound_driver);
-    (*print)("pcm_hpf %i\nmidi_file %s\nwav_file %s\n",
-	config.pcm_hpf, config.midi_file, config.wav_file);
+    (*print)("pcm_hpf %i\nmidi_file %s\nwav_file %s\nsound_vtime %i\n",
+	config.pcm_hpf, config.midi_file, config.wav_file,
+	config.sound_vtime);
     (*print)("\ncli_timeout %d\n", config.cli_timeout);
     (*print)("\ntimer_tweaks %d\n", config.timer_tweaks);
     (*print)("\nJOYSTICK:\njoy_device0 \"%s\"\njoy_device1 \"%s\"\njoy_dos_min %i\njoy_dos_max %i\njoy_granularity %i\njoy_latency %i\n",
@@ -68,7 +68,7 @@ static struct io_dev_struct io_devices[MAX_IO_DEVICES] = {
   { "video",   video_post_init, NULL, NULL },
   { "internal_mouse",  dosemu_mouse_init,   NULL, dosemu_mouse_close },
   { "serial",  serial_init,  serial_reset,  serial_close },
-  { "pic",     pic_init,     pic_reset,     NULL },
+  { "pic",     pic_init,     pic_reset,     pic_done },
   { "chipset", chipset_init, NULL,          NULL },
   { "virq",    virq_init,    virq_reset,    NULL },
   { "vint",    vint_init,    NULL,          NULL },
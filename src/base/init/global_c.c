@@ -0,0 +1,598 @@
+char global_conf[] = \
+"##############################################################################\n"\
+"# WARNING: THIS FILE IS NOT USED BY DEFAULT. ADJUST dosemu.users OR USE -F.\n"\
+"#\n"\
+"# This file is global.conf. By default a compiled-in copy is used. If you\n"\
+"# make custom changes to the settings in this file, then you need to use\n"\
+"# the -F switch or change dosemu.users; the custom file is then parsed\n"\
+"# after the built-in copy.\n"\
+"#\n"\
+"# Linux dosemu  configuration  for parser versions >= 3 (dosemu-0.97.0.1)\n"\
+"#\n"\
+"# ./doc/README-tech.txt (chapter 2.) contains a description of the syntax\n"\
+"# and the usage. However, you normally won\'t edit this file !!\n"\
+"#\n"\
+"# NOTES:\n"\
+"#\n"\
+"# 1. The file dosemu.conf (and optionally ~/.dosemurc) contains variable\n"\
+"#    settings, that are included by global.conf for doing the\n"\
+"#    most reasonable configuration.\n"\
+"#    The file dosemu.conf (and optionally ~/.dosemurc) is what gets\n"\
+"#    updated by the menu driven \'setup-dosemu\' tool.\n"\
+"#\n"\
+"# 2. We strongly recommend you to edit ONLY dosemu.conf.\n"\
+"#    If you change global.conf, you are at your own and could break\n"\
+"#    \'setup-dosemu\'.  You really need to know a lot of DOSEMU\n"\
+"#    internals before you fiddle with editing global.conf.\n"\
+"#    However, some very special cases can only be handled in global.conf.\n"\
+"#\n"\
+"# 3. The file global.conf (this one) is either\n"\
+"#      - the one compiled into dosemu.bin.\n"\
+"#      - specified by the config_script option in dosemu.users (\"builtin\"\n"\
+"#        by default)\n"\
+"#      - or given via the -F option (from root login, else only on\n"\
+"#        non-suid-root DOSEMU)\n"\
+"#\n"\
+"# 4. The only compiled-in path is /etc/dosemu.users (or if not found\n"\
+"#    /etc/dosemu/dosemu.users), however, this can be overridden by\n"\
+"#    --Fusers, if not running suid-root. All other paths are configurable\n"\
+"#    and the dosemu binaries can reside everywhere in the system.\n"\
+"#\n"\
+"# This file (global.conf) may also serve as an example file for\n"\
+"#      .dosrc            ( old style user configuration file )\n"\
+"#      option -I         ( configuration via commandline, see man/dos.1 )\n"\
+"#\n"\
+"# Access rights for suid-root running DOSEMU sessions are defined in\n"\
+"#\n"\
+"#      /etc/dosemu.users or /etc/dosemu/dosemu.users\n"\
+"#\n"\
+"##############################################################################\n"\
+"\n"\
+"ifdef u_forceold\n"\
+"  undef parser_version_3\n"\
+"  define version_3_style_used\n"\
+"endif\n"\
+"\n"\
+"ifndef parser_version_3\n"\
+"  # normally won\'t come here, because older DOSEMUs don\'t use this file\n"\
+"  # ... but if using -F option ...\n"\
+"  include \"/etc/dosemu.conf\"\n"\
+"else\n"\
+"  # we are on version 3 parser\n"\
+"\n"\
+"  ## we set some vital variable\n"\
+"\n"\
+"  if (!strlen($DOSEMU_LIB_DIR))\n"\
+"    abort \"DOSEMU_LIB_DIR not set\";\n"\
+"  endif\n"\
+"  if (!strlen($DOSEMU_IMAGE_DIR))\n"\
+"    $DOSEMU_IMAGE_DIR = $DOSEMU_LIB_DIR;\n"\
+"  endif\n"\
+"  # make sure we have absolute paths\n"\
+"  shell(\"test -d \", $DOSEMU_IMAGE_DIR)\n"\
+"  if ($DOSEMU_SHELL_RETURN)\n"\
+"    abort \"DOSEMU_IMAGE_DIR does not exist \", $DOSEMU_IMAGE_DIR;\n"\
+"  endif\n"\
+"  $DOSEMU_IMAGE_DIR = shell(\"cd \", $DOSEMU_IMAGE_DIR, \"; pwd -P\");\n"\
+"  $DOSEMU_IMAGE_DIR = strdel($DOSEMU_IMAGE_DIR, strlen($DOSEMU_IMAGE_DIR)-1, 1);\n"\
+"  shell(\"test -d \", $DOSEMU_LIB_DIR)\n"\
+"  if (!$DOSEMU_SHELL_RETURN)\n"\
+"    $DOSEMU_LIB_DIR = shell(\"cd \", $DOSEMU_LIB_DIR, \"; pwd -P\");\n"\
+"    $DOSEMU_LIB_DIR = strdel($DOSEMU_LIB_DIR, strlen($DOSEMU_LIB_DIR)-1, 1);\n"\
+"  endif\n"\
+"\n"\
+"  $CONFIG_VERSION = ( (1 << 24) | (1 << 16) | (4 << 8) | 0)\n"\
+"  #                    ^           ^           ^         ^\n"\
+"  if ( $DOSEMU_VERSION_CODE < $CONFIG_VERSION )\n"\
+"    abort \"\n"\
+"*** sorry, your \", $DOSEMU_LIB_DIR, \"/global.conf doesn\'t match this dosemu version\n"\
+"\"\n"\
+"  endif\n"\
+"\n"\
+"  $LIST_DELIM = \" ,	\"	#delimiters for lists <tab>, blank, comma\n"\
+"\n"\
+"  # for non-suid-root we can switch off restricted checking.\n"\
+"  if (strlen($DOSEMU_LAX_CHECKING))\n"\
+"    undef restricted\n"\
+"    undef guest\n"\
+"  endif\n"\
+"\n"\
+"  if (strlen($_mapping)) $xxx = $_mapping else $xxx = \"auto\" endif\n"\
+"  mappingdriver $xxx;\n"\
+"\n"\
+"  if (strlen($_debug))\n"\
+"    debug $_debug ;\n"\
+"  else\n"\
+"    debug { off }\n"\
+"  endif\n"\
+"  if (strlen($_trace_ports)) trace ports { $$_trace_ports } endif\n"\
+"  if (strlen($_trace_mmio)) trace_mmio { $$_trace_mmio } endif\n"\
+"\n"\
+"  cpuspeed $_cpuspeed\n"\
+"\n"\
+"  timer 0\n"\
+"  mathco $_mathco\n"\
+"  $xxx = \"cpu \", $_cpu;\n"\
+"  $$xxx\n"\
+"  cpuemu $$_cpuemu\n"\
+"  $xxx = \"cpu_vm \", $_cpu_vm;\n"\
+"  $$xxx\n"\
+"  $xxx = \"cpu_vm_dpmi \", $_cpu_vm_dpmi;\n"\
+"  $$xxx\n"\
+"  if ($_ems)\n"\
+"    ems {\n"\
+"          ems_size $_ems\n"\
+"          ems_frame $_ems_frame\n"\
+"          ems_uma_pages $_ems_uma_pages\n"\
+"          ems_conv_pages $_ems_conv_pages\n"\
+"        }\n"\
+"  else\n"\
+"    ems off\n"\
+"  endif\n"\
+"  umb_a0 $_umb_a0\n"\
+"  umb_b0 $_umb_b0\n"\
+"  umb_f0 $_umb_f0\n"\
+"  hma $_hma\n"\
+"  dos_up $_dos_up\n"\
+"  dpmi $_dpmi\n"\
+"  dpmi_base $_dpmi_base\n"\
+"  pm_dos_api 1\n"\
+"  ignore_djgpp_null_derefs $_ignore_djgpp_null_derefs\n"\
+"  dosmem $_dosmem\n"\
+"  ext_mem $_ext_mem\n"\
+"  xms $_xms\n"\
+"\n"\
+"  if ($_emusys ne \"\") emusys $_emusys endif\n"\
+"\n"\
+"  ## terminal stuff, we check a lot to insure proper operation\n"\
+"\n"\
+"  terminal { color $_term_color escchar $_escchar size $_fixed_term_size }\n"\
+"  xterm_title $_xterm_title\n"\
+"  video { vga }\n"\
+"  if ($_external_char_set ne \"\")\n"\
+"    charset { external $$_external_char_set }\n"\
+"  endif\n"\
+"  if ($_internal_char_set ne \"\")\n"\
+"    charset { internal $$_internal_char_set }\n"\
+"  endif\n"\
+"\n"\
+"  ## X param settings\n"\
+"    $xxx = \"\"\n"\
+"    if ($_X_sharecmap) $xxx = $xxx, \" sharecmap\" endif\n"\
+"    if ($_X_aspect_43) $xxx = $xxx, \" aspect_43\" endif\n"\
+"    if ($_X_lin_filt) $xxx = $xxx, \" lin_filt\"  endif\n"\
+"    if ($_X_bilin_filt) $xxx = $xxx, \" bilin_filt\" endif\n"\
+"    $xxx = $xxx, \" mode13fact \", $_X_mode13fact\n"\
+"    $xxx = $xxx, \" gamma \", (int($_X_gamma * 100))\n"\
+"    $xxx = $xxx, \" font \'\", $_X_font, \"\'\"\n"\
+"    if (strlen($_X_winsize))\n"\
+"      $yyy = (strstr($_X_winsize,\",\"))\n"\
+"      $yyy = \" winsize (\", strdel($_X_winsize,$yyy,999), \") , (\",\n"\
+"              strsplit($_X_winsize,$yyy+1,999), \")\"\n"\
+"      $xxx = $xxx, $yyy\n"\
+"    endif\n"\
+"\n"\
+"    if (strlen($_X_vesamode))\n"\
+"      foreach $yyy (\" 	\", $_X_vesamode)\n"\
+"        $zzz = (strchr($yyy,\",\"))\n"\
+"        $xxx = $xxx, \" vesamode (\", strdel($yyy,$zzz,999), \"),(\",\n"\
+"                      strsplit($yyy,$zzz+1,999), \") \"\n"\
+"      done\n"\
+"    endif\n"\
+"    $xxx = $xxx, \' mgrab_key \"\', $_X_mgrab_key, \'\"\'\n"\
+"    X {\n"\
+"      title $_X_title title_show_appname $_X_title_show_appname\n"\
+"      icon_name $_X_icon_name\n"\
+"      blinkrate $_X_blinkrate\n"\
+"      fixed_aspect $_X_fixed_aspect vgaemu_memsize $_X_vgaemu_memsize\n"\
+"      lfb $_X_lfb  pm_interface $_X_pm_interface mitshm $_X_mitshm\n"\
+"      background_pause $_X_background_pause fullscreen $_X_fullscreen\n"\
+"      noclose $_X_noclose\n"\
+"      noresize $_X_noresize\n"\
+"      $$xxx\n"\
+"    }\n"\
+"\n"\
+"  ## SDL settings\n"\
+"  SDL { sdl_hwrend $_SDL_hwrend sdl_fonts $_SDL_fonts sdl_wcontrols $_SDL_wcontrols sdl_clip_native $_SDL_clip_native }\n"\
+"\n"\
+"  # video settings\n"\
+"  vga_fonts $$_force_vga_fonts\n"\
+"  if ($DOSEMU_STDIN_IS_CONSOLE eq \"1\")\n"\
+"    warn \"dosemu running on console\"\n"\
+"    $xxx = $_video\n"\
+"    if ($_console) $xxx = $xxx, \" console\"\n"\
+"       if ($_console == auto) $xxx = $xxx, \" auto\" endif\n"\
+"    endif\n"\
+"    if ($_graphics) $xxx = $xxx, \" graphics\"\n"\
+"       if ($_graphics == auto) $xxx = $xxx, \" auto\" endif\n"\
+"    endif\n"\
+"    $xxx = $xxx, \" vbios_seg \", $_vbios_seg, \" vbios_size \",\n"\
+"	        $_vbios_size, \" memsize \", $_vmemsize\n"\
+"    if (strlen($_chipset)) $yyy = $_chipset else $yyy = \"plainvga\" endif\n"\
+"    $xxx = $xxx, \" chipset \", $yyy\n"\
+"    if ($_vbios_post) $xxx = $xxx, \" vbios_post \" endif\n"\
+"    if ($_dualmon) $xxx = $xxx, \" dualmon\" endif\n"\
+"    if (strlen($_vbios_file)) $xxx = $xxx, \" vgaemubios_file \", $_vbios_file endif\n"\
+"    video { $$xxx }\n"\
+"  else\n"\
+"    warn \"dosemu not running on console\"\n"\
+"    $xxx = $_video\n"\
+"    if (strlen($_vbios_file)) $xxx = $xxx, \" vgaemubios_file \", $_vbios_file endif\n"\
+"    if ($_dualmon) $xxx = $xxx, \" dualmon \" endif\n"\
+"    if (strlen($xxx)) video { $$xxx } endif\n"\
+"  endif\n"\
+"\n"\
+"  ## sound settings\n"\
+"  sound $_sound\n"\
+"  sound_emu { sb_base $_sb_base\n"\
+"	        sb_irq $_sb_irq\n"\
+"		sb_dma $_sb_dma\n"\
+"		sb_hdma $_sb_hdma\n"\
+"		mpu_base $_mpu_base\n"\
+"		mpu_base_mt32 $_mpu_base_mt32\n"\
+"		midi_synth $_midi_synth\n"\
+"		mpu_irq $_mpu_irq\n"\
+"		mpu_irq_mt32 $_mpu_irq_mt32\n"\
+"		sound_driver $_sound_driver\n"\
+"		midi_driver $_midi_driver\n"\
+"		fluid_sfont $_fluid_sfont\n"\
+"		fluid_volume $_fluid_volume\n"\
+"		munt_roms $_munt_roms\n"\
+"		opl2lpt_dev $_opl2lpt_dev\n"\
+"		opl2lpt_type $_opl2lpt_type\n"\
+"		snd_plugin_params $_snd_plugin_params\n"\
+"		pcm_hpf $_pcm_hpf\n"\
+"		midi_file $_midi_file\n"\
+"		wav_file $_wav_file\n"\
+"  }\n"\
+"\n"\
+"  ## joystick settings\n"\
+"  joystick_emu { joy_device $_joy_device joy_dos_min $_joy_dos_min\n"\
+"	joy_dos_max $_joy_dos_max joy_granularity $_joy_granularity\n"\
+"	joy_latency $_joy_latency }\n"\
+"\n"\
+"  ## hacks\n"\
+"  cli_timeout $_cli_timeout\n"\
+"  timemode $_timemode\n"\
+"  timer_tweaks $_timer_tweaks\n"\
+"\n"\
+"  file_lock_limit $$_file_lock_limit\n"\
+"  lfn_support $_lfn_support\n"\
+"  force_int_revect $_force_int_revect\n"\
+"  set_int_hooks $_set_int_hooks\n"\
+"  trace_irets $_trace_irets\n"\
+"  force_fs_redirect $_force_fs_redirect\n"\
+"\n"\
+"  ## serial\n"\
+"  $xxx = \"\'\", $_ttylocks, \"\'\"\n"\
+"  ttylocks { directory $$xxx namestub LCK.. }\n"\
+"  if (1) # no idea why but we need this...\n"\
+"    foreach $xxx (\" \", \"1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16\")\n"\
+"      $zzz = \"$_com\", $xxx\n"\
+"      $zzz = $$zzz\n"\
+"      if (strlen($zzz))\n"\
+"        $jjj = \"\"\n"\
+"        if (strchr($zzz, \" \") > 0)\n"\
+"          $yyy = strsplit($zzz, strchr($zzz, \" \") + 1, 999)\n"\
+"          $zzz = strdel($zzz, strchr($zzz, \" \"), 999)\n"\
+"        else\n"\
+"          $yyy = \"\"\n"\
+"        endif\n"\
+"        if (strchr($zzz, \"/\") == 0)\n"\
+"          if (strchr($yyy, \" \") > 0)\n"\
+"            $jjj = strsplit($yyy, strchr($yyy, \" \") + 1, 999)\n"\
+"            $yyy = strdel($yyy, strchr($yyy, \" \"), 999)\n"\
+"          endif\n"\
+"          if (strlen($jjj) > 0)\n"\
+"            serial { com $xxx device $zzz $$yyy $jjj }\n"\
+"          else\n"\
+"            serial { com $xxx device $zzz $$yyy }\n"\
+"          endif\n"\
+"        else\n"\
+"          if (strlen($yyy) > 0)\n"\
+"            serial { com $xxx $$zzz $yyy }\n"\
+"          else\n"\
+"            serial { com $xxx $$zzz }\n"\
+"          endif\n"\
+"        endif\n"\
+"      endif\n"\
+"    done\n"\
+"  endif\n"\
+"\n"\
+"  ## mouse settings\n"\
+"  if ($_mouse_internal)\n"\
+"    $xxx = \"\"\n"\
+"    if ($_mouse_baud)\n"\
+"      $xxx = \"baudrate \", $_mouse_baud\n"\
+"    endif\n"\
+"    $xxx = $xxx, \" device \'\", $_mouse_dev, \"\'\"\n"\
+"    mouse { $$_mouse $$_mouse_flags $$xxx internaldriver mouse_ungrab_tweak $_mouse_ungrab_tweak }\n"\
+"  else\n"\
+"    $xxx = \"\'\", $_mouse_dev, \"\'\"\n"\
+"    mouse { $$_mouse device $$xxx }\n"\
+"  endif\n"\
+"\n"\
+"  hogthreshold $_hogthreshold\n"\
+"\n"\
+"  ## keyboard setting\n"\
+"  if ($DOSEMU_STDIN_IS_CONSOLE ne \"1\") $_rawkeyboard = (off) endif\n"\
+"  if ( strstr($_layout, \"load\") <0 )\n"\
+"      # we use the builtin keytables\n"\
+"      if (strlen($_layout)) $yyy = $_layout else $yyy = \"us\" endif\n"\
+"      keyboard { layout $yyy  rawkeyboard $_rawkeyboard }\n"\
+"  else\n"\
+"      # we have to load a keytable\n"\
+"      $yyy = \"\"\n"\
+"      if (1) # no idea why (see com as well) but we need this...\n"\
+"        foreach $zzz ($LIST_DELIM, $_layout)\n"\
+"          if ($zzz ne \"load\")\n"\
+"            $yyy = $zzz\n"\
+"          endif\n"\
+"        done\n"\
+"      endif\n"\
+"      if (!strlen($yyy))\n"\
+"        abort \"no keytable name in $_layout\"\n"\
+"      endif\n"\
+"      shell(\"test -f \", $DOSEMU_LIB_DIR, \"/keymap/\", $yyy)\n"\
+"      if ( $DOSEMU_SHELL_RETURN)\n"\
+"        abort \"keytable \",$yyy, \" not found in \", $DOSEMU_LIB_DIR, \"/keymap/*\"\n"\
+"	      endif\n"\
+"      $_layout = \'include \"keymap/\', $yyy, \'\"\' ;\n"\
+"      $$_layout\n"\
+"      keyboard { rawkeyboard $_rawkeyboard }\n"\
+"  endif\n"\
+"\n"\
+"  bootdrive $_bootdrive\n"\
+"  swap_bootdrive $_swap_bootdrive\n"\
+"\n"\
+"  if (strlen($_floppy_a))\n"\
+"    $fpath = strsplit($_floppy_a, 0, strstr($_floppy_a, \":\"))\n"\
+"    if (strlen($fpath))\n"\
+"      $ftype = strsplit($_floppy_a, strstr($_floppy_a, \":\")+1, 999)\n"\
+"    else\n"\
+"      $fpath = $_floppy_a\n"\
+"      $ftype = \"\"\n"\
+"    endif\n"\
+"\n"\
+"    $zzz = $fpath\n"\
+"    if (strlen($zzz))\n"\
+"      if (strchr($zzz, \"/\") != 0)\n"\
+"        $izzz = $DOSEMU_IMAGE_DIR, \"/\", $zzz\n"\
+"        $xxx = shell(\"test -r \", $izzz);\n"\
+"        if (!$DOSEMU_SHELL_RETURN)\n"\
+"          $zzz = $izzz\n"\
+"        endif\n"\
+"      endif\n"\
+"      $xxx = shell(\"test -r \", $zzz);\n"\
+"      if ($DOSEMU_SHELL_RETURN)\n"\
+"        warn \"**** Warning: floppy \", $zzz, \" not accessible, disabled\";\n"\
+"      else\n"\
+"        shell(\"test -d \'\", $zzz, \"\'\")\n"\
+"        if ($DOSEMU_SHELL_RETURN)\n"\
+"          floppy { device $$zzz $$ftype }\n"\
+"        else\n"\
+"          floppy { directory $$zzz $$ftype }\n"\
+"        endif\n"\
+"      endif\n"\
+"    endif\n"\
+"  endif\n"\
+"  if (strlen($_floppy_b))\n"\
+"    $fpath = strsplit($_floppy_b, 0, strstr($_floppy_b, \":\"))\n"\
+"    if (strlen($fpath))\n"\
+"      $ftype = strsplit($_floppy_b, strstr($_floppy_b, \":\")+1, 999)\n"\
+"    else\n"\
+"      $fpath = $_floppy_b\n"\
+"      $ftype = \"\"\n"\
+"    endif\n"\
+"\n"\
+"    $zzz = $fpath\n"\
+"    if (strlen($zzz))\n"\
+"      if (strchr($zzz, \"/\") != 0)\n"\
+"        $izzz = $DOSEMU_IMAGE_DIR, \"/\", $zzz\n"\
+"        $xxx = shell(\"test -r \", $izzz);\n"\
+"        if (!$DOSEMU_SHELL_RETURN)\n"\
+"          $zzz = $izzz\n"\
+"        endif\n"\
+"      endif\n"\
+"      $xxx = shell(\"test -r \", $zzz);\n"\
+"      if ($DOSEMU_SHELL_RETURN)\n"\
+"        warn \"**** Warning: floppy \", $zzz, \" not accessible, disabled\";\n"\
+"      else\n"\
+"        shell(\"test -d \'\", $zzz, \"\'\")\n"\
+"        if ($DOSEMU_SHELL_RETURN)\n"\
+"          floppy { device $$zzz $$ftype }\n"\
+"        else\n"\
+"          floppy { directory $$zzz $$ftype }\n"\
+"        endif\n"\
+"      endif\n"\
+"    endif\n"\
+"  endif\n"\
+"  fastfloppy 1\n"\
+"\n"\
+"  ## setting up hdimages\n"\
+"  $xxx = shell(\"ls \", $DOSEMU_IMAGE_DIR, \"/drives/*.lnk 2>/dev/null\")\n"\
+"  if (strlen($xxx))\n"\
+"    error \"Compatibility warning: found deprecated setup of dosemu2 pre-alpha version.\"\n"\
+"    error \"    If you do not intend to run such old dosemu2 versions \"\n"\
+"    error \"    (dosemu1 is fine), please do:\"\n"\
+"    error \"        rm ~/.dosemu/drives/*.lnk\"\n"\
+"    error \"    You may also do\"\n"\
+"    error \"        rm -rf ~/.dosemu/drives\"\n"\
+"    error \"    if you dont intend to run dosemu1.\"\n"\
+"  endif\n"\
+"  if (strlen($_hdimage))\n"\
+"    foreach $xxxx ($LIST_DELIM, $_hdimage)\n"\
+"      $xxx_pref = \"\"\n"\
+"      $xxx_suff = \"\"\n"\
+"      if (strchr($xxxx, \"*\") != -1)\n"\
+"        $xxx_pref = strdel($xxxx, strchr($xxxx, \"*\"), 999);\n"\
+"        $xxx_suff = strsplit($xxxx, strchr($xxxx, \"*\") + 1, 999);\n"\
+"        if (strchr($xxx_pref, \"/\") == 0)\n"\
+"          $xxxx = shell(\"cd \'\", $xxx_pref, \"\' 2>/dev/null && printf *\")\n"\
+"        else\n"\
+"          $xxxx = shell(\"cd \'\", $DOSEMU_IMAGE_DIR, \"/\", $xxx_pref, \"\' 2>/dev/null && printf *\")\n"\
+"        endif\n"\
+"        if ($DOSEMU_SHELL_RETURN)\n"\
+"          abort \"**** directory \", $xxx_pref, \" not accessible\";\n"\
+"        endif\n"\
+"      endif\n"\
+"      if (strchr($xxxx, \"+\") == 0)\n"\
+"        default_drives strtol(strdel($xxxx, 0, 1))\n"\
+"      else if (strchr($xxxx, \"-\") == 0)\n"\
+"        skip_drives strtol(strdel($xxxx, 0, 1))\n"\
+"      else if (strlen($xxxx))\n"\
+"        foreach $xxx ($LIST_DELIM, $xxxx)\n"\
+"          $xxx = $xxx_pref, $xxx, $xxx_suff\n"\
+"          if (!strncmp($xxx, \"/dev/\", 4))\n"\
+"            $yyy = strdel($xxx, strstr($xxx, \":\"), 999);\n"\
+"            $zzz = strsplit($xxx, strstr($xxx, \":\"), 999);\n"\
+"            if (strtol(strdel($xxx,0,8)) > 0)\n"\
+"              disk { partition $yyy $$zzz };\n"\
+"            else\n"\
+"              disk { wholedisk $yyy $$zzz };\n"\
+"            endif\n"\
+"          else\n"\
+"            $yyy = strdel($xxx, strstr($xxx, \":\"), 999);\n"\
+"            $zzz = strsplit($xxx, strstr($xxx, \":\"), 999);\n"\
+"            if (strchr($yyy, \"/\") != 0)\n"\
+"              $yyyy = $DOSEMU_IMAGE_DIR, \"/\", $yyy\n"\
+"              $yyy = $yyyy\n"\
+"            endif\n"\
+"            shell(\"test -d \'\", $yyy, \"\'\")\n"\
+"            if (!$DOSEMU_SHELL_RETURN)\n"\
+"              disk { directory $yyy $$zzz };\n"\
+"            else\n"\
+"              shell(\"test -f \'\", $yyy, \"\'\")\n"\
+"              if (!$DOSEMU_SHELL_RETURN)\n"\
+"                disk { image $yyy $$zzz };\n"\
+"              else\n"\
+"                abort \"hdimage \", $yyy, \" not found\"\n"\
+"              endif\n"\
+"            endif\n"\
+"          endif\n"\
+"        done\n"\
+"      endif endif endif\n"\
+"    done\n"\
+"  endif\n"\
+"\n"\
+"  ## setting up CDROM devices\n"\
+"  if (strlen($_cdrom))\n"\
+"    foreach $xxx ($LIST_DELIM, $_cdrom)\n"\
+"      cdrom { $xxx }\n"\
+"    done\n"\
+"  endif\n"\
+"\n"\
+"  ## setting up ASPI devices\n"\
+"  ifndef restricted\n"\
+"    if (strlen($_aspi))\n"\
+"      foreach $xxx ($LIST_DELIM, $_aspi)\n"\
+"        $zz = (1);\n"\
+"        $yy2 = \"\"; $yy3 = (-1);\n"\
+"        if(strlen($xxx))\n"\
+"         foreach $yyy (\":\", $xxx)\n"\
+"          $zzz = \"$yy\", $zz, \" = $yyy\";\n"\
+"          $zz = ($zz + 1);\n"\
+"          $$zzz\n"\
+"         done;\n"\
+"        endif;\n"\
+"        aspi { $yy1 devicetype $yy2 target $yy3 };\n"\
+"      done\n"\
+"    endif\n"\
+"  endif\n"\
+"\n"\
+"  ipxsupport $_ipxsupport\n"\
+"  ipx_network $_ipx_network\n"\
+"  novell_hack $_novell_hack\n"\
+"  if (1) # no idea why but we need this...\n"\
+"    foreach $xxx (\" \", \"1 2 3 4 5 6 7 8 9\")\n"\
+"      $zzz = \"$_lpt\", $xxx\n"\
+"      $zzz = $$zzz\n"\
+"      if ((strstr($zzz, \"direct\") != -1) && (strchr($zzz, \' \') != -1))\n"\
+"        $zzz = strdel($zzz, 0, strchr($zzz, \' \') + 1)\n"\
+"        printer { lpt $xxx file $zzz timeout $_printer_timeout }\n"\
+"      else if (strlen($zzz))\n"\
+"        $zzz = \"\'\", $zzz, \"\'\"\n"\
+"        printer { lpt $xxx command $$zzz timeout $_printer_timeout }\n"\
+"      endif\n"\
+"    done\n"\
+"  endif\n"\
+"\n"\
+"  if (strlen($_speaker))\n"\
+"    $xxx = \"speaker \", $_speaker;\n"\
+"    $$xxx\n"\
+"  else\n"\
+"    speaker off\n"\
+"  endif\n"\
+"  ifdef restricted\n"\
+"    ## /etc/dosemu.users defined \'restricted\' for this login\n"\
+"    define c_normal\n"\
+"    undef c_all\n"\
+"    if ($_vnet eq \"vde\" || !$_pktdriver)\n"\
+"      vdeswitch $_vdeswitch\n"\
+"      slirpargs $_slirpargs\n"\
+"      vnet $_vnet\n"\
+"      pktdriver $_pktdriver\n"\
+"    endif\n"\
+"    if ($_pci)\n"\
+"      pci auto\n"\
+"    endif\n"\
+"  else\n"\
+"    # here are the root requiring options\n"\
+"    if (strlen($_irqpassing))\n"\
+"      $yyy = \"irqpassing { \"\n"\
+"      if (strlen($_irqpassing))\n"\
+"        foreach $xxx (\" \", $_irqpassing)\n"\
+"          $yyy = $yyy, \"use_sigio \", $xxx\n"\
+"        done\n"\
+"      endif\n"\
+"      $yyy = $yyy, \" }\";\n"\
+"      $$yyy\n"\
+"    else\n"\
+"      irqpassing off\n"\
+"    endif\n"\
+"    if (strlen($_hardware_ram))\n"\
+"      hardware_ram { $$_hardware_ram }\n"\
+"    endif\n"\
+"    ethdev $_ethdev\n"\
+"    tapdev $_tapdev\n"\
+"    vdeswitch $_vdeswitch\n"\
+"    slirpargs $_slirpargs\n"\
+"    netsock $_netsock\n"\
+"    vnet $_vnet\n"\
+"    pktdriver $_pktdriver\n"\
+"    ne2k $_ne2k\n"\
+"    if (strlen($_ports)) ports { $$_ports } endif\n"\
+"    pci $_pci\n"\
+"  endif\n"\
+"\n"\
+"  if (strlen($_unix_exec))\n"\
+"    unix_exec $_unix_exec\n"\
+"  endif\n"\
+"  if (strlen($_lredir_paths))\n"\
+"    lredir_paths $_lredir_paths\n"\
+"  endif\n"\
+"  if (strlen($_hostfs_drives))\n"\
+"    hostfs_drives $_hostfs_drives\n"\
+"  endif\n"\
+"\n"\
+"  ## setting up the features list\n"\
+"  if ( (  ($DOSEMU_VERSION_CODE >= ((98 << 16) | (3 << 8) | 3))\n"\
+"             && ($DOSEMU_VERSION_CODE < (99 << 16)) )\n"\
+"       || ($DOSEMU_VERSION_CODE > ((99 << 16) | (5 << 8))) )\n"\
+"    if (strlen($_features))\n"\
+"      foreach $xxx ($LIST_DELIM, $_features)\n"\
+"        $yyy = strdel($xxx, strstr($xxx, \":\"), 999);\n"\
+"        $zzz = strsplit($xxx, strstr($xxx, \":\"), 999);\n"\
+"        if (strlen($zzz))\n"\
+"          $zzz = strsplit($zzz, 1, 999);\n"\
+"        else\n"\
+"          $zzz = (0);\n"\
+"        endif\n"\
+"        feature { $yyy = $zzz };\n"\
+"      done\n"\
+"    endif\n"\
+"  endif\n"\
+"\n"\
+"endif\n"\
+"#############################################################################\n"\
+;
@@ -416,6 +416,8 @@ void low_mem_init(void)
     /* unused hole for alignment */
     ptr2 += LOWMEM_SIZE + HMASIZE;
   }
+  if (config.hugepages)
+    mapping_hugepages(LOWMEM_SIZE + HMASIZE, memsize - (LOWMEM_SIZE + HMASIZE));
 
   /* LOWMEM_SIZE + HMASIZE == base */
   memcheck_addtype('X', "EXT MEM");
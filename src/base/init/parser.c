@@ -0,0 +1,7703 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 28 "parser.y"
+
+
+#define YYDEBUG 0
+
+#define PARSER_VERSION_STRING "parser_version_3"
+
+#include <stdlib.h>
+#include <termios.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <ctype.h>
+#include <string.h>
+#include <sys/stat.h>                    /* structure stat       */
+#include <unistd.h>                      /* prototype for stat() */
+#include <sys/wait.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <pwd.h>
+#include <syslog.h>
+#include <string.h>
+#include <errno.h>
+#include <assert.h>
+#ifdef __linux__
+#include <mntent.h>
+#endif
+
+#include "dosemu_config.h"
+#include "emu.h"
+#ifdef X86_EMULATOR
+#include "cpu-emu.h"
+#endif
+#include "disks.h"
+#include "port.h"
+#define allow_io	port_allow_io
+#include "mmio_tracing.h"
+#include "lpt.h"
+#include "video.h"
+#include "vc.h"
+#include "mouse.h"
+#include "serial.h"
+#include "timers.h"
+#include "keyboard/keymaps.h"
+#include "keyboard/keyb_server.h"
+#include "translate/dosemu_charset.h"
+#include "memory.h"
+#include "mapping.h"
+#include "utilities.h"
+#include "aspi.h"
+#include "int.h"
+#include "pktdrvr.h"
+#include "redirect.h"
+#include "iodev.h" /* for TM_BIOS / TM_PIT / TM_LINUX */
+
+#define USERVAR_PREF	"dosemu_"
+
+static serial_t *sptr;
+static serial_t nullser;
+static mouse_t *mptr = &config.mouse;
+static int c_ser = 0;
+
+static struct disk *dptr;
+static struct disk nulldisk;
+#define c_hdisks config.hdisks
+#define c_fdisks config.fdisks
+static int skipped_disks;
+
+static struct printer nullprt;
+static struct printer *pptr = &nullprt;
+static int c_printers = 0;
+
+static int ports_permission = IO_RDWR;
+static unsigned int ports_ormask = 0;
+static unsigned int ports_andmask = 0xFFFF;
+static unsigned int portspeed = 0;
+
+static int errors = 0;
+static int warnings = 0;
+
+static char *file_being_parsed;
+
+			/* this to ensure we are parsing a new style */
+static int parser_version_3_style_used = 0;
+#define CONFNAME_V3USED "version_3_style_used"
+
+	/* local procedures */
+
+static void start_ports(void);
+static void start_mouse(void);
+static void stop_mouse(void);
+static void start_debug(void);
+static void start_video(void);
+static void stop_video(void);
+static void set_vesamodes(int width, int height, int color_bits);
+static int detect_vbios_seg(void);
+static int detect_vbios_size(void);
+static void stop_ttylocks(void);
+static void start_serial(void);
+static void stop_serial(void);
+static void start_printer(void);
+static void stop_printer(void);
+static void start_keyboard(void);
+static void keytable_start(char *layout);
+static void keytable_stop(void);
+static void keyb_layout(char *layout);
+static void dump_keytables_to_file(char *name);
+static void stop_terminal(void);
+static void start_disk(void);
+static void do_part(char *);
+static void start_floppy(void);
+static void stop_disk(int token);
+static void start_vnet(char *);
+static FILE* open_file(const char* filename);
+static void close_file(FILE* file);
+static void set_irq_value(int bits, int i1);
+static void set_irq_range(int bits, int i1, int i2);
+static int undefine_config_variable(const char *name);
+static void check_user_var(char *name);
+static char *run_shell(char *command);
+static int for_each_handling(int loopid, char *varname, char *delim, char *list);
+static void handle_features(int which, int value);
+static void set_joy_device(char *devstring);
+static int parse_timemode(const char *);
+static void set_hdimage(struct disk *dptr, char *name);
+static void set_drive_c(void);
+static void set_default_drives(void);
+static void set_dosemu_drive(void);
+static void set_hostfs_drives(char *drivespec);
+
+#define TOF(x) ( x.type == TYPE_REAL ? x.value.r : x.value.i )
+#define V_VAL(x,y,z) \
+do { x.type = y.type; if (x.type == TYPE_REAL) x.value.r = (z); \
+      else x.value.i = (z); } \
+while (0)
+
+	/* variables in lexer.l */
+
+
+
+
+	/* for unicode keyboard plugin */
+static void keyb_mod(int wich, t_keysym keynum, int unicode);
+static void dump_keytable_part(FILE *f, t_keysym *map, int size);
+
+enum {
+	TYPE_NONE,
+	TYPE_INTEGER,
+	TYPE_BOOLEAN,
+	TYPE_REAL
+} _type;
+
+
+#line 224 "parser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_L_OFF = 4,                      /* L_OFF  */
+  YYSYMBOL_L_ON = 5,                       /* L_ON  */
+  YYSYMBOL_L_AUTO = 6,                     /* L_AUTO  */
+  YYSYMBOL_L_YES = 7,                      /* L_YES  */
+  YYSYMBOL_L_NO = 8,                       /* L_NO  */
+  YYSYMBOL_CHIPSET_TYPE = 9,               /* CHIPSET_TYPE  */
+  YYSYMBOL_REAL = 10,                      /* REAL  */
+  YYSYMBOL_STRING = 11,                    /* STRING  */
+  YYSYMBOL_VARIABLE = 12,                  /* VARIABLE  */
+  YYSYMBOL_EXPRTEST = 13,                  /* EXPRTEST  */
+  YYSYMBOL_INTCAST = 14,                   /* INTCAST  */
+  YYSYMBOL_REALCAST = 15,                  /* REALCAST  */
+  YYSYMBOL_AND_OP = 16,                    /* AND_OP  */
+  YYSYMBOL_OR_OP = 17,                     /* OR_OP  */
+  YYSYMBOL_XOR_OP = 18,                    /* XOR_OP  */
+  YYSYMBOL_SHR_OP = 19,                    /* SHR_OP  */
+  YYSYMBOL_SHL_OP = 20,                    /* SHL_OP  */
+  YYSYMBOL_NOT_OP = 21,                    /* NOT_OP  */
+  YYSYMBOL_EQ_OP = 22,                     /* EQ_OP  */
+  YYSYMBOL_GE_OP = 23,                     /* GE_OP  */
+  YYSYMBOL_LE_OP = 24,                     /* LE_OP  */
+  YYSYMBOL_25_ = 25,                       /* '='  */
+  YYSYMBOL_26_ = 26,                       /* '<'  */
+  YYSYMBOL_27_ = 27,                       /* '>'  */
+  YYSYMBOL_NEQ_OP = 28,                    /* NEQ_OP  */
+  YYSYMBOL_STR_EQ_OP = 29,                 /* STR_EQ_OP  */
+  YYSYMBOL_STR_NEQ_OP = 30,                /* STR_NEQ_OP  */
+  YYSYMBOL_L_AND_OP = 31,                  /* L_AND_OP  */
+  YYSYMBOL_L_OR_OP = 32,                   /* L_OR_OP  */
+  YYSYMBOL_33_ = 33,                       /* '+'  */
+  YYSYMBOL_34_ = 34,                       /* '-'  */
+  YYSYMBOL_35_ = 35,                       /* '*'  */
+  YYSYMBOL_36_ = 36,                       /* '/'  */
+  YYSYMBOL_UMINUS = 37,                    /* UMINUS  */
+  YYSYMBOL_UPLUS = 38,                     /* UPLUS  */
+  YYSYMBOL_BIT_NOT_OP = 39,                /* BIT_NOT_OP  */
+  YYSYMBOL_STRLEN = 40,                    /* STRLEN  */
+  YYSYMBOL_STRTOL = 41,                    /* STRTOL  */
+  YYSYMBOL_STRNCMP = 42,                   /* STRNCMP  */
+  YYSYMBOL_STRCAT = 43,                    /* STRCAT  */
+  YYSYMBOL_STRPBRK = 44,                   /* STRPBRK  */
+  YYSYMBOL_STRSPLIT = 45,                  /* STRSPLIT  */
+  YYSYMBOL_STRCHR = 46,                    /* STRCHR  */
+  YYSYMBOL_STRRCHR = 47,                   /* STRRCHR  */
+  YYSYMBOL_STRSTR = 48,                    /* STRSTR  */
+  YYSYMBOL_STRDEL = 49,                    /* STRDEL  */
+  YYSYMBOL_STRSPN = 50,                    /* STRSPN  */
+  YYSYMBOL_STRCSPN = 51,                   /* STRCSPN  */
+  YYSYMBOL_SHELL = 52,                     /* SHELL  */
+  YYSYMBOL_DEFINED = 53,                   /* DEFINED  */
+  YYSYMBOL_DEFINE = 54,                    /* DEFINE  */
+  YYSYMBOL_UNDEF = 55,                     /* UNDEF  */
+  YYSYMBOL_IFSTATEMENT = 56,               /* IFSTATEMENT  */
+  YYSYMBOL_WHILESTATEMENT = 57,            /* WHILESTATEMENT  */
+  YYSYMBOL_FOREACHSTATEMENT = 58,          /* FOREACHSTATEMENT  */
+  YYSYMBOL_CHECKUSERVAR = 59,              /* CHECKUSERVAR  */
+  YYSYMBOL_TICKLESS_IDLE = 60,             /* TICKLESS_IDLE  */
+  YYSYMBOL_FASTFLOPPY = 61,                /* FASTFLOPPY  */
+  YYSYMBOL_HOGTHRESH = 62,                 /* HOGTHRESH  */
+  YYSYMBOL_SPEAKER = 63,                   /* SPEAKER  */
+  YYSYMBOL_IPXSUPPORT = 64,                /* IPXSUPPORT  */
+  YYSYMBOL_IPXNETWORK = 65,                /* IPXNETWORK  */
+  YYSYMBOL_NOVELLHACK = 66,                /* NOVELLHACK  */
+  YYSYMBOL_ETHDEV = 67,                    /* ETHDEV  */
+  YYSYMBOL_ETHRING = 68,                   /* ETHRING  */
+  YYSYMBOL_TAPDEV = 69,                    /* TAPDEV  */
+  YYSYMBOL_VDESWITCH = 70,                 /* VDESWITCH  */
+  YYSYMBOL_SLIRPARGS = 71,                 /* SLIRPARGS  */
+  YYSYMBOL_NETSOCK = 72,                   /* NETSOCK  */
+  YYSYMBOL_VNET = 73,                      /* VNET  */
+  YYSYMBOL_DEBUG = 74,                     /* DEBUG  */
+  YYSYMBOL_MOUSE = 75,                     /* MOUSE  */
+  YYSYMBOL_SERIAL = 76,                    /* SERIAL  */
+  YYSYMBOL_COM = 77,                       /* COM  */
+  YYSYMBOL_KEYBOARD = 78,                  /* KEYBOARD  */
+  YYSYMBOL_TERMINAL = 79,                  /* TERMINAL  */
+  YYSYMBOL_VIDEO = 80,                     /* VIDEO  */
+  YYSYMBOL_EMURETRACE = 81,                /* EMURETRACE  */
+  YYSYMBOL_TIMER = 82,                     /* TIMER  */
+  YYSYMBOL_MATHCO = 83,                    /* MATHCO  */
+  YYSYMBOL_CPU = 84,                       /* CPU  */
+  YYSYMBOL_CPUSPEED = 85,                  /* CPUSPEED  */
+  YYSYMBOL_BOOTDRIVE = 86,                 /* BOOTDRIVE  */
+  YYSYMBOL_SWAP_BOOTDRIVE = 87,            /* SWAP_BOOTDRIVE  */
+  YYSYMBOL_DISK_URING = 88,                /* DISK_URING  */
+  YYSYMBOL_DISK_CACHE = 89,                /* DISK_CACHE  */
+  YYSYMBOL_DISK_CACHE_WB = 90,             /* DISK_CACHE_WB  */
+  YYSYMBOL_FATFS_WRITE = 91,               /* FATFS_WRITE  */
+  YYSYMBOL_L_XMS = 92,                     /* L_XMS  */
+  YYSYMBOL_L_DPMI = 93,                    /* L_DPMI  */
+  YYSYMBOL_DPMI_BASE = 94,                 /* DPMI_BASE  */
+  YYSYMBOL_HUGEPAGES = 95,                 /* HUGEPAGES  */
+  YYSYMBOL_PM_DOS_API = 96,                /* PM_DOS_API  */
+  YYSYMBOL_NO_NULL_CHECKS = 97,            /* NO_NULL_CHECKS  */
+  YYSYMBOL_PORTS = 98,                     /* PORTS  */
+  YYSYMBOL_DISK = 99,                      /* DISK  */
+  YYSYMBOL_DOSMEM = 100,                   /* DOSMEM  */
+  YYSYMBOL_EXT_MEM = 101,                  /* EXT_MEM  */
+  YYSYMBOL_L_EMS = 102,                    /* L_EMS  */
+  YYSYMBOL_UMB_A0 = 103,                   /* UMB_A0  */
+  YYSYMBOL_UMB_B0 = 104,                   /* UMB_B0  */
+  YYSYMBOL_UMB_F0 = 105,                   /* UMB_F0  */
+  YYSYMBOL_HMA = 106,                      /* HMA  */
+  YYSYMBOL_DOS_UP = 107,                   /* DOS_UP  */
+  YYSYMBOL_EMS_SIZE = 108,                 /* EMS_SIZE  */
+  YYSYMBOL_EMS_FRAME = 109,                /* EMS_FRAME  */
+  YYSYMBOL_EMS_UMA_PAGES = 110,            /* EMS_UMA_PAGES  */
+  YYSYMBOL_EMS_CONV_PAGES = 111,           /* EMS_CONV_PAGES  */
+  YYSYMBOL_TTYLOCKS = 112,                 /* TTYLOCKS  */
+  YYSYMBOL_L_SOUND = 113,                  /* L_SOUND  */
+  YYSYMBOL_L_SND_OSS = 114,                /* L_SND_OSS  */
+  YYSYMBOL_L_JOYSTICK = 115,               /* L_JOYSTICK  */
+  YYSYMBOL_FILE_LOCK_LIMIT = 116,          /* FILE_LOCK_LIMIT  */
+  YYSYMBOL_FILE_OPEN_LIMIT = 117,          /* FILE_OPEN_LIMIT  */
+  YYSYMBOL_ABORT = 118,                    /* ABORT  */
+  YYSYMBOL_WARN = 119,                     /* WARN  */
+  YYSYMBOL_ERROR = 120,                    /* ERROR  */
+  YYSYMBOL_L_FLOPPY = 121,                 /* L_FLOPPY  */
+  YYSYMBOL_EMUSYS = 122,                   /* EMUSYS  */
+  YYSYMBOL_L_X = 123,                      /* L_X  */
+  YYSYMBOL_L_SDL = 124,                    /* L_SDL  */
+  YYSYMBOL_DOSEMUMAP = 125,                /* DOSEMUMAP  */
+  YYSYMBOL_LOGBUFSIZE = 126,               /* LOGBUFSIZE  */
+  YYSYMBOL_LOGFILESIZE = 127,              /* LOGFILESIZE  */
+  YYSYMBOL_MAPPINGDRIVER = 128,            /* MAPPINGDRIVER  */
+  YYSYMBOL_LFN_SUPPORT = 129,              /* LFN_SUPPORT  */
+  YYSYMBOL_FFS_REDIR = 130,                /* FFS_REDIR  */
+  YYSYMBOL_SET_INT_HOOKS = 131,            /* SET_INT_HOOKS  */
+  YYSYMBOL_TRACE_IRETS = 132,              /* TRACE_IRETS  */
+  YYSYMBOL_FINT_REVECT = 133,              /* FINT_REVECT  */
+  YYSYMBOL_EMULATED = 134,                 /* EMULATED  */
+  YYSYMBOL_NATIVE = 135,                   /* NATIVE  */
+  YYSYMBOL_CPUEMU = 136,                   /* CPUEMU  */
+  YYSYMBOL_CPU_VM = 137,                   /* CPU_VM  */
+  YYSYMBOL_CPU_VM_DPMI = 138,              /* CPU_VM_DPMI  */
+  YYSYMBOL_VM86 = 139,                     /* VM86  */
+  YYSYMBOL_KVM = 140,                      /* KVM  */
+  YYSYMBOL_RAWKEYBOARD = 141,              /* RAWKEYBOARD  */
+  YYSYMBOL_PRESTROKE = 142,                /* PRESTROKE  */
+  YYSYMBOL_KEYTABLE = 143,                 /* KEYTABLE  */
+  YYSYMBOL_SHIFT_MAP = 144,                /* SHIFT_MAP  */
+  YYSYMBOL_ALT_MAP = 145,                  /* ALT_MAP  */
+  YYSYMBOL_NUMPAD_MAP = 146,               /* NUMPAD_MAP  */
+  YYSYMBOL_DUMP = 147,                     /* DUMP  */
+  YYSYMBOL_LAYOUT = 148,                   /* LAYOUT  */
+  YYSYMBOL_DGRAVE = 149,                   /* DGRAVE  */
+  YYSYMBOL_DACUTE = 150,                   /* DACUTE  */
+  YYSYMBOL_DCIRCUM = 151,                  /* DCIRCUM  */
+  YYSYMBOL_DTILDE = 152,                   /* DTILDE  */
+  YYSYMBOL_DBREVE = 153,                   /* DBREVE  */
+  YYSYMBOL_DABOVED = 154,                  /* DABOVED  */
+  YYSYMBOL_DDIARES = 155,                  /* DDIARES  */
+  YYSYMBOL_DABOVER = 156,                  /* DABOVER  */
+  YYSYMBOL_DDACUTE = 157,                  /* DDACUTE  */
+  YYSYMBOL_DCEDILLA = 158,                 /* DCEDILLA  */
+  YYSYMBOL_DIOTA = 159,                    /* DIOTA  */
+  YYSYMBOL_DOGONEK = 160,                  /* DOGONEK  */
+  YYSYMBOL_DCARON = 161,                   /* DCARON  */
+  YYSYMBOL_NETWORK = 162,                  /* NETWORK  */
+  YYSYMBOL_PKTDRIVER = 163,                /* PKTDRIVER  */
+  YYSYMBOL_NE2K = 164,                     /* NE2K  */
+  YYSYMBOL_DIRECTORY = 165,                /* DIRECTORY  */
+  YYSYMBOL_NAMESTUB = 166,                 /* NAMESTUB  */
+  YYSYMBOL_BINARY = 167,                   /* BINARY  */
+  YYSYMBOL_BASE = 168,                     /* BASE  */
+  YYSYMBOL_IRQ = 169,                      /* IRQ  */
+  YYSYMBOL_DEVICE = 170,                   /* DEVICE  */
+  YYSYMBOL_CHARSET = 171,                  /* CHARSET  */
+  YYSYMBOL_BAUDRATE = 172,                 /* BAUDRATE  */
+  YYSYMBOL_VIRTUAL = 173,                  /* VIRTUAL  */
+  YYSYMBOL_VMODEM = 174,                   /* VMODEM  */
+  YYSYMBOL_PSEUDO = 175,                   /* PSEUDO  */
+  YYSYMBOL_RTSCTS = 176,                   /* RTSCTS  */
+  YYSYMBOL_LOWLAT = 177,                   /* LOWLAT  */
+  YYSYMBOL_PCCOM = 178,                    /* PCCOM  */
+  YYSYMBOL_EXEC = 179,                     /* EXEC  */
+  YYSYMBOL_WRFILE = 180,                   /* WRFILE  */
+  YYSYMBOL_NULLMM = 181,                   /* NULLMM  */
+  YYSYMBOL_MICROSOFT = 182,                /* MICROSOFT  */
+  YYSYMBOL_MS3BUTTON = 183,                /* MS3BUTTON  */
+  YYSYMBOL_LOGITECH = 184,                 /* LOGITECH  */
+  YYSYMBOL_MMSERIES = 185,                 /* MMSERIES  */
+  YYSYMBOL_MOUSEMAN = 186,                 /* MOUSEMAN  */
+  YYSYMBOL_HITACHI = 187,                  /* HITACHI  */
+  YYSYMBOL_MOUSESYSTEMS = 188,             /* MOUSESYSTEMS  */
+  YYSYMBOL_BUSMOUSE = 189,                 /* BUSMOUSE  */
+  YYSYMBOL_PS2 = 190,                      /* PS2  */
+  YYSYMBOL_IMPS2 = 191,                    /* IMPS2  */
+  YYSYMBOL_INTERNALDRIVER = 192,           /* INTERNALDRIVER  */
+  YYSYMBOL_EMULATE3BUTTONS = 193,          /* EMULATE3BUTTONS  */
+  YYSYMBOL_CLEARDTR = 194,                 /* CLEARDTR  */
+  YYSYMBOL_UNGRAB_TWEAK = 195,             /* UNGRAB_TWEAK  */
+  YYSYMBOL_L_DISPLAY = 196,                /* L_DISPLAY  */
+  YYSYMBOL_L_TITLE = 197,                  /* L_TITLE  */
+  YYSYMBOL_X_TITLE_SHOW_APPNAME = 198,     /* X_TITLE_SHOW_APPNAME  */
+  YYSYMBOL_ICON_NAME = 199,                /* ICON_NAME  */
+  YYSYMBOL_X_BLINKRATE = 200,              /* X_BLINKRATE  */
+  YYSYMBOL_X_SHARECMAP = 201,              /* X_SHARECMAP  */
+  YYSYMBOL_X_MITSHM = 202,                 /* X_MITSHM  */
+  YYSYMBOL_X_FONT = 203,                   /* X_FONT  */
+  YYSYMBOL_X_FIXED_ASPECT = 204,           /* X_FIXED_ASPECT  */
+  YYSYMBOL_X_ASPECT_43 = 205,              /* X_ASPECT_43  */
+  YYSYMBOL_X_LIN_FILT = 206,               /* X_LIN_FILT  */
+  YYSYMBOL_X_BILIN_FILT = 207,             /* X_BILIN_FILT  */
+  YYSYMBOL_X_MODE13FACT = 208,             /* X_MODE13FACT  */
+  YYSYMBOL_X_WINSIZE = 209,                /* X_WINSIZE  */
+  YYSYMBOL_X_NOCLOSE = 210,                /* X_NOCLOSE  */
+  YYSYMBOL_X_NORESIZE = 211,               /* X_NORESIZE  */
+  YYSYMBOL_X_GAMMA = 212,                  /* X_GAMMA  */
+  YYSYMBOL_X_FULLSCREEN = 213,             /* X_FULLSCREEN  */
+  YYSYMBOL_VGAEMU_MEMSIZE = 214,           /* VGAEMU_MEMSIZE  */
+  YYSYMBOL_VESAMODE = 215,                 /* VESAMODE  */
+  YYSYMBOL_X_LFB = 216,                    /* X_LFB  */
+  YYSYMBOL_X_PM_INTERFACE = 217,           /* X_PM_INTERFACE  */
+  YYSYMBOL_X_MGRAB_KEY = 218,              /* X_MGRAB_KEY  */
+  YYSYMBOL_X_BACKGROUND_PAUSE = 219,       /* X_BACKGROUND_PAUSE  */
+  YYSYMBOL_SDL_HWREND = 220,               /* SDL_HWREND  */
+  YYSYMBOL_SDL_FONTS = 221,                /* SDL_FONTS  */
+  YYSYMBOL_SDL_WCONTROLS = 222,            /* SDL_WCONTROLS  */
+  YYSYMBOL_SDL_CLIP_NATIVE = 223,          /* SDL_CLIP_NATIVE  */
+  YYSYMBOL_VGA = 224,                      /* VGA  */
+  YYSYMBOL_MGA = 225,                      /* MGA  */
+  YYSYMBOL_CGA = 226,                      /* CGA  */
+  YYSYMBOL_EGA = 227,                      /* EGA  */
+  YYSYMBOL_NONE = 228,                     /* NONE  */
+  YYSYMBOL_CONSOLE = 229,                  /* CONSOLE  */
+  YYSYMBOL_GRAPHICS = 230,                 /* GRAPHICS  */
+  YYSYMBOL_CHIPSET = 231,                  /* CHIPSET  */
+  YYSYMBOL_FULLREST = 232,                 /* FULLREST  */
+  YYSYMBOL_PARTREST = 233,                 /* PARTREST  */
+  YYSYMBOL_MEMSIZE = 234,                  /* MEMSIZE  */
+  YYSYMBOL_VBIOS_SIZE_TOK = 235,           /* VBIOS_SIZE_TOK  */
+  YYSYMBOL_VBIOS_SEG = 236,                /* VBIOS_SEG  */
+  YYSYMBOL_VGAEMUBIOS_FILE = 237,          /* VGAEMUBIOS_FILE  */
+  YYSYMBOL_VBIOS_FILE = 238,               /* VBIOS_FILE  */
+  YYSYMBOL_VBIOS_COPY = 239,               /* VBIOS_COPY  */
+  YYSYMBOL_VBIOS_MMAP = 240,               /* VBIOS_MMAP  */
+  YYSYMBOL_DUALMON = 241,                  /* DUALMON  */
+  YYSYMBOL_VBIOS_POST = 242,               /* VBIOS_POST  */
+  YYSYMBOL_VGA_FONTS = 243,                /* VGA_FONTS  */
+  YYSYMBOL_FORCE_VT_SWITCH = 244,          /* FORCE_VT_SWITCH  */
+  YYSYMBOL_PCI = 245,                      /* PCI  */
+  YYSYMBOL_COLOR = 246,                    /* COLOR  */
+  YYSYMBOL_ESCCHAR = 247,                  /* ESCCHAR  */
+  YYSYMBOL_XTERM_TITLE = 248,              /* XTERM_TITLE  */
+  YYSYMBOL_SIZE = 249,                     /* SIZE  */
+  YYSYMBOL_IO = 250,                       /* IO  */
+  YYSYMBOL_PORT = 251,                     /* PORT  */
+  YYSYMBOL_CONFIG = 252,                   /* CONFIG  */
+  YYSYMBOL_READ = 253,                     /* READ  */
+  YYSYMBOL_WRITE = 254,                    /* WRITE  */
+  YYSYMBOL_KEYB = 255,                     /* KEYB  */
+  YYSYMBOL_PRINTER = 256,                  /* PRINTER  */
+  YYSYMBOL_WARNING = 257,                  /* WARNING  */
+  YYSYMBOL_GENERAL = 258,                  /* GENERAL  */
+  YYSYMBOL_HARDWARE = 259,                 /* HARDWARE  */
+  YYSYMBOL_L_IPC = 260,                    /* L_IPC  */
+  YYSYMBOL_SOUND = 261,                    /* SOUND  */
+  YYSYMBOL_TRACE = 262,                    /* TRACE  */
+  YYSYMBOL_CLEAR = 263,                    /* CLEAR  */
+  YYSYMBOL_TRACE_MMIO = 264,               /* TRACE_MMIO  */
+  YYSYMBOL_UEXEC = 265,                    /* UEXEC  */
+  YYSYMBOL_LPATHS = 266,                   /* LPATHS  */
+  YYSYMBOL_HDRIVES = 267,                  /* HDRIVES  */
+  YYSYMBOL_LPT = 268,                      /* LPT  */
+  YYSYMBOL_COMMAND = 269,                  /* COMMAND  */
+  YYSYMBOL_TIMEOUT = 270,                  /* TIMEOUT  */
+  YYSYMBOL_L_FILE = 271,                   /* L_FILE  */
+  YYSYMBOL_L_PARTITION = 272,              /* L_PARTITION  */
+  YYSYMBOL_WHOLEDISK = 273,                /* WHOLEDISK  */
+  YYSYMBOL_SECTORS = 274,                  /* SECTORS  */
+  YYSYMBOL_CYLINDERS = 275,                /* CYLINDERS  */
+  YYSYMBOL_TRACKS = 276,                   /* TRACKS  */
+  YYSYMBOL_HEADS = 277,                    /* HEADS  */
+  YYSYMBOL_OFFSET = 278,                   /* OFFSET  */
+  YYSYMBOL_HDIMAGE = 279,                  /* HDIMAGE  */
+  YYSYMBOL_HDTYPE1 = 280,                  /* HDTYPE1  */
+  YYSYMBOL_HDTYPE2 = 281,                  /* HDTYPE2  */
+  YYSYMBOL_HDTYPE9 = 282,                  /* HDTYPE9  */
+  YYSYMBOL_DISKCYL4096 = 283,              /* DISKCYL4096  */
+  YYSYMBOL_OVERLAY = 284,                  /* OVERLAY  */
+  YYSYMBOL_OVERLAY_COMMIT = 285,           /* OVERLAY_COMMIT  */
+  YYSYMBOL_OVERLAY_DISCARD = 286,          /* OVERLAY_DISCARD  */
+  YYSYMBOL_THREEINCH = 287,                /* THREEINCH  */
+  YYSYMBOL_THREEINCH_720 = 288,            /* THREEINCH_720  */
+  YYSYMBOL_THREEINCH_2880 = 289,           /* THREEINCH_2880  */
+  YYSYMBOL_FIVEINCH = 290,                 /* FIVEINCH  */
+  YYSYMBOL_FIVEINCH_360 = 291,             /* FIVEINCH_360  */
+  YYSYMBOL_READONLY = 292,                 /* READONLY  */
+  YYSYMBOL_BOOT = 293,                     /* BOOT  */
+  YYSYMBOL_DEFAULT_DRIVES = 294,           /* DEFAULT_DRIVES  */
+  YYSYMBOL_SKIP_DRIVES = 295,              /* SKIP_DRIVES  */
+  YYSYMBOL_RDONLY = 296,                   /* RDONLY  */
+  YYSYMBOL_WRONLY = 297,                   /* WRONLY  */
+  YYSYMBOL_RDWR = 298,                     /* RDWR  */
+  YYSYMBOL_ORMASK = 299,                   /* ORMASK  */
+  YYSYMBOL_ANDMASK = 300,                  /* ANDMASK  */
+  YYSYMBOL_RANGE = 301,                    /* RANGE  */
+  YYSYMBOL_FAST = 302,                     /* FAST  */
+  YYSYMBOL_SLOW = 303,                     /* SLOW  */
+  YYSYMBOL_SILLYINT = 304,                 /* SILLYINT  */
+  YYSYMBOL_USE_SIGIO = 305,                /* USE_SIGIO  */
+  YYSYMBOL_HARDWARE_RAM = 306,             /* HARDWARE_RAM  */
+  YYSYMBOL_SB_BASE = 307,                  /* SB_BASE  */
+  YYSYMBOL_SB_IRQ = 308,                   /* SB_IRQ  */
+  YYSYMBOL_SB_DMA = 309,                   /* SB_DMA  */
+  YYSYMBOL_SB_HDMA = 310,                  /* SB_HDMA  */
+  YYSYMBOL_MPU_BASE = 311,                 /* MPU_BASE  */
+  YYSYMBOL_MPU_BASE_MT32 = 312,            /* MPU_BASE_MT32  */
+  YYSYMBOL_MPU_IRQ = 313,                  /* MPU_IRQ  */
+  YYSYMBOL_MPU_IRQ_MT32 = 314,             /* MPU_IRQ_MT32  */
+  YYSYMBOL_MIDI_SYNTH = 315,               /* MIDI_SYNTH  */
+  YYSYMBOL_SOUND_DRIVER = 316,             /* SOUND_DRIVER  */
+  YYSYMBOL_MIDI_DRIVER = 317,              /* MIDI_DRIVER  */
+  YYSYMBOL_FLUID_SFONT = 318,              /* FLUID_SFONT  */
+  YYSYMBOL_FLUID_VOLUME = 319,             /* FLUID_VOLUME  */
+  YYSYMBOL_MUNT_ROMS = 320,                /* MUNT_ROMS  */
+  YYSYMBOL_OPL2LPT_DEV = 321,              /* OPL2LPT_DEV  */
+  YYSYMBOL_OPL2LPT_TYPE = 322,             /* OPL2LPT_TYPE  */
+  YYSYMBOL_SND_PLUGIN_PARAMS = 323,        /* SND_PLUGIN_PARAMS  */
+  YYSYMBOL_PCM_HPF = 324,                  /* PCM_HPF  */
+  YYSYMBOL_MIDI_FILE = 325,                /* MIDI_FILE  */
+  YYSYMBOL_WAV_FILE = 326,                 /* WAV_FILE  */
+  YYSYMBOL_SOUND_VTIME = 327,              /* SOUND_VTIME  */
+  YYSYMBOL_CDROM = 328,                    /* CDROM  */
+  YYSYMBOL_ASPI = 329,                     /* ASPI  */
+  YYSYMBOL_DEVICETYPE = 330,               /* DEVICETYPE  */
+  YYSYMBOL_TARGET = 331,                   /* TARGET  */
+  YYSYMBOL_FEATURE = 332,                  /* FEATURE  */
+  YYSYMBOL_JOYSTICK = 333,                 /* JOYSTICK  */
+  YYSYMBOL_JOY_DEVICE = 334,               /* JOY_DEVICE  */
+  YYSYMBOL_JOY_DOS_MIN = 335,              /* JOY_DOS_MIN  */
+  YYSYMBOL_JOY_DOS_MAX = 336,              /* JOY_DOS_MAX  */
+  YYSYMBOL_JOY_GRANULARITY = 337,          /* JOY_GRANULARITY  */
+  YYSYMBOL_JOY_LATENCY = 338,              /* JOY_LATENCY  */
+  YYSYMBOL_CLI_TIMEOUT = 339,              /* CLI_TIMEOUT  */
+  YYSYMBOL_TIMEMODE = 340,                 /* TIMEMODE  */
+  YYSYMBOL_TIMER_TWEAKS = 341,             /* TIMER_TWEAKS  */
+  YYSYMBOL_UNICODE = 342,                  /* UNICODE  */
+  YYSYMBOL_SHIFT_ALT_MAP = 343,            /* SHIFT_ALT_MAP  */
+  YYSYMBOL_CTRL_MAP = 344,                 /* CTRL_MAP  */
+  YYSYMBOL_CTRL_ALT_MAP = 345,             /* CTRL_ALT_MAP  */
+  YYSYMBOL_INTERNAL = 346,                 /* INTERNAL  */
+  YYSYMBOL_EXTERNAL = 347,                 /* EXTERNAL  */
+  YYSYMBOL_348_ = 348,                     /* ';'  */
+  YYSYMBOL_349_ = 349,                     /* '{'  */
+  YYSYMBOL_350_ = 350,                     /* '}'  */
+  YYSYMBOL_351_ = 351,                     /* '('  */
+  YYSYMBOL_352_ = 352,                     /* ')'  */
+  YYSYMBOL_353_ = 353,                     /* ','  */
+  YYSYMBOL_YYACCEPT = 354,                 /* $accept  */
+  YYSYMBOL_lines = 355,                    /* lines  */
+  YYSYMBOL_optdelim = 356,                 /* optdelim  */
+  YYSYMBOL_line = 357,                     /* line  */
+  YYSYMBOL_358_1 = 358,                    /* $@1  */
+  YYSYMBOL_359_2 = 359,                    /* $@2  */
+  YYSYMBOL_360_3 = 360,                    /* $@3  */
+  YYSYMBOL_361_4 = 361,                    /* $@4  */
+  YYSYMBOL_362_5 = 362,                    /* $@5  */
+  YYSYMBOL_363_6 = 363,                    /* $@6  */
+  YYSYMBOL_364_7 = 364,                    /* $@7  */
+  YYSYMBOL_365_8 = 365,                    /* $@8  */
+  YYSYMBOL_366_9 = 366,                    /* $@9  */
+  YYSYMBOL_367_10 = 367,                   /* $@10  */
+  YYSYMBOL_368_11 = 368,                   /* $@11  */
+  YYSYMBOL_369_12 = 369,                   /* $@12  */
+  YYSYMBOL_expression = 370,               /* expression  */
+  YYSYMBOL_real_expression = 371,          /* real_expression  */
+  YYSYMBOL_typed_expr = 372,               /* typed_expr  */
+  YYSYMBOL_int_expr = 373,                 /* int_expr  */
+  YYSYMBOL_bool_expr = 374,                /* bool_expr  */
+  YYSYMBOL_real_expr = 375,                /* real_expr  */
+  YYSYMBOL_variable_content = 376,         /* variable_content  */
+  YYSYMBOL_string_unquoted = 377,          /* string_unquoted  */
+  YYSYMBOL_string_expr = 378,              /* string_expr  */
+  YYSYMBOL_strarglist = 379,               /* strarglist  */
+  YYSYMBOL_strarglist_item = 380,          /* strarglist_item  */
+  YYSYMBOL_check_user_var_list = 381,      /* check_user_var_list  */
+  YYSYMBOL_x_flags = 382,                  /* x_flags  */
+  YYSYMBOL_x_flag = 383,                   /* x_flag  */
+  YYSYMBOL_sdl_flags = 384,                /* sdl_flags  */
+  YYSYMBOL_sdl_flag = 385,                 /* sdl_flag  */
+  YYSYMBOL_sound_flags = 386,              /* sound_flags  */
+  YYSYMBOL_sound_flag = 387,               /* sound_flag  */
+  YYSYMBOL_joystick_flags = 388,           /* joystick_flags  */
+  YYSYMBOL_joystick_flag = 389,            /* joystick_flag  */
+  YYSYMBOL_video_flags = 390,              /* video_flags  */
+  YYSYMBOL_video_flag = 391,               /* video_flag  */
+  YYSYMBOL_term_flags = 392,               /* term_flags  */
+  YYSYMBOL_term_flag = 393,                /* term_flag  */
+  YYSYMBOL_debug_flags = 394,              /* debug_flags  */
+  YYSYMBOL_debug_flag = 395,               /* debug_flag  */
+  YYSYMBOL_mouse_flags = 396,              /* mouse_flags  */
+  YYSYMBOL_mouse_flag = 397,               /* mouse_flag  */
+  YYSYMBOL_keyboard_flags = 398,           /* keyboard_flags  */
+  YYSYMBOL_keyboard_flag = 399,            /* keyboard_flag  */
+  YYSYMBOL_keyboard_mods = 400,            /* keyboard_mods  */
+  YYSYMBOL_keyboard_mod = 401,             /* keyboard_mod  */
+  YYSYMBOL_402_13 = 402,                   /* $@13  */
+  YYSYMBOL_403_14 = 403,                   /* $@14  */
+  YYSYMBOL_404_15 = 404,                   /* $@15  */
+  YYSYMBOL_405_16 = 405,                   /* $@16  */
+  YYSYMBOL_406_17 = 406,                   /* $@17  */
+  YYSYMBOL_407_18 = 407,                   /* $@18  */
+  YYSYMBOL_408_19 = 408,                   /* $@19  */
+  YYSYMBOL_keyboard_modvals = 409,         /* keyboard_modvals  */
+  YYSYMBOL_keyboard_modval = 410,          /* keyboard_modval  */
+  YYSYMBOL_ttylocks_flags = 411,           /* ttylocks_flags  */
+  YYSYMBOL_ttylocks_flag = 412,            /* ttylocks_flag  */
+  YYSYMBOL_serial_flags = 413,             /* serial_flags  */
+  YYSYMBOL_serial_flag = 414,              /* serial_flag  */
+  YYSYMBOL_printer_flags = 415,            /* printer_flags  */
+  YYSYMBOL_printer_flag = 416,             /* printer_flag  */
+  YYSYMBOL_floppy_flags = 417,             /* floppy_flags  */
+  YYSYMBOL_floppy_flag = 418,              /* floppy_flag  */
+  YYSYMBOL_disk_flags = 419,               /* disk_flags  */
+  YYSYMBOL_disk_flag = 420,                /* disk_flag  */
+  YYSYMBOL_disk_type = 421,                /* disk_type  */
+  YYSYMBOL_port_flags = 422,               /* port_flags  */
+  YYSYMBOL_port_flag = 423,                /* port_flag  */
+  YYSYMBOL_trace_port_flags = 424,         /* trace_port_flags  */
+  YYSYMBOL_trace_port_flag = 425,          /* trace_port_flag  */
+  YYSYMBOL_trace_mmio_flags = 426,         /* trace_mmio_flags  */
+  YYSYMBOL_trace_mmio_flag = 427,          /* trace_mmio_flag  */
+  YYSYMBOL_sillyint_flags = 428,           /* sillyint_flags  */
+  YYSYMBOL_sillyint_flag = 429,            /* sillyint_flag  */
+  YYSYMBOL_ems_flags = 430,                /* ems_flags  */
+  YYSYMBOL_ems_flag = 431,                 /* ems_flag  */
+  YYSYMBOL_hardware_ram_flags = 432,       /* hardware_ram_flags  */
+  YYSYMBOL_hardware_ram_flag = 433,        /* hardware_ram_flag  */
+  YYSYMBOL_bool = 434,                     /* bool  */
+  YYSYMBOL_floppy_bool = 435,              /* floppy_bool  */
+  YYSYMBOL_int_bool = 436,                 /* int_bool  */
+  YYSYMBOL_irq_bool = 437,                 /* irq_bool  */
+  YYSYMBOL_speaker = 438,                  /* speaker  */
+  YYSYMBOL_cpu_vm = 439,                   /* cpu_vm  */
+  YYSYMBOL_cpu_vm_dpmi = 440,              /* cpu_vm_dpmi  */
+  YYSYMBOL_charset_flags = 441,            /* charset_flags  */
+  YYSYMBOL_charset_flag = 442              /* charset_flag  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+/* Second part of user prologue.  */
+#line 198 "parser.y"
+
+#include "lexer.h"
+
+#line 704 "parser.c"
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  2
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   3103
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  354
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  89
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  548
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1026
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   595
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     351,   352,    35,    33,   353,    34,     2,    36,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,   348,
+      26,    25,    27,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   349,     2,   350,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      28,    29,    30,    31,    32,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,   209,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   223,   224,   225,   226,   227,   228,   229,   230,   231,
+     232,   233,   234,   235,   236,   237,   238,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   255,   256,   257,   258,   259,   260,   261,
+     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
+     272,   273,   274,   275,   276,   277,   278,   279,   280,   281,
+     282,   283,   284,   285,   286,   287,   288,   289,   290,   291,
+     292,   293,   294,   295,   296,   297,   298,   299,   300,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   317,   318,   319,   320,   321,
+     322,   323,   324,   325,   326,   327,   328,   329,   330,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   339,   339,   340,   341,   344,   345,   348,   350,   351,
+     352,   353,   354,   376,   379,   383,   388,   399,   400,   410,
+     414,   415,   416,   421,   426,   432,   437,   441,   445,   449,
+     453,   457,   461,   465,   470,   480,   485,   491,   499,   509,
+     519,   524,   536,   540,   544,   548,   552,   556,   575,   582,
+     593,   605,   609,   614,   615,   620,   625,   630,   635,   640,
+     645,   650,   655,   660,   665,   670,   671,   676,   681,   682,
+     687,   688,   694,   700,   701,   706,   707,   708,   709,   710,
+     711,   712,   727,   726,   730,   732,   733,   736,   741,   740,
+     744,   743,   747,   751,   750,   755,   754,   758,   757,   761,
+     767,   772,   771,   774,   776,   775,   779,   778,   783,   782,
+     786,   799,   811,   810,   814,   815,   816,   817,   818,   819,
+     821,   820,   823,   829,   831,   835,   837,   843,   845,   847,
+     849,   851,   853,   856,   859,   864,   865,   866,   867,   869,
+     871,   873,   877,   879,   881,   885,   889,   901,   904,   905,
+     907,   909,   911,   913,   914,   915,   919,   923,   927,   933,
+     939,   945,   951,   955,   959,   967,   969,   971,   973,   975,
+     977,   979,   981,   983,   985,   987,   988,   989,   990,   991,
+     992,   998,   999,  1003,  1020,  1030,  1031,  1032,  1045,  1057,
+    1061,  1064,  1065,  1074,  1075,  1088,  1092,  1100,  1101,  1103,
+    1104,  1105,  1106,  1107,  1108,  1109,  1110,  1111,  1112,  1113,
+    1114,  1115,  1116,  1117,  1122,  1127,  1128,  1129,  1130,  1131,
+    1132,  1133,  1134,  1135,  1137,  1138,  1139,  1140,  1144,  1145,
+    1147,  1148,  1149,  1150,  1155,  1156,  1158,  1159,  1160,  1161,
+    1162,  1163,  1164,  1165,  1166,  1167,  1168,  1169,  1170,  1171,
+    1177,  1182,  1190,  1191,  1192,  1193,  1194,  1199,  1200,  1202,
+    1203,  1204,  1205,  1206,  1211,  1212,  1214,  1215,  1216,  1217,
+    1218,  1219,  1224,  1225,  1228,  1231,  1234,  1237,  1238,  1239,
+    1242,  1243,  1247,  1251,  1262,  1273,  1274,  1275,  1276,  1277,
+    1280,  1285,  1286,  1288,  1289,  1290,  1291,  1294,  1303,  1304,
+    1306,  1307,  1308,  1309,  1310,  1311,  1312,  1313,  1314,  1315,
+    1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,
+    1326,  1327,  1328,  1329,  1330,  1331,  1333,  1338,  1339,  1341,
+    1342,  1343,  1344,  1345,  1351,  1356,  1361,  1367,  1372,  1377,
+    1382,  1387,  1392,  1397,  1402,  1406,  1408,  1413,  1414,  1416,
+    1417,  1418,  1421,  1424,  1425,  1428,  1428,  1429,  1429,  1430,
+    1430,  1431,  1431,  1432,  1432,  1433,  1433,  1434,  1434,  1437,
+    1438,  1441,  1442,  1443,  1444,  1445,  1446,  1447,  1448,  1449,
+    1450,  1451,  1452,  1453,  1454,  1455,  1456,  1457,  1466,  1467,
+    1469,  1470,  1471,  1472,  1474,  1479,  1480,  1482,  1483,  1498,
+    1499,  1500,  1501,  1502,  1503,  1504,  1505,  1506,  1508,  1510,
+    1512,  1513,  1514,  1516,  1521,  1522,  1524,  1525,  1526,  1527,
+    1528,  1529,  1531,  1536,  1537,  1539,  1540,  1541,  1542,  1543,
+    1544,  1545,  1546,  1568,  1575,  1583,  1585,  1588,  1589,  1591,
+    1592,  1593,  1594,  1595,  1596,  1597,  1598,  1599,  1600,  1601,
+    1602,  1607,  1608,  1609,  1611,  1614,  1620,  1627,  1634,  1636,
+    1643,  1645,  1650,  1651,  1653,  1660,  1666,  1675,  1684,  1685,
+    1686,  1687,  1688,  1689,  1690,  1691,  1692,  1695,  1698,  1699,
+    1701,  1703,  1705,  1707,  1709,  1710,  1713,  1718,  1719,  1721,
+    1724,  1727,  1730,  1733,  1736,  1741,  1742,  1744,  1745,  1746,
+    1747,  1748,  1749,  1750,  1751,  1754,  1759,  1760,  1762,  1767,
+    1772,  1777,  1791,  1795,  1799,  1802,  1807,  1808,  1810,  1816,
+    1822,  1829,  1836,  1839,  1844,  1847,  1850,  1858,  1867,  1868,
+    1869,  1870,  1872,  1875,  1876,  1877,  1878,  1885,  1887,  1890,
+    1891,  1892,  1893,  1894,  1896,  1898,  1899,  1902,  1903
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER", "L_OFF",
+  "L_ON", "L_AUTO", "L_YES", "L_NO", "CHIPSET_TYPE", "REAL", "STRING",
+  "VARIABLE", "EXPRTEST", "INTCAST", "REALCAST", "AND_OP", "OR_OP",
+  "XOR_OP", "SHR_OP", "SHL_OP", "NOT_OP", "EQ_OP", "GE_OP", "LE_OP", "'='",
+  "'<'", "'>'", "NEQ_OP", "STR_EQ_OP", "STR_NEQ_OP", "L_AND_OP", "L_OR_OP",
+  "'+'", "'-'", "'*'", "'/'", "UMINUS", "UPLUS", "BIT_NOT_OP", "STRLEN",
+  "STRTOL", "STRNCMP", "STRCAT", "STRPBRK", "STRSPLIT", "STRCHR",
+  "STRRCHR", "STRSTR", "STRDEL", "STRSPN", "STRCSPN", "SHELL", "DEFINED",
+  "DEFINE", "UNDEF", "IFSTATEMENT", "WHILESTATEMENT", "FOREACHSTATEMENT",
+  "CHECKUSERVAR", "TICKLESS_IDLE", "FASTFLOPPY", "HOGTHRESH", "SPEAKER",
+  "IPXSUPPORT", "IPXNETWORK", "NOVELLHACK", "ETHDEV", "ETHRING", "TAPDEV",
+  "VDESWITCH", "SLIRPARGS", "NETSOCK", "VNET", "DEBUG", "MOUSE", "SERIAL",
+  "COM", "KEYBOARD", "TERMINAL", "VIDEO", "EMURETRACE", "TIMER", "MATHCO",
+  "CPU", "CPUSPEED", "BOOTDRIVE", "SWAP_BOOTDRIVE", "DISK_URING",
+  "DISK_CACHE", "DISK_CACHE_WB", "FATFS_WRITE", "L_XMS", "L_DPMI",
+  "DPMI_BASE", "HUGEPAGES", "PM_DOS_API", "NO_NULL_CHECKS", "PORTS",
+  "DISK", "DOSMEM", "EXT_MEM", "L_EMS", "UMB_A0", "UMB_B0", "UMB_F0",
+  "HMA", "DOS_UP", "EMS_SIZE", "EMS_FRAME", "EMS_UMA_PAGES",
+  "EMS_CONV_PAGES", "TTYLOCKS", "L_SOUND", "L_SND_OSS", "L_JOYSTICK",
+  "FILE_LOCK_LIMIT", "FILE_OPEN_LIMIT", "ABORT", "WARN", "ERROR",
+  "L_FLOPPY", "EMUSYS", "L_X", "L_SDL", "DOSEMUMAP", "LOGBUFSIZE",
+  "LOGFILESIZE", "MAPPINGDRIVER", "LFN_SUPPORT", "FFS_REDIR",
+  "SET_INT_HOOKS", "TRACE_IRETS", "FINT_REVECT", "EMULATED", "NATIVE",
+  "CPUEMU", "CPU_VM", "CPU_VM_DPMI", "VM86", "KVM", "RAWKEYBOARD",
+  "PRESTROKE", "KEYTABLE", "SHIFT_MAP", "ALT_MAP", "NUMPAD_MAP", "DUMP",
+  "LAYOUT", "DGRAVE", "DACUTE", "DCIRCUM", "DTILDE", "DBREVE", "DABOVED",
+  "DDIARES", "DABOVER", "DDACUTE", "DCEDILLA", "DIOTA", "DOGONEK",
+  "DCARON", "NETWORK", "PKTDRIVER", "NE2K", "DIRECTORY", "NAMESTUB",
+  "BINARY", "BASE", "IRQ", "DEVICE", "CHARSET", "BAUDRATE", "VIRTUAL",
+  "VMODEM", "PSEUDO", "RTSCTS", "LOWLAT", "PCCOM", "EXEC", "WRFILE",
+  "NULLMM", "MICROSOFT", "MS3BUTTON", "LOGITECH", "MMSERIES", "MOUSEMAN",
+  "HITACHI", "MOUSESYSTEMS", "BUSMOUSE", "PS2", "IMPS2", "INTERNALDRIVER",
+  "EMULATE3BUTTONS", "CLEARDTR", "UNGRAB_TWEAK", "L_DISPLAY", "L_TITLE",
+  "X_TITLE_SHOW_APPNAME", "ICON_NAME", "X_BLINKRATE", "X_SHARECMAP",
+  "X_MITSHM", "X_FONT", "X_FIXED_ASPECT", "X_ASPECT_43", "X_LIN_FILT",
+  "X_BILIN_FILT", "X_MODE13FACT", "X_WINSIZE", "X_NOCLOSE", "X_NORESIZE",
+  "X_GAMMA", "X_FULLSCREEN", "VGAEMU_MEMSIZE", "VESAMODE", "X_LFB",
+  "X_PM_INTERFACE", "X_MGRAB_KEY", "X_BACKGROUND_PAUSE", "SDL_HWREND",
+  "SDL_FONTS", "SDL_WCONTROLS", "SDL_CLIP_NATIVE", "VGA", "MGA", "CGA",
+  "EGA", "NONE", "CONSOLE", "GRAPHICS", "CHIPSET", "FULLREST", "PARTREST",
+  "MEMSIZE", "VBIOS_SIZE_TOK", "VBIOS_SEG", "VGAEMUBIOS_FILE",
+  "VBIOS_FILE", "VBIOS_COPY", "VBIOS_MMAP", "DUALMON", "VBIOS_POST",
+  "VGA_FONTS", "FORCE_VT_SWITCH", "PCI", "COLOR", "ESCCHAR", "XTERM_TITLE",
+  "SIZE", "IO", "PORT", "CONFIG", "READ", "WRITE", "KEYB", "PRINTER",
+  "WARNING", "GENERAL", "HARDWARE", "L_IPC", "SOUND", "TRACE", "CLEAR",
+  "TRACE_MMIO", "UEXEC", "LPATHS", "HDRIVES", "LPT", "COMMAND", "TIMEOUT",
+  "L_FILE", "L_PARTITION", "WHOLEDISK", "SECTORS", "CYLINDERS", "TRACKS",
+  "HEADS", "OFFSET", "HDIMAGE", "HDTYPE1", "HDTYPE2", "HDTYPE9",
+  "DISKCYL4096", "OVERLAY", "OVERLAY_COMMIT", "OVERLAY_DISCARD",
+  "THREEINCH", "THREEINCH_720", "THREEINCH_2880", "FIVEINCH",
+  "FIVEINCH_360", "READONLY", "BOOT", "DEFAULT_DRIVES", "SKIP_DRIVES",
+  "RDONLY", "WRONLY", "RDWR", "ORMASK", "ANDMASK", "RANGE", "FAST", "SLOW",
+  "SILLYINT", "USE_SIGIO", "HARDWARE_RAM", "SB_BASE", "SB_IRQ", "SB_DMA",
+  "SB_HDMA", "MPU_BASE", "MPU_BASE_MT32", "MPU_IRQ", "MPU_IRQ_MT32",
+  "MIDI_SYNTH", "SOUND_DRIVER", "MIDI_DRIVER", "FLUID_SFONT",
+  "FLUID_VOLUME", "MUNT_ROMS", "OPL2LPT_DEV", "OPL2LPT_TYPE",
+  "SND_PLUGIN_PARAMS", "PCM_HPF", "MIDI_FILE", "WAV_FILE", "SOUND_VTIME",
+  "CDROM", "ASPI", "DEVICETYPE", "TARGET", "FEATURE", "JOYSTICK",
+  "JOY_DEVICE", "JOY_DOS_MIN", "JOY_DOS_MAX", "JOY_GRANULARITY",
+  "JOY_LATENCY", "CLI_TIMEOUT", "TIMEMODE", "TIMER_TWEAKS", "UNICODE",
+  "SHIFT_ALT_MAP", "CTRL_MAP", "CTRL_ALT_MAP", "INTERNAL", "EXTERNAL",
+  "';'", "'{'", "'}'", "'('", "')'", "','", "$accept", "lines", "optdelim",
+  "line", "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9",
+  "$@10", "$@11", "$@12", "expression", "real_expression", "typed_expr",
+  "int_expr", "bool_expr", "real_expr", "variable_content",
+  "string_unquoted", "string_expr", "strarglist", "strarglist_item",
+  "check_user_var_list", "x_flags", "x_flag", "sdl_flags", "sdl_flag",
+  "sound_flags", "sound_flag", "joystick_flags", "joystick_flag",
+  "video_flags", "video_flag", "term_flags", "term_flag", "debug_flags",
+  "debug_flag", "mouse_flags", "mouse_flag", "keyboard_flags",
+  "keyboard_flag", "keyboard_mods", "keyboard_mod", "$@13", "$@14", "$@15",
+  "$@16", "$@17", "$@18", "$@19", "keyboard_modvals", "keyboard_modval",
+  "ttylocks_flags", "ttylocks_flag", "serial_flags", "serial_flag",
+  "printer_flags", "printer_flag", "floppy_flags", "floppy_flag",
+  "disk_flags", "disk_flag", "disk_type", "port_flags", "port_flag",
+  "trace_port_flags", "trace_port_flag", "trace_mmio_flags",
+  "trace_mmio_flag", "sillyint_flags", "sillyint_flag", "ems_flags",
+  "ems_flag", "hardware_ram_flags", "hardware_ram_flag", "bool",
+  "floppy_bool", "int_bool", "irq_bool", "speaker", "cpu_vm",
+  "cpu_vm_dpmi", "charset_flags", "charset_flag", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-394)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-191)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -394,  1886,  -394,  -394,  -394,   -19,  1813,  -338,     8,     8,
+    -330,    24,    29,    26,  1813,  1813,  1813,    36,  1813,  1813,
+    1813,   461,  1813,   461,   461,   461,   461,   461,   154,  -394,
+    -394,  -394,  -304,  -394,  1813,  1813,  1813,  1813,  2048,   461,
+    1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,
+    1813,  -394,  -394,  1813,  1813,  1316,  1813,  1813,  1813,  1813,
+    1813,  -283,  -277,  1695,    46,    77,   154,   154,   154,  -394,
+     167,  -266,  -263,   461,  1813,  1813,   461,  1813,  1813,  1813,
+    1813,  1813,    94,   140,    67,   461,   671,  1813,  1813,  -245,
+    1813,  1813,   461,  -394,  1813,    10,  -394,   461,   461,   461,
+    1813,  1813,  1813,  -233,  -226,  -224,  -222,  1813,   461,  1813,
+    -394,  2755,  -394,   154,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,   -13,  -394,  -221,  -219,  1813,  1813,  1813,  1813,  -214,
+    -212,  -201,  -192,  -183,  -171,  -163,  -161,  -158,  -155,  -151,
+    -147,  -131,  -126,  1813,  1501,  -394,  -394,  -394,    22,  -394,
+      40,   154,  -394,  -394,  -394,  1813,  -108,  -104,  -394,  -100,
+    -394,  1501,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  1813,   -93,  -394,   -96,  -394,   -91,
+     -88,   -78,    13,   -77,  -394,  -394,  -394,  -394,   270,  -394,
+    1501,  -394,  -394,  -394,  1501,  1655,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,   -71,   -65,  -394,  -394,    47,  -394,
+    -394,  -394,  -394,  -394,  -394,    74,  1310,    79,  -394,  -394,
+    -394,   -96,   -96,   -96,   -62,   461,  -394,  2731,   -47,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,   461,  -394,  -394,  -394,  -258,  -394,
+    -394,  -394,   -60,  -394,   -56,   -48,  -394,  -394,  -394,  1655,
+    1655,   -42,  -394,  -394,    99,   461,   461,  1813,  -394,  -394,
+    -394,  -394,  -394,   -96,  1813,  1813,   853,  -394,  -394,  -394,
+     461,   461,   461,   154,   461,   461,   461,   461,   461,   461,
+     461,   461,   154,     8,   637,  1813,  1813,  1813,  1813,  1813,
+    1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,
+    1813,  1813,   461,   461,  -238,   -44,   -70,   280,   298,   746,
+    2536,   154,  1393,   683,     1,  -394,  -394,  1813,  1813,   461,
+      81,  -394,  1371,  -394,    56,     4,  -394,  -394,  -394,  1813,
+    1813,  1813,  1813,  1813,    25,  -394,  -394,  -394,   461,   461,
+    -394,    98,  -394,  1813,  1813,  1813,  1813,  1813,  1813,  1813,
+    1813,   461,   461,   461,   461,  1813,   461,   461,   461,   461,
+    1813,   461,   461,  1813,  2392,  -394,   461,  1813,  1813,  1813,
+    1813,   -68,  -394,     7,   -39,   461,   461,  1813,   461,  1813,
+    -394,  1813,   461,  1813,  -394,  -394,  -394,  1813,  2155,  1813,
+    1813,  1813,  1813,  1813,  2225,  1813,  1813,   461,  1813,  1445,
+    -394,  1813,   461,  1813,  1813,  -102,  -394,  -394,   -36,   303,
+     320,  -286,  -394,   533,    43,   102,    90,  -394,  -394,  -394,
+    2276,  1813,    73,  -394,   -18,     5,   312,   887,  1124,   -10,
+      -9,    18,  -166,    30,    31,    39,    48,    49,    57,    69,
+      72,  -144,    -7,  -394,   853,   853,   853,   853,   853,   467,
+     467,   467,   467,   467,   467,   290,   290,   182,   182,  -394,
+    -394,  -394,  -394,  -394,  -394,  1813,     9,  -394,  -394,  -394,
+    -394,  -394,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,
+    1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,  1813,
+    1813,  1813,  1813,  1813,  1813,  1813,   210,  -394,  -394,  -394,
+    -394,   461,  1813,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  1813,   379,  -394,  -394,
+    -394,  -394,  1813,  1813,  1813,   461,  -394,  -394,  -394,  -394,
+    -394,  -394,   461,   461,   461,  -394,    54,  -394,  -394,  -394,
+    1813,   461,   106,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,   376,   387,   419,  -394,
+    -394,  1813,  1813,  1813,   461,   461,  -394,  -394,  -394,  -394,
+    -394,  -394,   407,  -394,  -394,  -394,  -394,   461,  -394,  -394,
+    -394,  1813,  1813,  2327,  -394,  -394,  1813,    19,  -394,  -394,
+    -394,   461,   461,   418,   461,  -394,  -394,  -394,  -394,  -394,
+      78,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,   461,
+     461,   461,  -394,  -394,  -394,  -394,  -394,  -394,  -394,   388,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,   429,    80,  -394,  -394,  -394,  -394,  -394,   431,    82,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  1163,  -394,  -394,  -394,  -394,  -394,  -394,  1813,
+    1813,   461,  1813,   461,    70,  -394,  -394,  -394,  -394,  -394,
+    2379,  1813,    28,  -394,  -394,  -394,  -394,  2430,  1813,    95,
+    -394,  -394,  -394,  -394,  2481,  1760,  1813,    76,  -394,   434,
+      87,    91,  -394,  -394,  -394,   461,  1813,  -394,  -394,  -394,
+    -394,   461,  -394,   461,  1813,   461,   461,   461,  1813,   461,
+     461,  -394,  -394,    97,   461,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,   439,   101,   100,  -394,  -394,  -394,   444,  -394,
+    -394,   204,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  1813,
+     452,  1813,  1813,  1813,  1813,  1813,  1813,  1813,   432,  1035,
+    -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,   455,   121,
+     107,  -394,  -394,   472,   124,   139,  -394,  -394,   489,   142,
+    2538,  -394,   141,  -394,  -394,  -394,  1813,  -394,   176,   158,
+     159,   162,   165,   169,   170,   173,   166,   175,   179,  -394,
+     180,  -394,  1813,  -394,  -394,  -394,  -394,  -394,  1813,  1813,
+    1813,  1813,  1813,  -394,  -394,  -394,  -394,   461,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,   183,   503,   510,   512,   514,
+     520,   521,  -394,  -394,  -394,  -394,  1813,  -394,  -394,  1813,
+    -394,  -394,  1813,   544,   195,  -394,  -394,  1813,  -394,  1813,
+    -394,  1813,  -394,  -394,  -394,  1813,  -394,  -394,   154,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  1813,  -394,  -394,  -394,
+    -394,  -394,  -394,   433,  -394,  -394,  -394,  -394,  1813,   200,
+     203,   205,   207,  -116,  -394,   433,   433,   433,   433,   433,
+     433,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,  1813,  -394,   199,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,   199,   199,   199,   199,
+     199,   199,   223,   433,  -394,  -394
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     1,   132,   131,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    88,    90,
+      93,    95,     0,    82,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   101,   106,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   108,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   112,     0,     0,   104,     0,     0,     0,
+       0,     0,   120,     0,     0,     0,     0,     0,     0,     0,
+       5,     0,     3,     0,   148,   179,   178,   153,   176,   177,
+     181,   164,   183,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    18,   135,   136,   137,   146,   185,
+       0,     0,   184,    10,    11,     0,     0,     0,   195,    17,
+     524,   133,     9,   525,    33,     8,   532,   528,   531,   530,
+     529,    81,    69,   526,    70,    79,   190,    73,    74,    75,
+      76,    77,    78,    80,     0,     0,   193,    87,   191,     0,
+       0,     0,     0,     0,    52,    49,    68,    34,   148,    38,
+     134,    41,    42,    43,     0,    44,    45,    46,    67,    60,
+      61,    62,    63,    64,     0,     0,    65,    66,     0,    54,
+      55,    56,    57,    58,    59,     0,     0,     0,   118,    26,
+      27,    19,    21,    20,     0,     0,    22,     0,     0,    24,
+      50,    51,    25,    28,    32,    30,    31,    29,    37,   538,
+     533,   537,   536,   534,   535,    35,   544,   539,   543,   542,
+     540,   541,    36,    99,     0,    97,    71,    72,     0,    84,
+      40,    85,     0,   116,     0,     0,   128,   129,   130,    47,
+      48,     0,   527,   122,     0,     0,     0,     0,   125,   126,
+     127,     6,     4,    16,     0,     0,   175,   143,   142,   152,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   297,   296,     0,     0,     0,
+       0,   291,     0,    39,     0,     0,   515,   508,   514,     0,
+       0,     0,     0,     0,     0,   506,   394,   393,     0,     0,
+     392,     0,   388,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   234,     0,     0,     0,     0,
+       0,     0,   257,     0,     0,     0,     0,     0,     0,     0,
+     204,   205,     0,     0,   209,   210,   211,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     197,     0,     0,     0,     0,     0,   228,   100,     0,     0,
+       0,     0,   545,     0,     0,     0,     0,   523,   518,   522,
+       0,     0,     0,   516,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   147,   149,   150,   151,   144,   145,   165,
+     167,   168,   169,   170,   166,   171,   172,   138,   139,   140,
+     141,   173,   174,    15,    12,     0,     0,   196,   194,   326,
+     301,   325,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   298,   192,   346,
+     345,     0,     0,   334,   335,   338,   337,   341,   342,   336,
+     343,   339,   340,   330,   331,   333,     0,     0,   327,   413,
+     412,   407,     0,     0,     0,     0,   398,   400,   399,   401,
+     402,   403,     0,     0,     0,   411,     0,   395,   352,   351,
+       0,     0,     0,   347,   294,   293,   295,    86,   292,   290,
+     289,   266,   267,   268,   269,   270,   275,   273,     0,   277,
+     278,     0,     0,     0,     0,     0,   281,   282,   286,   285,
+     287,   288,     0,   264,   477,   464,   476,     0,   468,   469,
+     470,     0,     0,     0,   473,   474,     0,     0,   462,   461,
+     460,     0,     0,     0,     0,   437,   510,   511,   512,   513,
+       0,    53,   507,   390,   391,    92,   389,   236,   239,   237,
+     238,   240,   241,   243,   244,   242,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   255,   256,   117,   235,
+     259,   260,   261,   262,   263,   119,   258,   436,   435,     0,
+       0,     0,   426,   428,   427,   429,   430,   425,   431,     0,
+     423,    23,   199,   200,   201,   202,   203,   206,   207,   208,
+     212,   148,     0,   217,   218,   215,   216,   219,   148,     0,
+     224,   225,   226,   227,   114,   198,   230,   231,   232,   233,
+     115,   229,     0,   547,   548,     7,   546,   422,   421,     0,
+       0,     0,     0,     0,     0,   414,   486,   480,   485,   484,
+       0,     0,     0,   478,   494,   489,   493,     0,     0,     0,
+     487,   505,   497,   504,     0,     0,     0,     0,   495,   148,
+       0,     0,   123,   517,   110,     0,     0,   154,   182,   156,
+     155,     0,   186,     0,     0,     0,     0,     0,     0,     0,
+       0,   189,   180,     0,     0,   316,   302,   308,   300,   314,
+     315,   304,   319,   321,   322,   320,   310,   311,   303,   305,
+     306,   307,   309,   312,   313,   317,   318,   323,   324,    89,
+     299,   329,   332,   344,    91,   328,   404,   405,   406,   397,
+     408,   409,   410,    94,   396,   350,   349,    96,   348,   276,
+     274,   271,   272,   284,   283,   280,   279,    83,   265,   475,
+     471,   472,   148,     0,     0,   102,   463,   459,   458,   456,
+     455,     0,   509,   432,   434,   433,   109,   424,   213,     0,
+     220,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     353,   420,   416,   417,   418,   419,   113,   415,   148,     0,
+       0,   103,   479,   148,     0,     0,   105,   488,   148,     0,
+       0,   499,     0,   121,   496,   520,     0,   519,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    13,
+       0,   466,     0,   465,   457,   454,   453,   449,     0,     0,
+       0,     0,     0,   441,   442,   443,   440,     0,   451,   452,
+     439,   107,   438,   214,   221,   222,     0,     0,     0,     0,
+       0,     0,   361,    98,   354,   482,     0,   481,   491,     0,
+     490,   500,     0,   148,     0,   498,   521,     0,   124,     0,
+     158,     0,   159,   160,   161,     0,   162,   163,     0,   467,
+     444,   445,   446,   447,   448,   450,     0,   363,   365,   367,
+     357,   355,   359,     0,   483,   492,   501,   502,     0,     0,
+       0,     0,     0,     0,   223,     0,     0,     0,     0,     0,
+       0,   385,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   371,     0,   387,   362,   369,
+     503,   111,   157,   187,   188,    14,   364,   366,   368,   358,
+     356,   360,     0,     0,   386,   370
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -394,  -394,  -394,   445,  -394,  -394,  -394,  -394,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -394,   -12,  -394,  1094,    11,
+    -394,  -394,   722,    -8,  1162,   -57,   236,  -394,  -394,   149,
+    -394,   160,  -394,   202,  -394,   196,  -394,    -4,  -394,   252,
+    -394,   132,  -394,    58,  -394,   119,  -394,  -256,  -394,  -394,
+    -394,  -394,  -394,  -394,  -394,  -300,  -393,  -394,   291,  -394,
+     126,  -394,   -58,  -394,    14,  -394,  -394,  -394,  -394,    50,
+    -394,   -37,  -394,   -43,  -394,   -50,  -394,   334,  -394,   247,
+     104,  -394,   197,  -394,  -394,  -394,  -394,  -394,   261
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,   111,   112,   193,   185,   189,   190,   191,   438,
+     214,   275,   215,   234,   272,   281,   160,   199,   161,   145,
+     146,   147,   148,   149,   150,   187,   188,   159,   429,   430,
+     435,   436,   394,   395,   401,   402,   602,   603,   350,   351,
+     526,   527,   547,   548,   572,   573,   859,   860,   989,   988,
+     990,   973,   985,   986,   987,  1008,  1009,   371,   372,   566,
+     567,   724,   725,   679,   680,   841,   922,   625,   617,   618,
+     732,   733,   739,   740,   747,   748,   364,   365,   452,   453,
+     162,   164,   174,   283,   171,   255,   262,   441,   442
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     153,   154,   568,   163,   165,   619,   113,   173,   667,   231,
+     232,   233,   569,   151,   345,   620,  -184,  -184,   668,   152,
+     604,   155,   605,   195,   346,   197,   356,   156,   357,   726,
+     606,   727,   157,   173,   173,   173,   358,   166,   158,   728,
+     167,   173,   173,   173,   726,   192,   727,   168,   356,   229,
+     357,  -190,  -190,   205,   728,   549,   293,   604,   358,   605,
+     439,   440,   240,   241,   715,   550,   225,   606,   256,   332,
+     333,   717,   226,   257,   447,   366,   448,   741,   258,   742,
+     230,   718,   345,   237,   449,   367,   238,   743,   439,   440,
+     282,   741,   346,   742,   334,   173,   734,   248,   735,   366,
+     447,   743,   448,   734,   268,   735,   736,   568,   274,   367,
+     449,   279,   280,   736,   493,   341,   284,   569,   431,   432,
+     433,   434,   172,   285,   175,   286,   178,   287,   669,   551,
+     294,   552,   295,   359,   360,   361,   362,   300,   194,   301,
+     196,   249,   570,   335,   202,   203,   250,   206,   207,   571,
+     302,   251,   211,   212,   213,   359,   360,   361,   362,   303,
+     220,   221,   222,   223,   224,   152,   122,   228,   304,   621,
+     169,   170,   670,   431,   432,   433,   434,   671,   152,   122,
+     305,   243,   244,   245,   246,   247,   762,   341,   306,   607,
+     307,   266,   267,   308,   269,   270,   309,   132,   273,   134,
+     310,   259,   260,   138,   311,   905,   141,   261,   771,   341,
+     132,   499,   134,   290,   500,   906,   138,   330,   331,   141,
+     312,   501,   553,   554,   555,   313,   607,   556,   557,   558,
+     559,   560,   561,   562,   563,   564,  1015,   341,   719,   368,
+     369,   370,   208,   209,   210,   336,   462,   570,   710,   337,
+     216,   217,   219,   338,   571,   471,   340,   341,   342,   347,
+     348,   343,   349,   368,   369,   370,   396,   397,   398,   399,
+     400,   344,   352,   353,   252,   456,   622,   623,   354,   253,
+     254,   495,   665,   624,   355,   502,   503,   403,   504,   443,
+     505,   729,   496,   444,   672,   673,   674,   675,   676,   677,
+     678,   445,   506,   507,   288,   472,   729,   446,   494,   508,
+     497,   681,   509,   712,   713,   608,   609,   610,   611,   612,
+     613,   614,   615,   328,   329,   330,   331,   347,   348,   730,
+     349,   714,   754,   510,   511,   755,   575,   756,   720,   721,
+     722,   723,   759,   760,   730,   772,   565,   626,   627,   628,
+     629,   630,   608,   609,   610,   611,   612,   613,   614,   615,
+     774,   637,   638,   639,   640,   641,   642,   173,   644,   835,
+     616,   761,   512,   649,   450,   631,   363,   744,   871,   731,
+     529,   745,   819,   763,   764,   661,   662,   663,   664,   667,
+     530,   744,   765,   820,   731,   745,   737,   686,   363,   668,
+     450,   766,   767,   737,   813,   690,   692,   616,   579,   695,
+     768,   697,   699,   396,   397,   398,   399,   400,   580,   706,
+     866,   708,   769,   752,   451,   770,   883,   746,   821,   839,
+     842,   577,   848,   849,   850,   851,   991,   885,   750,   751,
+     886,   746,   901,   887,   152,   876,   738,   904,   635,   899,
+     451,   574,   903,   738,   902,   924,   817,   932,   935,   937,
+     513,   514,   515,   516,   517,   518,   519,   520,   521,   522,
+     523,   524,   152,   122,   936,   938,   907,   939,   908,   909,
+     910,   911,   912,   773,   913,   914,   915,   916,   917,   918,
+     919,   940,   941,   945,   654,   942,   920,   657,   326,   327,
+     328,   329,   330,   331,   132,   184,   134,   947,   948,   669,
+     138,   684,   949,   141,   950,   687,   235,   689,   951,   955,
+     802,   952,   953,   693,   694,   954,   696,   956,   967,   700,
+     701,   957,   703,   958,   717,   968,   966,   969,   709,   970,
+     806,   807,   808,   525,   718,   971,   972,   977,   978,   531,
+    1011,   532,  1023,   670,   921,  1012,   292,  1013,   671,  1014,
+     799,   533,   534,   535,   536,   537,   538,   539,   540,   541,
+     542,   543,   544,   545,   546,  1024,   643,   528,   705,   822,
+     823,   824,   992,   993,   994,   995,   996,   997,   998,   999,
+    1000,  1001,  1002,  1003,  1004,   711,   659,   666,   828,   830,
+     831,   833,   578,   934,   834,   805,   775,   776,   777,   778,
+     779,   780,   781,   782,   783,   784,   785,   786,   787,   788,
+     789,   790,   791,   792,   793,   794,   795,   796,   797,   798,
+    1025,   581,   582,   583,   584,   585,   586,   587,   588,   589,
+     590,   591,   592,   593,   594,   595,   596,   597,   598,   599,
+     803,   600,   601,   315,   316,   317,   318,   319,   800,   320,
+     321,   322,   636,   323,   324,   325,   867,   836,   326,   327,
+     328,   329,   330,   331,   815,   672,   673,   674,   675,   676,
+     677,   678,   152,   122,   549,  1016,  1017,  1018,  1019,  1020,
+    1021,   818,   814,   847,   550,   872,   877,   884,   632,   753,
+     858,   719,   716,     0,     0,     0,     0,   861,   862,     0,
+     864,     0,     0,     0,   132,     0,   134,     0,   869,   870,
+     138,     0,     0,   141,     0,   874,   875,     0,     0,   804,
+       0,     0,   879,   881,   882,     0,     0,     0,   846,     0,
+       0,     0,     0,   176,   889,   176,   176,   176,   176,   176,
+     176,     0,   892,     0,     0,     0,   896,   827,   551,     0,
+     552,   176,   315,   316,   317,   318,   319,     0,   320,   321,
+     322,     0,   323,   324,   325,  1005,     0,   326,   327,   328,
+     329,   330,   331,     0,  1006,     0,     0,     0,   176,   176,
+     176,     0,   176,     0,     0,   176,     0,     0,   176,     0,
+       0,   720,   721,   722,   723,     0,     0,   176,   176,     0,
+       0,     0,     0,     0,   176,     0,     0,     0,   264,   176,
+     176,   176,     0,     0,     0,     0,     0,     0,     0,     0,
+     176,     0,     0,     0,     0,   176,     0,   923,     0,   925,
+     926,   927,   928,   929,   930,   931,     0,   858,     0,     0,
+       0,   553,   554,   555,     0,     0,   556,   557,   558,   559,
+     560,   561,   562,   563,   564,     0,     0,     0,   944,     0,
+       0,     0,     0,   176,   946,   320,   321,   322,     0,   323,
+     324,   325,     0,     0,   326,   327,   328,   329,   330,   331,
+     959,     0,     0,     0,     0,     0,   960,   961,   962,   963,
+     964,   983,     0,   315,   316,   317,   318,   319,     0,   320,
+     321,   322,     0,   323,   324,   325,     0,     0,   326,   327,
+     328,   329,   330,   331,   974,     0,     0,   975,     0,     0,
+     976,     0,     0,     0,     0,   979,     0,   980,     0,   981,
+       0,     0,     0,   982,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   984,     0,     0,   176,     0,     0,
+       0,     0,     0,     0,     0,  1007,  1010,     0,     0,     0,
+       0,     0,     0,     0,     0,   565,     0,  1007,  1007,  1007,
+    1007,  1007,  1007,     0,     0,     0,   176,     0,     0,   473,
+       0,     0,     0,     0,  1022,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   176,   176,     0,
+       0,     0,     0,     0,     0,  1007,     0,     0,     0,     0,
+       0,     0,   176,   176,   176,   176,   176,   176,   176,   176,
+     176,   176,   176,   176,   176,     0,     0,     0,   114,   115,
+     116,   117,   118,   119,     0,   120,   121,   122,     0,   123,
+     124,     0,     0,     0,   176,   176,   125,     0,     0,     0,
+       0,     0,     0,   176,     0,     0,     0,     0,   126,   127,
+       0,   176,     0,     0,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,     0,
+     176,   176,     0,     0,     0,     0,     0,     0,   498,     0,
+     144,     0,     0,   176,   176,   176,   176,     0,   176,   176,
+     176,   176,     0,   176,   176,     0,     0,     0,   176,     0,
+       0,     0,     0,     0,     0,     0,     0,   176,   176,     0,
+     176,     0,   200,     0,   176,     0,   204,     0,     0,     0,
+     315,   316,   317,   318,   319,     0,   320,   321,   322,   176,
+     323,   324,   325,     0,   176,   326,   327,   328,   329,   330,
+     331,     0,     0,     0,     0,     0,   114,   115,   116,   117,
+     118,   119,     0,   120,   121,   122,     0,   123,   124,   852,
+     853,   854,     0,   177,   125,   179,   180,   181,   182,   183,
+     186,     0,     0,     0,   204,   204,   126,   127,     0,     0,
+       0,   201,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,     0,     0,   296,
+     297,   298,   299,     0,     0,     0,     0,     0,   186,   186,
+     186,     0,   236,     0,     0,   239,     0,   314,   242,   757,
+       0,     0,     0,     0,     0,     0,     0,   263,   265,     0,
+       0,     0,     0,   176,   271,     0,     0,     0,     0,   276,
+     277,   278,     0,     0,     0,     0,     0,     0,     0,     0,
+     289,     0,     0,     0,     0,   186,     0,   176,   339,     0,
+       0,     0,     0,     0,   176,   176,   176,     0,     0,     0,
+       0,     0,     0,   176,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   852,   853,   854,
+       0,     0,     0,   186,     0,     0,   176,   176,     0,   114,
+     115,   116,   117,   118,   119,     0,   120,   121,   122,   176,
+     123,   124,     0,     0,     0,     0,     0,   125,     0,     0,
+       0,     0,     0,   176,   176,     0,   176,     0,     0,   126,
+     127,     0,     0,     0,     0,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+       0,     0,   579,     0,     0,     0,     0,     0,   855,   856,
+     857,     0,   580,     0,     0,   933,   143,     0,   457,   458,
+       0,   176,   176,   176,   529,     0,     0,   404,     0,     0,
+       0,     0,     0,     0,   530,     0,     0,     0,     0,   474,
+     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,   489,   490,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   176,     0,   176,     0,   454,   455,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   459,   460,   461,   186,   463,   464,   465,   466,
+     467,   468,   469,   470,   186,     0,   758,   176,     0,     0,
+       0,     0,     0,   176,     0,   176,     0,   176,   176,   176,
+       0,   176,   176,     0,   491,   492,   176,     0,     0,     0,
+       0,     0,     0,   186,     0,     0,   855,   856,   857,     0,
+       0,   576,     0,     0,   143,     0,     0,   315,   316,   317,
+     318,   319,     0,   320,   321,   322,     0,   323,   324,   325,
+     633,   634,   326,   327,   328,   329,   330,   331,     0,     0,
+       0,     0,     0,   645,   646,   647,   648,     0,   650,   651,
+     652,   653,     0,   655,   656,     0,     0,     0,   660,     0,
+       0,     0,     0,   531,     0,   532,     0,   682,   683,     0,
+     685,     0,     0,     0,   688,   533,   534,   535,   536,   537,
+     538,   539,   540,   541,   542,   543,   544,   545,   546,   702,
+       0,     0,     0,     0,   707,   581,   582,   583,   584,   585,
+     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
+     596,   597,   598,   599,     0,   600,   601,   373,   374,   375,
+     376,   377,   378,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,     0,   176,
+       0,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   218,     0,   143,     0,     0,
+       0,  -135,  -135,  -135,  -135,  -135,     0,  -135,  -135,  -135,
+     176,  -135,  -135,  -135,     0,     0,  -135,  -135,  -135,  -135,
+    -135,  -135,     0,   801,     0,     0,     0,     0,   114,   115,
+     116,   117,   118,   119,     0,   120,   121,   122,     0,   123,
+     124,     0,     0,     0,     0,     0,   125,   809,     0,     0,
+       0,     0,     0,     0,   810,   811,   812,     0,   126,   127,
+       0,     0,     0,   816,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,     0,     0,   825,   826,     0,     0,
+       0,     0,     0,   114,   115,   116,   117,   118,   119,   829,
+     120,   121,   122,     0,   123,   124,     0,     0,     0,     0,
+       0,   125,     0,   837,   838,     0,   840,     0,     0,     0,
+       0,     0,     0,   126,   127,   704,     0,     0,     0,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,     0,     0,   114,   115,   116,   117,
+     118,   119,     0,   120,   121,   122,     0,   123,   124,     0,
+       0,   843,   844,   845,   125,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   126,   127,     0,     0,
+       0,     0,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   863,     0,   865,     2,     3,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     4,     5,     6,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   888,     0,     0,
+       0,     0,     0,   890,     0,   891,     0,   893,   894,   895,
+       0,   897,   898,     0,     0,     0,   900,     0,     7,     0,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,     0,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,     0,     0,     0,     0,    61,    62,
+       0,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+       0,     0,    82,    83,    84,     0,     0,     0,    85,    86,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   227,     0,   143,     0,     0,    87,
+      88,   198,   115,   116,   117,   118,   119,    89,   120,   121,
+     122,   880,   123,   124,     0,     0,     0,     0,     0,   125,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   965,
+       0,   126,   127,     0,     0,     0,     0,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   143,     0,     0,     0,     0,     0,     0,     0,     0,
+     186,     0,     0,     0,     0,     0,     0,     0,     0,    90,
+       0,    91,     0,     0,    92,     0,     0,     0,     0,     0,
+       0,     0,    93,     0,     0,     0,     0,    94,    95,     0,
+      96,    97,    98,    99,     0,     0,     0,     0,   691,   115,
+     116,   117,   118,   119,   143,   120,   121,   122,     0,   123,
+     124,     0,     0,     0,     0,     0,   125,     0,     0,     0,
+     100,   101,     0,     0,     0,     0,     0,     0,   126,   127,
+     102,     0,   103,     0,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,     0,
+       0,     0,     0,     0,   104,   105,     0,     0,   106,     0,
+       0,     0,     0,     0,     0,   107,   108,   109,   698,   115,
+     116,   117,   118,   119,   110,   120,   121,   122,     0,   123,
+     124,     0,     0,     0,     0,     0,   125,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   126,   127,
+       0,     0,     0,     0,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   749,
+     115,   116,   117,   118,   119,     0,   120,   121,   122,     0,
+     123,   124,     0,     0,     0,     0,     0,   125,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   126,
+     127,     0,     0,     0,     0,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     832,   115,   116,   117,   118,   119,     0,   120,   121,   122,
+       0,   123,   124,     0,     0,     0,     0,     0,   125,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     126,   127,     0,     0,     0,     0,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,     0,   868,   115,   116,   117,   118,   119,     0,   120,
+     121,   122,     0,   123,   124,     0,     0,     0,     0,   143,
+     125,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   126,   127,     0,     0,     0,     0,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   873,   115,   116,   117,   118,   119,     0,
+     120,   121,   122,     0,   123,   124,     0,     0,     0,     0,
+       0,   125,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   126,   127,     0,     0,     0,     0,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   878,   115,   116,   117,   118,   119,
+       0,   120,   121,   122,     0,   123,   124,     0,     0,     0,
+       0,     0,   125,     0,     0,     0,   143,     0,     0,     0,
+       0,     0,     0,     0,   126,   127,     0,     0,     0,     0,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,     0,     0,   499,     0,     0,
+     500,   943,   115,   116,   117,   118,   119,   501,   120,   121,
+     122,     0,   123,   124,     0,     0,     0,     0,     0,   125,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   126,   127,     0,     0,     0,   143,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   502,   503,     0,   504,     0,   505,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   143,   506,   507,
+       0,     0,     0,     0,     0,   508,     0,     0,   509,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   510,
+     511,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   143,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   512,   373,
+     374,   375,   376,   377,   378,   379,   380,   381,   382,   383,
+     384,   385,   386,   387,   388,   389,   390,   391,   392,   393,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     143,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   658,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     3,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     4,     5,     6,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   143,     0,     0,     0,     0,   513,   514,   515,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     7,     0,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,   143,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,     0,     0,     0,     0,    61,    62,   525,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,   143,
+       0,    82,    83,    84,     0,     0,     0,    85,    86,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    87,    88,
+       0,     0,     0,     0,     0,     0,    89,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    90,     0,
+      91,     0,     0,    92,     0,     0,     0,     0,     0,     0,
+       0,    93,     0,     0,     0,     0,    94,    95,     0,    96,
+      97,    98,    99,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   100,
+     101,     0,     0,     0,     0,     0,     0,     0,     0,   102,
+       0,   103,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   104,   105,     0,     0,   106,     0,     0,
+       0,     0,     0,     0,   107,   108,   109,     0,     0,     0,
+       0,     0,     0,   291
+};
+
+static const yytype_int16 yycheck[] =
+{
+       8,     9,     1,    15,    16,     1,    25,    19,     1,    66,
+      67,    68,    11,   351,     1,    11,    29,    30,    11,    11,
+       1,   351,     3,    35,    11,    37,     1,     3,     3,     1,
+      11,     3,     3,    45,    46,    47,    11,     1,    12,    11,
+       4,    53,    54,    55,     1,   349,     3,    11,     1,     3,
+       3,    29,    30,    42,    11,     1,   113,     1,    11,     3,
+     346,   347,    74,    75,   350,    11,   349,    11,     1,    29,
+      30,     1,   349,     6,     1,     1,     3,     1,    11,     3,
+       3,    11,     1,   349,    11,    11,   349,    11,   346,   347,
+     102,     1,    11,     3,   151,   107,     1,     3,     3,     1,
+       1,    11,     3,     1,   349,     3,    11,     1,    98,    11,
+      11,   100,   101,    11,   352,   353,   349,    11,   220,   221,
+     222,   223,    18,   349,    20,   349,    22,   349,   121,    75,
+     351,    77,   351,   108,   109,   110,   111,   351,    34,   351,
+      36,     1,   141,   155,    40,    41,     6,    43,    44,   148,
+     351,    11,    48,    49,    50,   108,   109,   110,   111,   351,
+      56,    57,    58,    59,    60,    11,    12,    63,   351,   165,
+     134,   135,   165,   220,   221,   222,   223,   170,    11,    12,
+     351,    77,    78,    79,    80,    81,   352,   353,   351,   170,
+     351,    87,    88,   351,    90,    91,   351,    43,    94,    45,
+     351,   134,   135,    49,   351,     1,    52,   140,   352,   353,
+      43,     1,    45,   109,     4,    11,    49,    35,    36,    52,
+     351,    11,   168,   169,   170,   351,   170,   173,   174,   175,
+     176,   177,   178,   179,   180,   181,   352,   353,   168,   165,
+     166,   167,    45,    46,    47,   353,   303,   141,   350,   353,
+      53,    54,    55,   353,   148,   312,   349,   353,   349,   246,
+     247,   349,   249,   165,   166,   167,   334,   335,   336,   337,
+     338,   349,   349,     3,   134,   287,   272,   273,   349,   139,
+     140,   351,   350,   279,   349,    75,    76,   349,    78,   349,
+      80,   263,    12,   349,   287,   288,   289,   290,   291,   292,
+     293,   349,    92,    93,   107,   313,   263,   349,   352,    99,
+      12,   350,   102,   349,    11,   296,   297,   298,   299,   300,
+     301,   302,   303,    33,    34,    35,    36,   246,   247,   301,
+     249,    11,   350,   123,   124,   330,   348,    25,   268,   269,
+     270,   271,   352,   352,   301,   352,   292,   359,   360,   361,
+     362,   363,   296,   297,   298,   299,   300,   301,   302,   303,
+     351,   373,   374,   375,   376,   377,   378,   379,   380,   350,
+     351,   353,   162,   385,   301,   350,   351,   301,   350,   351,
+       1,   305,     6,   353,   353,   397,   398,   399,   400,     1,
+      11,   301,   353,     6,   351,   305,   301,   409,   351,    11,
+     301,   353,   353,   301,   350,   417,   418,   351,     1,   421,
+     353,   423,   424,   334,   335,   336,   337,   338,    11,   431,
+     350,   433,   353,   350,   351,   353,   350,   351,     9,    11,
+     352,   350,     3,   353,     3,   353,     3,     3,   450,   451,
+     353,   351,     3,   352,    11,   350,   351,     3,   350,   352,
+     351,   347,   352,   351,   353,     3,   350,    25,     3,   352,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,    11,    12,   353,     3,   272,   353,   274,   275,
+     276,   277,   278,   495,   280,   281,   282,   283,   284,   285,
+     286,   352,     3,   352,   390,   353,   292,   393,    31,    32,
+      33,    34,    35,    36,    43,   351,    45,   331,   350,   121,
+      49,   407,   353,    52,   352,   411,   349,   413,   353,   353,
+     532,   352,   352,   419,   420,   352,   422,   352,    25,   425,
+     426,   352,   428,   353,     1,    25,   353,    25,   434,    25,
+     552,   553,   554,   333,    11,    25,    25,     3,   353,   170,
+     350,   172,   353,   165,   350,   352,   111,   352,   170,   352,
+     350,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+     191,   192,   193,   194,   195,   352,   379,   341,   429,   591,
+     592,   593,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   435,   394,   401,   602,   611,
+     612,   613,   350,   859,   616,   547,   502,   503,   504,   505,
+     506,   507,   508,   509,   510,   511,   512,   513,   514,   515,
+     516,   517,   518,   519,   520,   521,   522,   523,   524,   525,
+    1023,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     546,   244,   245,    16,    17,    18,    19,    20,   526,    22,
+      23,    24,   371,    26,    27,    28,   724,   617,    31,    32,
+      33,    34,    35,    36,   570,   287,   288,   289,   290,   291,
+     292,   293,    11,    12,     1,   985,   986,   987,   988,   989,
+     990,   572,   566,   679,    11,   732,   739,   747,   364,   452,
+     712,   168,   441,    -1,    -1,    -1,    -1,   719,   720,    -1,
+     722,    -1,    -1,    -1,    43,    -1,    45,    -1,   730,   731,
+      49,    -1,    -1,    52,    -1,   737,   738,    -1,    -1,   350,
+      -1,    -1,   744,   745,   746,    -1,    -1,    -1,   350,    -1,
+      -1,    -1,    -1,    21,   756,    23,    24,    25,    26,    27,
+      28,    -1,   764,    -1,    -1,    -1,   768,   350,    75,    -1,
+      77,    39,    16,    17,    18,    19,    20,    -1,    22,    23,
+      24,    -1,    26,    27,    28,   342,    -1,    31,    32,    33,
+      34,    35,    36,    -1,   351,    -1,    -1,    -1,    66,    67,
+      68,    -1,    70,    -1,    -1,    73,    -1,    -1,    76,    -1,
+      -1,   268,   269,   270,   271,    -1,    -1,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    92,    -1,    -1,    -1,   147,    97,
+      98,    99,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     108,    -1,    -1,    -1,    -1,   113,    -1,   849,    -1,   851,
+     852,   853,   854,   855,   856,   857,    -1,   859,    -1,    -1,
+      -1,   168,   169,   170,    -1,    -1,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,   880,    -1,
+      -1,    -1,    -1,   151,   886,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    31,    32,    33,    34,    35,    36,
+     902,    -1,    -1,    -1,    -1,    -1,   908,   909,   910,   911,
+     912,   958,    -1,    16,    17,    18,    19,    20,    -1,    22,
+      23,    24,    -1,    26,    27,    28,    -1,    -1,    31,    32,
+      33,    34,    35,    36,   936,    -1,    -1,   939,    -1,    -1,
+     942,    -1,    -1,    -1,    -1,   947,    -1,   949,    -1,   951,
+      -1,    -1,    -1,   955,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   966,    -1,    -1,   235,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   973,   978,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   292,    -1,   985,   986,   987,
+     988,   989,   990,    -1,    -1,    -1,   264,    -1,    -1,   352,
+      -1,    -1,    -1,    -1,  1006,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   285,   286,    -1,
+      -1,    -1,    -1,    -1,    -1,  1023,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,    -1,    10,    11,    12,    -1,    14,
+      15,    -1,    -1,    -1,   332,   333,    21,    -1,    -1,    -1,
+      -1,    -1,    -1,   341,    -1,    -1,    -1,    -1,    33,    34,
+      -1,   349,    -1,    -1,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    -1,
+     368,   369,    -1,    -1,    -1,    -1,    -1,    -1,   352,    -1,
+       6,    -1,    -1,   381,   382,   383,   384,    -1,   386,   387,
+     388,   389,    -1,   391,   392,    -1,    -1,    -1,   396,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   405,   406,    -1,
+     408,    -1,    38,    -1,   412,    -1,    42,    -1,    -1,    -1,
+      16,    17,    18,    19,    20,    -1,    22,    23,    24,   427,
+      26,    27,    28,    -1,   432,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+       7,     8,    -1,    10,    11,    12,    -1,    14,    15,   144,
+     145,   146,    -1,    21,    21,    23,    24,    25,    26,    27,
+      28,    -1,    -1,    -1,   100,   101,    33,    34,    -1,    -1,
+      -1,    39,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    -1,    -1,   125,
+     126,   127,   128,    -1,    -1,    -1,    -1,    -1,    66,    67,
+      68,    -1,    70,    -1,    -1,    73,    -1,   143,    76,   352,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    85,    86,    -1,
+      -1,    -1,    -1,   531,    92,    -1,    -1,    -1,    -1,    97,
+      98,    99,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     108,    -1,    -1,    -1,    -1,   113,    -1,   555,   184,    -1,
+      -1,    -1,    -1,    -1,   562,   563,   564,    -1,    -1,    -1,
+      -1,    -1,    -1,   571,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   144,   145,   146,
+      -1,    -1,    -1,   151,    -1,    -1,   594,   595,    -1,     3,
+       4,     5,     6,     7,     8,    -1,    10,    11,    12,   607,
+      14,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    -1,
+      -1,    -1,    -1,   621,   622,    -1,   624,    -1,    -1,    33,
+      34,    -1,    -1,    -1,    -1,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      -1,    -1,     1,    -1,    -1,    -1,    -1,    -1,   343,   344,
+     345,    -1,    11,    -1,    -1,   350,   351,    -1,   294,   295,
+      -1,   669,   670,   671,     1,    -1,    -1,   235,    -1,    -1,
+      -1,    -1,    -1,    -1,    11,    -1,    -1,    -1,    -1,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   264,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   721,    -1,   723,    -1,   285,   286,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,    -1,   352,   755,    -1,    -1,
+      -1,    -1,    -1,   761,    -1,   763,    -1,   765,   766,   767,
+      -1,   769,   770,    -1,   332,   333,   774,    -1,    -1,    -1,
+      -1,    -1,    -1,   341,    -1,    -1,   343,   344,   345,    -1,
+      -1,   349,    -1,    -1,   351,    -1,    -1,    16,    17,    18,
+      19,    20,    -1,    22,    23,    24,    -1,    26,    27,    28,
+     368,   369,    31,    32,    33,    34,    35,    36,    -1,    -1,
+      -1,    -1,    -1,   381,   382,   383,   384,    -1,   386,   387,
+     388,   389,    -1,   391,   392,    -1,    -1,    -1,   396,    -1,
+      -1,    -1,    -1,   170,    -1,   172,    -1,   405,   406,    -1,
+     408,    -1,    -1,    -1,   412,   182,   183,   184,   185,   186,
+     187,   188,   189,   190,   191,   192,   193,   194,   195,   427,
+      -1,    -1,    -1,    -1,   432,   224,   225,   226,   227,   228,
+     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
+     239,   240,   241,   242,    -1,   244,   245,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,    -1,   917,
+      -1,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   349,    -1,   351,    -1,    -1,
+      -1,    16,    17,    18,    19,    20,    -1,    22,    23,    24,
+     958,    26,    27,    28,    -1,    -1,    31,    32,    33,    34,
+      35,    36,    -1,   531,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,    -1,    10,    11,    12,    -1,    14,
+      15,    -1,    -1,    -1,    -1,    -1,    21,   555,    -1,    -1,
+      -1,    -1,    -1,    -1,   562,   563,   564,    -1,    33,    34,
+      -1,    -1,    -1,   571,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   594,   595,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,     7,     8,   607,
+      10,    11,    12,    -1,    14,    15,    -1,    -1,    -1,    -1,
+      -1,    21,    -1,   621,   622,    -1,   624,    -1,    -1,    -1,
+      -1,    -1,    -1,    33,    34,   350,    -1,    -1,    -1,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    -1,    -1,     3,     4,     5,     6,
+       7,     8,    -1,    10,    11,    12,    -1,    14,    15,    -1,
+      -1,   669,   670,   671,    21,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    33,    34,    -1,    -1,
+      -1,    -1,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   721,    -1,   723,     0,     1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    11,    12,    13,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   755,    -1,    -1,
+      -1,    -1,    -1,   761,    -1,   763,    -1,   765,   766,   767,
+      -1,   769,   770,    -1,    -1,    -1,   774,    -1,    52,    -1,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    -1,    78,    79,    80,    81,    82,    83,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,    -1,    -1,    -1,    -1,   112,   113,
+      -1,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+      -1,    -1,   136,   137,   138,    -1,    -1,    -1,   142,   143,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   349,    -1,   351,    -1,    -1,   163,
+     164,     3,     4,     5,     6,     7,     8,   171,    10,    11,
+      12,   301,    14,    15,    -1,    -1,    -1,    -1,    -1,    21,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   917,
+      -1,    33,    34,    -1,    -1,    -1,    -1,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   351,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     958,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,
+      -1,   245,    -1,    -1,   248,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   256,    -1,    -1,    -1,    -1,   261,   262,    -1,
+     264,   265,   266,   267,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,   351,    10,    11,    12,    -1,    14,
+      15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    -1,    -1,
+     294,   295,    -1,    -1,    -1,    -1,    -1,    -1,    33,    34,
+     304,    -1,   306,    -1,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    -1,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    -1,   332,    -1,
+      -1,    -1,    -1,    -1,    -1,   339,   340,   341,     3,     4,
+       5,     6,     7,     8,   348,    10,    11,    12,    -1,    14,
+      15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    34,
+      -1,    -1,    -1,    -1,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,     3,
+       4,     5,     6,     7,     8,    -1,    10,    11,    12,    -1,
+      14,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      34,    -1,    -1,    -1,    -1,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+       3,     4,     5,     6,     7,     8,    -1,    10,    11,    12,
+      -1,    14,    15,    -1,    -1,    -1,    -1,    -1,    21,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    34,    -1,    -1,    -1,    -1,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    -1,     3,     4,     5,     6,     7,     8,    -1,    10,
+      11,    12,    -1,    14,    15,    -1,    -1,    -1,    -1,   351,
+      21,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    33,    34,    -1,    -1,    -1,    -1,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,     3,     4,     5,     6,     7,     8,    -1,
+      10,    11,    12,    -1,    14,    15,    -1,    -1,    -1,    -1,
+      -1,    21,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    33,    34,    -1,    -1,    -1,    -1,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,     3,     4,     5,     6,     7,     8,
+      -1,    10,    11,    12,    -1,    14,    15,    -1,    -1,    -1,
+      -1,    -1,    21,    -1,    -1,    -1,   351,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    33,    34,    -1,    -1,    -1,    -1,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    -1,    -1,     1,    -1,    -1,
+       4,     3,     4,     5,     6,     7,     8,    11,    10,    11,
+      12,    -1,    14,    15,    -1,    -1,    -1,    -1,    -1,    21,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    33,    34,    -1,    -1,    -1,   351,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    76,    -1,    78,    -1,    80,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   351,    92,    93,
+      -1,    -1,    -1,    -1,    -1,    99,    -1,    -1,   102,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   123,
+     124,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   351,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   162,   307,
+     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     351,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   350,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    11,    12,    13,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   351,    -1,    -1,    -1,    -1,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    52,    -1,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,   351,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,    -1,    -1,    -1,    -1,   112,   113,   333,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   351,
+      -1,   136,   137,   138,    -1,    -1,    -1,   142,   143,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   163,   164,
+      -1,    -1,    -1,    -1,    -1,    -1,   171,   196,   197,   198,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,
+     245,    -1,    -1,   248,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   256,    -1,    -1,    -1,    -1,   261,   262,    -1,   264,
+     265,   266,   267,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   294,
+     295,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   304,
+      -1,   306,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   328,   329,    -1,    -1,   332,    -1,    -1,
+      -1,    -1,    -1,    -1,   339,   340,   341,    -1,    -1,    -1,
+      -1,    -1,    -1,   348
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   355,     0,     1,    11,    12,    13,    52,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     107,   112,   113,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   136,   137,   138,   142,   143,   163,   164,   171,
+     243,   245,   248,   256,   261,   262,   264,   265,   266,   267,
+     294,   295,   304,   306,   328,   329,   332,   339,   340,   341,
+     348,   356,   357,    25,     3,     4,     5,     6,     7,     8,
+      10,    11,    12,    14,    15,    21,    33,    34,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,   351,   372,   373,   374,   375,   376,   377,
+     378,   351,    11,   377,   377,   351,     3,     3,    12,   381,
+     370,   372,   434,   370,   435,   370,     1,     4,    11,   134,
+     135,   438,   434,   370,   436,   434,   376,   378,   434,   378,
+     378,   378,   378,   378,   351,   359,   378,   379,   380,   360,
+     361,   362,   349,   358,   434,   370,   434,   370,     3,   371,
+     372,   378,   434,   434,   372,   373,   434,   434,   436,   436,
+     436,   434,   434,   434,   364,   366,   436,   436,   349,   436,
+     434,   434,   434,   434,   434,   349,   349,   349,   434,     3,
+       3,   379,   379,   379,   367,   349,   378,   349,   349,   378,
+     370,   370,   378,   434,   434,   434,   434,   434,     3,     1,
+       6,    11,   134,   139,   140,   439,     1,     6,    11,   134,
+     135,   140,   440,   378,   147,   378,   434,   434,   349,   434,
+     434,   378,   368,   434,    98,   365,   378,   378,   378,   373,
+     373,   369,   370,   437,   349,   349,   349,   349,   436,   378,
+     434,   348,   357,   379,   351,   351,   372,   372,   372,   372,
+     351,   351,   351,   351,   351,   351,   351,   351,   351,   351,
+     351,   351,   351,   351,   372,    16,    17,    18,    19,    20,
+      22,    23,    24,    26,    27,    28,    31,    32,    33,    34,
+      35,    36,    29,    30,   379,   370,   353,   353,   353,   372,
+     349,   353,   349,   349,   349,     1,    11,   246,   247,   249,
+     392,   393,   349,     3,   349,   349,     1,     3,    11,   108,
+     109,   110,   111,   351,   430,   431,     1,    11,   165,   166,
+     167,   411,   412,   307,   308,   309,   310,   311,   312,   313,
+     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   386,   387,   334,   335,   336,   337,
+     338,   388,   389,   349,   378,   196,   197,   198,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   382,
+     383,   220,   221,   222,   223,   384,   385,   378,   363,   346,
+     347,   441,   442,   349,   349,   349,   349,     1,     3,    11,
+     301,   351,   432,   433,   378,   378,   370,   372,   372,   378,
+     378,   378,   379,   378,   378,   378,   378,   378,   378,   378,
+     378,   379,   377,   352,   372,   372,   372,   372,   372,   372,
+     372,   372,   372,   372,   372,   372,   372,   372,   372,   372,
+     372,   378,   378,   352,   352,   351,    12,    12,   352,     1,
+       4,    11,    75,    76,    78,    80,    92,    93,    99,   102,
+     123,   124,   162,   250,   251,   252,   253,   254,   255,   256,
+     257,   258,   259,   260,   261,   333,   394,   395,   380,     1,
+      11,   170,   172,   182,   183,   184,   185,   186,   187,   188,
+     189,   190,   191,   192,   193,   194,   195,   396,   397,     1,
+      11,    75,    77,   168,   169,   170,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   292,   413,   414,     1,    11,
+     141,   148,   398,   399,   434,   370,   378,   350,   393,     1,
+      11,   224,   225,   226,   227,   228,   229,   230,   231,   232,
+     233,   234,   235,   236,   237,   238,   239,   240,   241,   242,
+     244,   245,   390,   391,     1,     3,    11,   170,   296,   297,
+     298,   299,   300,   301,   302,   303,   351,   422,   423,     1,
+      11,   165,   272,   273,   279,   421,   370,   370,   370,   370,
+     370,   350,   431,   378,   378,   350,   412,   370,   370,   370,
+     370,   370,   370,   436,   370,   378,   378,   378,   378,   370,
+     378,   378,   378,   378,   434,   378,   378,   434,   350,   387,
+     378,   370,   370,   370,   370,   350,   389,     1,    11,   121,
+     165,   170,   287,   288,   289,   290,   291,   292,   293,   417,
+     418,   350,   378,   378,   434,   378,   370,   434,   378,   434,
+     370,     3,   370,   434,   434,   370,   434,   370,     3,   370,
+     434,   434,   378,   434,   350,   383,   370,   378,   370,   434,
+     350,   385,   349,    11,    11,   350,   442,     1,    11,   168,
+     268,   269,   270,   271,   415,   416,     1,     3,    11,   263,
+     301,   351,   424,   425,     1,     3,    11,   301,   351,   426,
+     427,     1,     3,    11,   301,   305,   351,   428,   429,     3,
+     370,   370,   350,   433,   350,   330,    25,   352,   352,   352,
+     352,   353,   352,   353,   353,   353,   353,   353,   353,   353,
+     353,   352,   352,   370,   351,   434,   434,   434,   434,   434,
+     434,   434,   434,   434,   434,   434,   434,   434,   434,   434,
+     434,   434,   434,   434,   434,   434,   434,   434,   434,   350,
+     395,   378,   370,   434,   350,   397,   370,   370,   370,   378,
+     378,   378,   378,   350,   414,   434,   378,   350,   399,     6,
+       6,     9,   370,   370,   370,   378,   378,   350,   391,   378,
+     370,   370,     3,   370,   370,   350,   423,   378,   378,    11,
+     378,   419,   352,   378,   378,   378,   350,   418,     3,   353,
+       3,   353,   144,   145,   146,   343,   344,   345,   370,   400,
+     401,   370,   370,   378,   370,   378,   350,   416,     3,   370,
+     370,   350,   425,     3,   370,   370,   350,   427,     3,   370,
+     301,   370,   370,   350,   429,     3,   353,   352,   378,   370,
+     378,   378,   370,   378,   378,   378,   370,   378,   378,   352,
+     378,     3,   353,   352,     3,     1,    11,   272,   274,   275,
+     276,   277,   278,   280,   281,   282,   283,   284,   285,   286,
+     292,   350,   420,   370,     3,   370,   370,   370,   370,   370,
+     370,   370,    25,   350,   401,     3,   353,   352,     3,   353,
+     352,     3,   353,     3,   370,   352,   370,   331,   350,   353,
+     352,   353,   352,   352,   352,   353,   352,   352,   353,   370,
+     370,   370,   370,   370,   370,   378,   353,    25,    25,    25,
+      25,    25,    25,   405,   370,   370,   370,     3,   353,   370,
+     370,   370,   370,   379,   370,   406,   407,   408,   403,   402,
+     404,     3,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   342,   351,   377,   409,   410,
+     370,   350,   352,   352,   352,   352,   409,   409,   409,   409,
+     409,   409,   370,   353,   352,   410
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   354,   355,   355,   355,   356,   356,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   358,   357,   357,   357,   357,   357,   359,   357,
+     360,   357,   357,   361,   357,   362,   357,   363,   357,   357,
+     357,   364,   357,   357,   365,   357,   366,   357,   367,   357,
+     357,   357,   368,   357,   357,   357,   357,   357,   357,   357,
+     369,   357,   357,   357,   357,   357,   357,   357,   357,   357,
+     357,   357,   357,   370,   371,   372,   372,   372,   372,   372,
+     372,   372,   372,   372,   372,   372,   372,   372,   373,   373,
+     373,   373,   373,   373,   373,   373,   373,   373,   373,   373,
+     373,   373,   373,   373,   373,   374,   374,   374,   374,   374,
+     374,   374,   374,   374,   374,   374,   374,   374,   374,   374,
+     374,   375,   375,   376,   377,   378,   378,   378,   378,   378,
+     378,   379,   379,   380,   380,   381,   381,   382,   382,   383,
+     383,   383,   383,   383,   383,   383,   383,   383,   383,   383,
+     383,   383,   383,   383,   383,   383,   383,   383,   383,   383,
+     383,   383,   383,   383,   383,   383,   383,   383,   384,   384,
+     385,   385,   385,   385,   386,   386,   387,   387,   387,   387,
+     387,   387,   387,   387,   387,   387,   387,   387,   387,   387,
+     387,   387,   387,   387,   387,   387,   387,   388,   388,   389,
+     389,   389,   389,   389,   390,   390,   391,   391,   391,   391,
+     391,   391,   391,   391,   391,   391,   391,   391,   391,   391,
+     391,   391,   391,   391,   391,   391,   391,   391,   391,   391,
+     391,   392,   392,   393,   393,   393,   393,   393,   394,   394,
+     395,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   395,   395,   395,   395,   395,   395,
+     395,   395,   395,   395,   395,   395,   395,   396,   396,   397,
+     397,   397,   397,   397,   397,   397,   397,   397,   397,   397,
+     397,   397,   397,   397,   397,   397,   397,   398,   398,   399,
+     399,   399,   399,   400,   400,   402,   401,   403,   401,   404,
+     401,   405,   401,   406,   401,   407,   401,   408,   401,   409,
+     409,   410,   410,   410,   410,   410,   410,   410,   410,   410,
+     410,   410,   410,   410,   410,   410,   410,   410,   411,   411,
+     412,   412,   412,   412,   412,   413,   413,   414,   414,   414,
+     414,   414,   414,   414,   414,   414,   414,   414,   414,   414,
+     414,   414,   414,   414,   415,   415,   416,   416,   416,   416,
+     416,   416,   416,   417,   417,   418,   418,   418,   418,   418,
+     418,   418,   418,   418,   418,   418,   418,   419,   419,   420,
+     420,   420,   420,   420,   420,   420,   420,   420,   420,   420,
+     420,   420,   420,   420,   420,   421,   421,   421,   421,   421,
+     421,   421,   422,   422,   423,   423,   423,   423,   423,   423,
+     423,   423,   423,   423,   423,   423,   423,   423,   424,   424,
+     425,   425,   425,   425,   425,   425,   425,   426,   426,   427,
+     427,   427,   427,   427,   427,   428,   428,   429,   429,   429,
+     429,   429,   429,   429,   429,   429,   430,   430,   431,   431,
+     431,   431,   431,   431,   431,   431,   432,   432,   433,   433,
+     433,   433,   433,   433,   434,   435,   436,   437,   438,   438,
+     438,   438,   438,   439,   439,   439,   439,   439,   439,   440,
+     440,   440,   440,   440,   440,   441,   441,   442,   442
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     3,     1,     2,     4,     2,     2,
+       2,     2,     4,     6,     9,     4,     3,     2,     2,     2,
+       2,     2,     2,     4,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     4,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     0,     5,     2,     2,     4,     2,     0,     5,
+       0,     5,     4,     0,     5,     0,     5,     0,     6,     2,
+       3,     0,     5,     5,     0,     5,     0,     6,     0,     5,
+       4,     8,     0,     5,     4,     4,     2,     4,     2,     4,
+       0,     5,     2,     4,     6,     2,     2,     2,     2,     2,
+       2,     1,     1,     1,     1,     1,     1,     1,     3,     3,
+       3,     3,     2,     2,     3,     3,     1,     3,     1,     3,
+       3,     3,     2,     1,     4,     4,     4,     8,     6,     6,
+       6,     6,     6,     6,     1,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     2,     1,     1,     1,     1,
+       4,     1,     4,     1,     1,     1,     4,     8,     8,     4,
+       1,     1,     3,     1,     3,     1,     3,     1,     2,     2,
+       2,     2,     2,     2,     1,     1,     2,     2,     2,     1,
+       1,     1,     2,     3,     4,     2,     2,     2,     2,     2,
+       3,     4,     4,     6,     2,     2,     2,     2,     1,     2,
+       2,     2,     2,     2,     1,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     1,     2,     2,
+       2,     2,     2,     2,     1,     2,     1,     1,     1,     1,
+       1,     2,     2,     1,     2,     1,     2,     1,     1,     2,
+       2,     1,     1,     2,     2,     1,     1,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     1,     1,     1,     2,
+       2,     1,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     1,     1,     1,     2,     2,
+       1,     1,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     1,     1,     1,     2,     2,
+       2,     1,     1,     1,     2,     0,     5,     0,     5,     0,
+       5,     0,     4,     0,     5,     0,     5,     0,     5,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     1,     2,
+       2,     2,     1,     1,     1,     1,     2,     2,     1,     1,
+       1,     1,     1,     1,     2,     2,     2,     1,     2,     2,
+       2,     1,     1,     1,     1,     2,     2,     2,     2,     2,
+       2,     1,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     2,     2,     2,     1,     1,     0,     2,     1,
+       1,     1,     1,     1,     2,     2,     2,     2,     2,     1,
+       2,     1,     1,     1,     1,     2,     2,     3,     2,     2,
+       1,     1,     1,     2,     1,     3,     3,     4,     1,     1,
+       1,     2,     2,     1,     1,     2,     1,     1,     1,     2,
+       1,     3,     3,     4,     1,     1,     1,     1,     2,     1,
+       3,     3,     4,     1,     1,     1,     2,     1,     3,     2,
+       3,     4,     4,     5,     1,     1,     1,     2,     1,     3,
+       2,     2,     2,     2,     1,     1,     1,     2,     1,     3,
+       3,     4,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 7: /* line: CHARSET '{' charset_flags '}'  */
+#line 348 "parser.y"
+                                              {}
+#line 2861 "parser.c"
+    break;
+
+  case 8: /* line: HOGTHRESH expression  */
+#line 350 "parser.y"
+                                        { config.hogthreshold = (yyvsp[0].i_value); }
+#line 2867 "parser.c"
+    break;
+
+  case 9: /* line: TICKLESS_IDLE bool  */
+#line 351 "parser.y"
+                                        { config.tickless_idle = ((yyvsp[0].i_value)!=0); }
+#line 2873 "parser.c"
+    break;
+
+  case 10: /* line: DEFINE string_unquoted  */
+#line 352 "parser.y"
+                                        { define_config_variable((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 2879 "parser.c"
+    break;
+
+  case 11: /* line: UNDEF string_unquoted  */
+#line 353 "parser.y"
+                                        { undefine_config_variable((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 2885 "parser.c"
+    break;
+
+  case 12: /* line: IFSTATEMENT '(' expression ')'  */
+#line 354 "parser.y"
+                                                 {
+			/* NOTE:
+			 * We _need_ absolutely to return to state stack 0
+			 * because we 'backward' modify the input stream for
+			 * the parser (in lexer). Hence, _if_ the parser needs
+			 * to read one token more than needed, we are lost,
+			 * because we can't discard it. So please, don't
+			 * play with the grammar without knowing what you do.
+			 * The ')' _will_ return to state stack 0, but fiddling
+			 * with brackets '()' in the underlaying 'expression'
+			 * rules may distroy this.
+			 *                          -- Hans 971231
+			 */
+			tell_lexer_if((yyvsp[-1].i_value));
+		}
+#line 2905 "parser.c"
+    break;
+
+  case 13: /* line: WHILESTATEMENT INTEGER ',' '(' expression ')'  */
+#line 376 "parser.y"
+                                                                {
+			tell_lexer_loop((yyvsp[-4].i_value), (yyvsp[-1].i_value));
+		}
+#line 2913 "parser.c"
+    break;
+
+  case 14: /* line: FOREACHSTATEMENT INTEGER ',' VARIABLE '(' string_expr ',' strarglist ')'  */
+#line 379 "parser.y"
+                                                                                           {
+			tell_lexer_loop((yyvsp[-7].i_value), for_each_handling((yyvsp[-7].i_value),(yyvsp[-5].s_value),(yyvsp[-3].s_value),(yyvsp[-1].s_value)));
+			free((yyvsp[-5].s_value)); free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 2922 "parser.c"
+    break;
+
+  case 15: /* line: SHELL '(' strarglist ')'  */
+#line 383 "parser.y"
+                                           {
+			char *s = run_shell((yyvsp[-1].s_value));
+			if (s) free(s);
+			free((yyvsp[-1].s_value));
+		}
+#line 2932 "parser.c"
+    break;
+
+  case 16: /* line: VARIABLE '=' strarglist  */
+#line 388 "parser.y"
+                                          {
+		    if (!parser_version_3_style_used) {
+			parser_version_3_style_used = 1;
+			define_config_variable(CONFNAME_V3USED);
+		    }
+		    if ((strpbrk((yyvsp[-2].s_value), "uhc") == (yyvsp[-2].s_value)) && ((yyvsp[-2].s_value)[1] == '_'))
+			yyerror("reserved variable %s can't be set\n", (yyvsp[-2].s_value));
+		    else
+			setenv((yyvsp[-2].s_value), (yyvsp[0].s_value), 1);
+		    free((yyvsp[-2].s_value)); free((yyvsp[0].s_value));
+		}
+#line 2948 "parser.c"
+    break;
+
+  case 18: /* line: EXPRTEST typed_expr  */
+#line 400 "parser.y"
+                                      {
+		    if ((yyvsp[0].t_value).type == TYPE_REAL)
+			c_printf("CONF TESTING: exprtest real %f\n", (yyvsp[0].t_value).value.r);
+		    else
+			c_printf("CONF TESTING: exprtest int %d\n", (yyvsp[0].t_value).value.i);
+		}
+#line 2959 "parser.c"
+    break;
+
+  case 19: /* line: ABORT strarglist  */
+#line 411 "parser.y"
+                    { if ((yyvsp[0].s_value)[0]) fprintf(stderr,"CONF aborted with: %s\n", (yyvsp[0].s_value));
+			exit(99);
+		    }
+#line 2967 "parser.c"
+    break;
+
+  case 20: /* line: ERROR strarglist  */
+#line 414 "parser.y"
+                                   { if ((yyvsp[0].s_value)[0]) fprintf(stderr, "%s\n", (yyvsp[0].s_value)); }
+#line 2973 "parser.c"
+    break;
+
+  case 21: /* line: WARN strarglist  */
+#line 415 "parser.y"
+                                        { warn("CONF: %s\n", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 2979 "parser.c"
+    break;
+
+  case 22: /* line: EMUSYS string_expr  */
+#line 417 "parser.y"
+                    {
+		    free(config.emusys); config.emusys = (yyvsp[0].s_value);
+		    c_printf("CONF: config.emusys = '%s'\n", (yyvsp[0].s_value));
+		    }
+#line 2988 "parser.c"
+    break;
+
+  case 23: /* line: EMUSYS '{' string_expr '}'  */
+#line 422 "parser.y"
+                    {
+		    free(config.emusys); config.emusys = (yyvsp[-1].s_value);
+		    c_printf("CONF: config.emusys = '%s'\n", (yyvsp[-1].s_value));
+		    }
+#line 2997 "parser.c"
+    break;
+
+  case 24: /* line: DOSEMUMAP string_expr  */
+#line 427 "parser.y"
+                    {
+		    free(dosemu_map_file_name);
+		    dosemu_map_file_name = (yyvsp[0].s_value);
+		    c_printf("CONF: dosemu.map path = '%s'\n", (yyvsp[0].s_value));
+		    }
+#line 3007 "parser.c"
+    break;
+
+  case 25: /* line: MAPPINGDRIVER string_expr  */
+#line 433 "parser.y"
+                    {
+		    free(config.mappingdriver); config.mappingdriver = (yyvsp[0].s_value);
+		    c_printf("CONF: mapping driver = '%s'\n", (yyvsp[0].s_value));
+		    }
+#line 3016 "parser.c"
+    break;
+
+  case 26: /* line: FILE_LOCK_LIMIT INTEGER  */
+#line 438 "parser.y"
+                    {
+		    config.file_lock_limit = (yyvsp[0].i_value);
+		    }
+#line 3024 "parser.c"
+    break;
+
+  case 27: /* line: FILE_OPEN_LIMIT INTEGER  */
+#line 442 "parser.y"
+                    {
+		    config.file_open_limit = (yyvsp[0].i_value);
+		    }
+#line 3032 "parser.c"
+    break;
+
+  case 28: /* line: LFN_SUPPORT bool  */
+#line 446 "parser.y"
+                    {
+		    config.lfn = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3040 "parser.c"
+    break;
+
+  case 29: /* line: FINT_REVECT bool  */
+#line 450 "parser.y"
+                    {
+		    config.force_revect = ((yyvsp[0].i_value) == -2 ? 1 : (yyvsp[0].i_value));
+		    }
+#line 3048 "parser.c"
+    break;
+
+  case 30: /* line: SET_INT_HOOKS bool  */
+#line 454 "parser.y"
+                    {
+		    config.int_hooks = ((yyvsp[0].i_value) == -2 ? 1 : (yyvsp[0].i_value));
+		    }
+#line 3056 "parser.c"
+    break;
+
+  case 31: /* line: TRACE_IRETS bool  */
+#line 458 "parser.y"
+                    {
+		    config.trace_irets = ((yyvsp[0].i_value) == -2 ? 1 : (yyvsp[0].i_value));
+		    }
+#line 3064 "parser.c"
+    break;
+
+  case 32: /* line: FFS_REDIR bool  */
+#line 462 "parser.y"
+                    {
+		    config.force_redir = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3072 "parser.c"
+    break;
+
+  case 33: /* line: FASTFLOPPY floppy_bool  */
+#line 466 "parser.y"
+                        {
+			config.fastfloppy = ((yyvsp[0].i_value)!=0);
+			c_printf("CONF: fastfloppy = %d\n", config.fastfloppy);
+			}
+#line 3081 "parser.c"
+    break;
+
+  case 34: /* line: CPU expression  */
+#line 471 "parser.y"
+                        {
+			int cpu = cpu_override (((yyvsp[0].i_value)%100)==86?((yyvsp[0].i_value)/100)%10:0);
+			if (cpu > 0) {
+				c_printf("CONF: CPU set to %d86\n",cpu);
+				vm86s.cpu_type = cpu;
+			}
+			else
+				yyerror("error in CPU user override\n");
+			}
+#line 3095 "parser.c"
+    break;
+
+  case 35: /* line: CPU_VM cpu_vm  */
+#line 481 "parser.y"
+                        {
+			config.cpu_vm = (yyvsp[0].i_value);
+			c_printf("CONF: CPU VM set to %d\n", config.cpu_vm);
+			}
+#line 3104 "parser.c"
+    break;
+
+  case 36: /* line: CPU_VM_DPMI cpu_vm_dpmi  */
+#line 486 "parser.y"
+                        {
+			config.cpu_vm_dpmi = (yyvsp[0].i_value);
+			c_printf("CONF: CPU VM set to %d for DPMI\n",
+				 config.cpu_vm_dpmi);
+			}
+#line 3114 "parser.c"
+    break;
+
+  case 37: /* line: CPUEMU INTEGER  */
+#line 492 "parser.y"
+                        {
+#ifdef X86_EMULATOR
+			config.cpusim = (yyvsp[0].i_value);
+			c_printf("CONF: CPUEMU set to %s\n",
+				config.cpusim ? "sim" : "jit");
+#endif
+			}
+#line 3126 "parser.c"
+    break;
+
+  case 38: /* line: CPUSPEED real_expression  */
+#line 500 "parser.y"
+                        { 
+#if 0 /* no longer used, but left in for dosemu.conf compatibility */
+			if (config.realcpu >= CPU_586) {
+			  config.cpu_spd = ((double)LLF_US)/(yyvsp[0].r_value);
+			  config.cpu_tick_spd = ((double)LLF_TICKS)/(yyvsp[0].r_value);
+			  c_printf("CONF: CPU speed = %g\n", ((double)(yyvsp[0].r_value)));
+			}
+#endif
+			}
+#line 3140 "parser.c"
+    break;
+
+  case 39: /* line: CPUSPEED INTEGER INTEGER  */
+#line 510 "parser.y"
+                        { 
+#if 0 /* no longer used, but left in for dosemu.conf compatibility */
+			if (config.realcpu >= CPU_586) {
+			  config.cpu_spd = (LLF_US*(yyvsp[0].i_value))/(yyvsp[-1].i_value);
+			  config.cpu_tick_spd = (LLF_TICKS*(yyvsp[0].i_value))/(yyvsp[-1].i_value);
+			  c_printf("CONF: CPU speed = %d/%d\n", (yyvsp[-1].i_value), (yyvsp[0].i_value));
+			}
+#endif
+			}
+#line 3154 "parser.c"
+    break;
+
+  case 40: /* line: PCI bool  */
+#line 520 "parser.y"
+                    {
+		      config.pci_video = ((yyvsp[0].i_value)!=0);
+		      config.pci = (abs((yyvsp[0].i_value))==2); 
+		    }
+#line 3163 "parser.c"
+    break;
+
+  case 41: /* line: BOOTDRIVE string_expr  */
+#line 525 "parser.y"
+                    {
+                      if ((yyvsp[0].s_value)[0] == 0) {
+		        config.hdiskboot = -1;
+		      } else if ((yyvsp[0].s_value)[0] >= 'a') {
+		        config.hdiskboot = (yyvsp[0].s_value)[0] - 'a';
+		      } else {
+		        error("wrong value for $_bootdrive\n");
+		        config.hdiskboot = -1;
+		      }
+		      free((yyvsp[0].s_value));
+		    }
+#line 3179 "parser.c"
+    break;
+
+  case 42: /* line: SWAP_BOOTDRIVE bool  */
+#line 537 "parser.y"
+                    {
+		      config.swap_bootdrv = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3187 "parser.c"
+    break;
+
+  case 43: /* line: DISK_URING bool  */
+#line 541 "parser.y"
+                    {
+		      config.disk_uring = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3195 "parser.c"
+    break;
+
+  case 44: /* line: DISK_CACHE int_expr  */
+#line 545 "parser.y"
+                    {
+		      config.disk_cache = (yyvsp[0].i_value);
+		    }
+#line 3203 "parser.c"
+    break;
+
+  case 45: /* line: DISK_CACHE_WB bool  */
+#line 549 "parser.y"
+                    {
+		      config.disk_cache_wb = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3211 "parser.c"
+    break;
+
+  case 46: /* line: FATFS_WRITE bool  */
+#line 553 "parser.y"
+                    {
+		      config.fatfs_write = ((yyvsp[0].i_value)!=0);
+		    }
+#line 3219 "parser.c"
+    break;
+
+  case 47: /* line: DEFAULT_DRIVES int_expr  */
+#line 557 "parser.y"
+                    {
+		      c_printf("default_drives %i\n", (yyvsp[0].i_value));
+		      switch ((yyvsp[0].i_value)) {
+		      case 0:
+		        set_drive_c();
+		        break;
+		      case 1:
+		        set_dosemu_drive();
+		        set_default_drives();
+		        break;
+		      case 2:
+		        set_dosemu_drive();
+		        break;
+		      default:
+			error("Path group %i not implemented\n", (yyvsp[0].i_value));
+			exit(1);
+		      }
+		    }
+#line 3242 "parser.c"
+    break;
+
+  case 48: /* line: SKIP_DRIVES int_expr  */
+#line 576 "parser.y"
+                    {
+		      c_printf("skip %i drives from %i\n", (yyvsp[0].i_value), c_hdisks);
+		      config.drives_mask |= ((1 << (yyvsp[0].i_value)) - 1) << (c_hdisks +
+			 skipped_disks + 2);
+		      skipped_disks += (yyvsp[0].i_value);
+		    }
+#line 3253 "parser.c"
+    break;
+
+  case 49: /* line: TIMER expression  */
+#line 583 "parser.y"
+                    {
+		    config.freq = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value)) {
+		        config.update = 1000000 / (yyvsp[0].i_value);
+		    } else {
+			config.update = 54925;
+			config.freq = 18;
+		    }
+		    c_printf("CONF: timer freq=%d, update=%d\n",config.freq,config.update);
+		    }
+#line 3268 "parser.c"
+    break;
+
+  case 50: /* line: LOGBUFSIZE expression  */
+#line 594 "parser.y"
+                    {
+		      char *b;
+		      flush_log();
+		      b = malloc((yyvsp[0].i_value)+1024);
+		      if (!b) {
+			error("cannot get logbuffer\n");
+			exit(1);
+		      }
+		      logptr = logbuf = b;
+		      logbuf_size = (yyvsp[0].i_value);
+		    }
+#line 3284 "parser.c"
+    break;
+
+  case 51: /* line: LOGFILESIZE expression  */
+#line 606 "parser.y"
+                    {
+		      logfile_limit = (yyvsp[0].i_value);
+		    }
+#line 3292 "parser.c"
+    break;
+
+  case 52: /* line: EMURETRACE bool  */
+#line 610 "parser.y"
+                    {
+		    config.emuretrace = ((yyvsp[0].i_value)!=0);
+		    c_printf("CONF: emu_retrace %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3301 "parser.c"
+    break;
+
+  case 54: /* line: L_EMS int_bool  */
+#line 616 "parser.y"
+                    {
+		    if ((yyvsp[0].i_value) >= 0) config.ems_size = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: %dk bytes EMS memory\n", (yyvsp[0].i_value));
+		    }
+#line 3310 "parser.c"
+    break;
+
+  case 55: /* line: UMB_A0 bool  */
+#line 621 "parser.y"
+                    {
+		    config.umb_a0 = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: umb at 0a0000: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3319 "parser.c"
+    break;
+
+  case 56: /* line: UMB_B0 bool  */
+#line 626 "parser.y"
+                    {
+		    config.umb_b0 = ((yyvsp[0].i_value)!=0);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: umb at 0b0000: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3328 "parser.c"
+    break;
+
+  case 57: /* line: UMB_F0 bool  */
+#line 631 "parser.y"
+                    {
+		    config.umb_f0 = ((yyvsp[0].i_value)!=0);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: umb at 0f0000: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3337 "parser.c"
+    break;
+
+  case 58: /* line: HMA bool  */
+#line 636 "parser.y"
+                    {
+		    config.hma = ((yyvsp[0].i_value)!=0);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: HMA is: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3346 "parser.c"
+    break;
+
+  case 59: /* line: DOS_UP bool  */
+#line 641 "parser.y"
+                    {
+		    config.dos_up = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: dos_up: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3355 "parser.c"
+    break;
+
+  case 60: /* line: L_DPMI int_bool  */
+#line 646 "parser.y"
+                    {
+		    if ((yyvsp[0].i_value)>=0) config.dpmi = (yyvsp[0].i_value);
+		    c_printf("CONF: DPMI-Server %s (%#x)\n", ((yyvsp[0].i_value)) ? "on" : "off", ((yyvsp[0].i_value)));
+		    }
+#line 3364 "parser.c"
+    break;
+
+  case 61: /* line: DPMI_BASE int_bool  */
+#line 651 "parser.y"
+                    {
+		    config.dpmi_base = (yyvsp[0].i_value);
+		    c_printf("CONF: DPMI base addr = %#x\n", (yyvsp[0].i_value));
+		    }
+#line 3373 "parser.c"
+    break;
+
+  case 62: /* line: HUGEPAGES bool  */
+#line 656 "parser.y"
+                    {
+		    config.hugepages = ((yyvsp[0].i_value)!=0);
+		    c_printf("CONF: huge pages %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3382 "parser.c"
+    break;
+
+  case 63: /* line: PM_DOS_API bool  */
+#line 661 "parser.y"
+                    {
+		    config.pm_dos_api = ((yyvsp[0].i_value)!=0);
+		    c_printf("CONF: PM DOS API Translator %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3391 "parser.c"
+    break;
+
+  case 64: /* line: NO_NULL_CHECKS bool  */
+#line 666 "parser.y"
+                    {
+		    config.no_null_checks = ((yyvsp[0].i_value)!=0);
+		    c_printf("CONF: No DJGPP NULL deref checks: %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3400 "parser.c"
+    break;
+
+  case 65: /* line: DOSMEM int_bool  */
+#line 670 "parser.y"
+                                        { if ((yyvsp[0].i_value)>=0) config.mem_size = (yyvsp[0].i_value); }
+#line 3406 "parser.c"
+    break;
+
+  case 66: /* line: EXT_MEM int_bool  */
+#line 672 "parser.y"
+                    {
+		    if ((yyvsp[0].i_value)>=0) config.ext_mem = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: %dk bytes int15 ext memory\n", (yyvsp[0].i_value));
+		    }
+#line 3415 "parser.c"
+    break;
+
+  case 67: /* line: L_XMS int_bool  */
+#line 677 "parser.y"
+                    {
+		    if ((yyvsp[0].i_value)>=0) config.xms_size = (yyvsp[0].i_value);
+		    if ((yyvsp[0].i_value) > 0) c_printf("CONF: %dk bytes XMS memory\n", (yyvsp[0].i_value));
+		    }
+#line 3424 "parser.c"
+    break;
+
+  case 68: /* line: MATHCO bool  */
+#line 681 "parser.y"
+                                        { config.mathco = ((yyvsp[0].i_value)!=0); }
+#line 3430 "parser.c"
+    break;
+
+  case 69: /* line: IPXSUPPORT bool  */
+#line 683 "parser.y"
+                    {
+		    config.ipxsup = ((yyvsp[0].i_value)!=0);
+		    c_printf("CONF: IPX support %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3439 "parser.c"
+    break;
+
+  case 70: /* line: IPXNETWORK int_bool  */
+#line 687 "parser.y"
+                                        { config.ipx_net = (yyvsp[0].i_value); }
+#line 3445 "parser.c"
+    break;
+
+  case 71: /* line: PKTDRIVER bool  */
+#line 689 "parser.y"
+                    {
+			config.pktdrv = ((yyvsp[0].i_value)!=0);
+			c_printf("CONF: Packet Driver %s.\n", 
+				((yyvsp[0].i_value)) ? "enabled" : "disabled");
+		    }
+#line 3455 "parser.c"
+    break;
+
+  case 72: /* line: NE2K bool  */
+#line 695 "parser.y"
+                    {
+			config.ne2k = ((yyvsp[0].i_value)!=0);
+			c_printf("CONF: NE2000 %s.\n", 
+				((yyvsp[0].i_value)) ? "enabled" : "disabled");
+		    }
+#line 3465 "parser.c"
+    break;
+
+  case 73: /* line: ETHDEV string_expr  */
+#line 700 "parser.y"
+                                        { free(config.ethdev); config.ethdev = (yyvsp[0].s_value); }
+#line 3471 "parser.c"
+    break;
+
+  case 74: /* line: ETHRING bool  */
+#line 702 "parser.y"
+                    {
+			config.eth_ring = ((yyvsp[0].i_value)!=0);
+			c_printf("CONF: eth rings %s\n", ((yyvsp[0].i_value)) ? "on" : "off");
+		    }
+#line 3480 "parser.c"
+    break;
+
+  case 75: /* line: TAPDEV string_expr  */
+#line 706 "parser.y"
+                                        { free(config.tapdev); config.tapdev = (yyvsp[0].s_value); }
+#line 3486 "parser.c"
+    break;
+
+  case 76: /* line: VDESWITCH string_expr  */
+#line 707 "parser.y"
+                                        { free(config.vdeswitch); config.vdeswitch = (yyvsp[0].s_value); }
+#line 3492 "parser.c"
+    break;
+
+  case 77: /* line: SLIRPARGS string_expr  */
+#line 708 "parser.y"
+                                        { free(config.slirp_args); config.slirp_args = (yyvsp[0].s_value); }
+#line 3498 "parser.c"
+    break;
+
+  case 78: /* line: NETSOCK string_expr  */
+#line 709 "parser.y"
+                                        { free(config.netsock); config.netsock = (yyvsp[0].s_value); }
+#line 3504 "parser.c"
+    break;
+
+  case 79: /* line: NOVELLHACK bool  */
+#line 710 "parser.y"
+                                        { config.pktflags = ((yyvsp[0].i_value)!=0); }
+#line 3510 "parser.c"
+    break;
+
+  case 80: /* line: VNET string_expr  */
+#line 711 "parser.y"
+                                        { start_vnet((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 3516 "parser.c"
+    break;
+
+  case 81: /* line: SPEAKER speaker  */
+#line 713 "parser.y"
+                    {
+		    if ((yyvsp[0].i_value) == SPKR_NATIVE) {
+		      if (can_do_root_stuff) {
+                        c_printf("CONF: allowing speaker port access!\n");
+		      } else {
+                        c_printf("CONF: native speaker not allowed: emulate\n");
+			(yyvsp[0].i_value) = SPKR_EMULATED;
+		      }
+		    }
+		    else
+                      c_printf("CONF: not allowing speaker port access\n");
+		    config.speaker = (yyvsp[0].i_value);
+		    }
+#line 3534 "parser.c"
+    break;
+
+  case 82: /* $@1: %empty  */
+#line 727 "parser.y"
+                    { start_video(); }
+#line 3540 "parser.c"
+    break;
+
+  case 83: /* line: VIDEO $@1 '{' video_flags '}'  */
+#line 729 "parser.y"
+                    { stop_video(); }
+#line 3546 "parser.c"
+    break;
+
+  case 84: /* line: VGA_FONTS bool  */
+#line 731 "parser.y"
+                    { config.vga_fonts = ((yyvsp[0].i_value)!=0); }
+#line 3552 "parser.c"
+    break;
+
+  case 85: /* line: XTERM_TITLE string_expr  */
+#line 732 "parser.y"
+                                          { free(config.xterm_title); config.xterm_title = (yyvsp[0].s_value); }
+#line 3558 "parser.c"
+    break;
+
+  case 86: /* line: TERMINAL '{' term_flags '}'  */
+#line 735 "parser.y"
+                    { stop_terminal(); }
+#line 3564 "parser.c"
+    break;
+
+  case 87: /* line: DEBUG strarglist  */
+#line 736 "parser.y"
+                                   {
+			parse_debugflags((yyvsp[0].s_value), 1);
+			free((yyvsp[0].s_value));
+		}
+#line 3573 "parser.c"
+    break;
+
+  case 88: /* $@2: %empty  */
+#line 741 "parser.y"
+                    { start_debug(); }
+#line 3579 "parser.c"
+    break;
+
+  case 90: /* $@3: %empty  */
+#line 744 "parser.y"
+                    { start_mouse(); }
+#line 3585 "parser.c"
+    break;
+
+  case 91: /* line: MOUSE $@3 '{' mouse_flags '}'  */
+#line 746 "parser.y"
+                    { stop_mouse(); }
+#line 3591 "parser.c"
+    break;
+
+  case 92: /* line: TTYLOCKS '{' ttylocks_flags '}'  */
+#line 749 "parser.y"
+                    { stop_ttylocks(); }
+#line 3597 "parser.c"
+    break;
+
+  case 93: /* $@4: %empty  */
+#line 751 "parser.y"
+                    { start_serial(); }
+#line 3603 "parser.c"
+    break;
+
+  case 94: /* line: SERIAL $@4 '{' serial_flags '}'  */
+#line 753 "parser.y"
+                    { stop_serial(); }
+#line 3609 "parser.c"
+    break;
+
+  case 95: /* $@5: %empty  */
+#line 755 "parser.y"
+                    { start_keyboard(); }
+#line 3615 "parser.c"
+    break;
+
+  case 97: /* $@6: %empty  */
+#line 758 "parser.y"
+                        {keytable_start((yyvsp[0].s_value)); free((yyvsp[0].s_value));}
+#line 3621 "parser.c"
+    break;
+
+  case 98: /* line: KEYTABLE string_expr $@6 '{' keyboard_mods '}'  */
+#line 760 "parser.y"
+                        {keytable_stop();}
+#line 3627 "parser.c"
+    break;
+
+  case 99: /* line: PRESTROKE string_expr  */
+#line 762 "parser.y"
+                    {
+		    append_pre_strokes((yyvsp[0].s_value));
+		    c_printf("CONF: appending pre-strokes '%s'\n", (yyvsp[0].s_value));
+		    free((yyvsp[0].s_value));
+		    }
+#line 3637 "parser.c"
+    break;
+
+  case 100: /* line: KEYTABLE DUMP string_expr  */
+#line 767 "parser.y"
+                                            {
+			dump_keytables_to_file((yyvsp[0].s_value));
+			free((yyvsp[0].s_value));
+		    }
+#line 3646 "parser.c"
+    break;
+
+  case 101: /* $@7: %empty  */
+#line 772 "parser.y"
+                    { start_ports(); }
+#line 3652 "parser.c"
+    break;
+
+  case 104: /* $@8: %empty  */
+#line 776 "parser.y"
+                   { config.mmio_tracing = 1; }
+#line 3658 "parser.c"
+    break;
+
+  case 106: /* $@9: %empty  */
+#line 779 "parser.y"
+                    { start_disk(); }
+#line 3664 "parser.c"
+    break;
+
+  case 107: /* line: DISK $@9 '{' disk_type disk_flags '}'  */
+#line 781 "parser.y"
+                    { stop_disk(DISK); }
+#line 3670 "parser.c"
+    break;
+
+  case 108: /* $@10: %empty  */
+#line 783 "parser.y"
+                    { start_floppy(); }
+#line 3676 "parser.c"
+    break;
+
+  case 109: /* line: L_FLOPPY $@10 '{' floppy_flags '}'  */
+#line 785 "parser.y"
+                    { stop_disk(L_FLOPPY); }
+#line 3682 "parser.c"
+    break;
+
+  case 110: /* line: CDROM '{' string_expr '}'  */
+#line 787 "parser.y"
+                    {
+		    static int which = 0;
+		    if (which >= 3) {
+			c_printf("CONF: too many cdrom drives defined\n");
+			free((yyvsp[-1].s_value));
+		    }
+		    else {
+			Path_cdrom[which] = (yyvsp[-1].s_value);
+			c_printf("CONF: cdrom MSCD000%d on %s\n", which+1 ,(yyvsp[-1].s_value));
+			which++;
+		    }
+		    }
+#line 3699 "parser.c"
+    break;
+
+  case 111: /* line: ASPI '{' string_expr DEVICETYPE string_expr TARGET expression '}'  */
+#line 800 "parser.y"
+                    {
+		    char *s = aspi_add_device((yyvsp[-5].s_value), (yyvsp[-3].s_value), (yyvsp[-1].i_value));
+		    if (s) {
+			c_printf("CONF: aspi available for %s\n", s);
+			free(s);
+		    }
+		    else c_printf("CONF: aspi device %s not available\n", (yyvsp[-5].s_value));
+		    free((yyvsp[-5].s_value));
+		    free((yyvsp[-3].s_value));
+		    }
+#line 3714 "parser.c"
+    break;
+
+  case 112: /* $@11: %empty  */
+#line 811 "parser.y"
+                    { start_printer(); }
+#line 3720 "parser.c"
+    break;
+
+  case 113: /* line: PRINTER $@11 '{' printer_flags '}'  */
+#line 813 "parser.y"
+                    { stop_printer(); }
+#line 3726 "parser.c"
+    break;
+
+  case 116: /* line: SOUND bool  */
+#line 816 "parser.y"
+                                { config.sound = ((yyvsp[0].i_value)!=0); }
+#line 3732 "parser.c"
+    break;
+
+  case 118: /* line: L_JOYSTICK bool  */
+#line 818 "parser.y"
+                                  { if (! (yyvsp[0].i_value)) { config.joy_device[0] = config.joy_device[1] = NULL; } }
+#line 3738 "parser.c"
+    break;
+
+  case 120: /* $@12: %empty  */
+#line 821 "parser.y"
+                    { config.sillyint=0; }
+#line 3744 "parser.c"
+    break;
+
+  case 122: /* line: SILLYINT irq_bool  */
+#line 824 "parser.y"
+                    { if ((yyvsp[0].i_value)) {
+		        config.sillyint = 1 << (yyvsp[0].i_value);
+		        c_printf("CONF: IRQ %d for irqpassing\n", (yyvsp[0].i_value));
+		      }
+		    }
+#line 3754 "parser.c"
+    break;
+
+  case 124: /* line: FEATURE '{' expression '=' expression '}'  */
+#line 832 "parser.y"
+                    {
+			handle_features((yyvsp[-3].i_value), (yyvsp[-1].i_value));
+		    }
+#line 3762 "parser.c"
+    break;
+
+  case 125: /* line: CLI_TIMEOUT int_bool  */
+#line 836 "parser.y"
+                    { config.cli_timeout = (yyvsp[0].i_value); }
+#line 3768 "parser.c"
+    break;
+
+  case 126: /* line: TIMEMODE string_expr  */
+#line 838 "parser.y"
+                    {
+		    config.timemode = parse_timemode((yyvsp[0].s_value));
+		    c_printf("CONF: time mode = '%s'\n", (yyvsp[0].s_value));
+		    free((yyvsp[0].s_value));
+		    }
+#line 3778 "parser.c"
+    break;
+
+  case 127: /* line: TIMER_TWEAKS bool  */
+#line 844 "parser.y"
+                    { config.timer_tweaks = ((yyvsp[0].i_value) != 0); }
+#line 3784 "parser.c"
+    break;
+
+  case 128: /* line: UEXEC string_expr  */
+#line 846 "parser.y"
+                    { free(config.unix_exec); config.unix_exec = (yyvsp[0].s_value); }
+#line 3790 "parser.c"
+    break;
+
+  case 129: /* line: LPATHS string_expr  */
+#line 848 "parser.y"
+                    { free(config.lredir_paths); config.lredir_paths = (yyvsp[0].s_value); }
+#line 3796 "parser.c"
+    break;
+
+  case 130: /* line: HDRIVES string_expr  */
+#line 850 "parser.y"
+                    { set_hostfs_drives((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 3802 "parser.c"
+    break;
+
+  case 131: /* line: STRING  */
+#line 852 "parser.y"
+                    { yyerror("unrecognized command '%s'", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 3808 "parser.c"
+    break;
+
+  case 133: /* expression: typed_expr  */
+#line 856 "parser.y"
+                           { (yyval.i_value) = TOF((yyvsp[0].t_value)); }
+#line 3814 "parser.c"
+    break;
+
+  case 134: /* real_expression: typed_expr  */
+#line 859 "parser.y"
+                           { (yyval.r_value) = TOF((yyvsp[0].t_value)); }
+#line 3820 "parser.c"
+    break;
+
+  case 135: /* typed_expr: int_expr  */
+#line 864 "parser.y"
+                           {(yyval.t_value).type = TYPE_INTEGER; (yyval.t_value).value.i=(yyvsp[0].i_value);}
+#line 3826 "parser.c"
+    break;
+
+  case 136: /* typed_expr: bool_expr  */
+#line 865 "parser.y"
+                            {(yyval.t_value).type = TYPE_BOOLEAN; (yyval.t_value).value.i=(yyvsp[0].i_value);}
+#line 3832 "parser.c"
+    break;
+
+  case 137: /* typed_expr: real_expr  */
+#line 866 "parser.y"
+                            {(yyval.t_value).type = TYPE_REAL; (yyval.t_value).value.r=(yyvsp[0].r_value);}
+#line 3838 "parser.c"
+    break;
+
+  case 138: /* typed_expr: typed_expr '+' typed_expr  */
+#line 868 "parser.y"
+                        {V_VAL((yyval.t_value),(yyvsp[-2].t_value),TOF((yyvsp[-2].t_value)) + TOF((yyvsp[0].t_value))); }
+#line 3844 "parser.c"
+    break;
+
+  case 139: /* typed_expr: typed_expr '-' typed_expr  */
+#line 870 "parser.y"
+                        {V_VAL((yyval.t_value),(yyvsp[-2].t_value),TOF((yyvsp[-2].t_value)) - TOF((yyvsp[0].t_value))); }
+#line 3850 "parser.c"
+    break;
+
+  case 140: /* typed_expr: typed_expr '*' typed_expr  */
+#line 872 "parser.y"
+                        {V_VAL((yyval.t_value),(yyvsp[-2].t_value),TOF((yyvsp[-2].t_value)) * TOF((yyvsp[0].t_value))); }
+#line 3856 "parser.c"
+    break;
+
+  case 141: /* typed_expr: typed_expr '/' typed_expr  */
+#line 873 "parser.y"
+                                            {
+			if (TOF((yyvsp[0].t_value)))	V_VAL((yyval.t_value),(yyvsp[-2].t_value),TOF((yyvsp[-2].t_value)) / TOF((yyvsp[0].t_value)));
+			else V_VAL((yyval.t_value),(yyvsp[-2].t_value),TOF((yyvsp[0].t_value)));
+		}
+#line 3865 "parser.c"
+    break;
+
+  case 142: /* typed_expr: '-' typed_expr  */
+#line 878 "parser.y"
+                        {V_VAL((yyval.t_value),(yyvsp[0].t_value),-TOF((yyvsp[0].t_value))); }
+#line 3871 "parser.c"
+    break;
+
+  case 143: /* typed_expr: '+' typed_expr  */
+#line 880 "parser.y"
+                        {V_VAL((yyval.t_value),(yyvsp[0].t_value),TOF((yyvsp[0].t_value))); }
+#line 3877 "parser.c"
+    break;
+
+  case 144: /* typed_expr: typed_expr SHR_OP typed_expr  */
+#line 882 "parser.y"
+                        { unsigned int shift = (1 << (int)TOF((yyvsp[0].t_value)));
+			if (!shift) (yyval.t_value) = (yyvsp[-2].t_value);
+			else V_VAL((yyval.t_value), (yyvsp[-2].t_value), TOF((yyvsp[-2].t_value)) / shift);}
+#line 3885 "parser.c"
+    break;
+
+  case 145: /* typed_expr: typed_expr SHL_OP typed_expr  */
+#line 886 "parser.y"
+                        { unsigned int shift = (1 << (int)TOF((yyvsp[0].t_value)));
+			if (!shift) (yyval.t_value) = (yyvsp[-2].t_value);
+			else V_VAL((yyval.t_value), (yyvsp[-2].t_value), TOF((yyvsp[-2].t_value)) * shift);}
+#line 3893 "parser.c"
+    break;
+
+  case 146: /* typed_expr: variable_content  */
+#line 889 "parser.y"
+                                   {
+			char *s;
+			(yyval.t_value).type = TYPE_INTEGER;
+			(yyval.t_value).value.i = strtoul((yyvsp[0].s_value),&s,0);
+			switch (*s) {
+				case '.':  case 'e':  case 'E':
+				/* we assume a real number */
+				(yyval.t_value).type = TYPE_REAL;
+				(yyval.t_value).value.r = strtod((yyvsp[0].s_value),0);
+			}
+			free((yyvsp[0].s_value));
+		}
+#line 3910 "parser.c"
+    break;
+
+  case 147: /* typed_expr: '(' typed_expr ')'  */
+#line 901 "parser.y"
+                                     {(yyval.t_value) = (yyvsp[-1].t_value);}
+#line 3916 "parser.c"
+    break;
+
+  case 149: /* int_expr: typed_expr AND_OP typed_expr  */
+#line 906 "parser.y"
+                        {(yyval.i_value) = (int)TOF((yyvsp[-2].t_value)) & (int)TOF((yyvsp[0].t_value)); }
+#line 3922 "parser.c"
+    break;
+
+  case 150: /* int_expr: typed_expr OR_OP typed_expr  */
+#line 908 "parser.y"
+                        {(yyval.i_value) = (int)TOF((yyvsp[-2].t_value)) | (int)TOF((yyvsp[0].t_value)); }
+#line 3928 "parser.c"
+    break;
+
+  case 151: /* int_expr: typed_expr XOR_OP typed_expr  */
+#line 910 "parser.y"
+                        {(yyval.i_value) = (int)TOF((yyvsp[-2].t_value)) ^ (int)TOF((yyvsp[0].t_value)); }
+#line 3934 "parser.c"
+    break;
+
+  case 152: /* int_expr: BIT_NOT_OP typed_expr  */
+#line 912 "parser.y"
+                        {(yyval.i_value) = (int)TOF((yyvsp[0].t_value)) ^ (-1); }
+#line 3940 "parser.c"
+    break;
+
+  case 153: /* int_expr: L_AUTO  */
+#line 913 "parser.y"
+                                {(yyval.i_value) = -1; }
+#line 3946 "parser.c"
+    break;
+
+  case 154: /* int_expr: INTCAST '(' typed_expr ')'  */
+#line 914 "parser.y"
+                                             {(yyval.i_value) = TOF((yyvsp[-1].t_value));}
+#line 3952 "parser.c"
+    break;
+
+  case 155: /* int_expr: STRTOL '(' string_expr ')'  */
+#line 915 "parser.y"
+                                             {
+			(yyval.i_value) = strtol((yyvsp[-1].s_value),0,0);
+			free((yyvsp[-1].s_value));
+		}
+#line 3961 "parser.c"
+    break;
+
+  case 156: /* int_expr: STRLEN '(' string_expr ')'  */
+#line 919 "parser.y"
+                                             {
+			(yyval.i_value) = strlen((yyvsp[-1].s_value));
+			free((yyvsp[-1].s_value));
+		}
+#line 3970 "parser.c"
+    break;
+
+  case 157: /* int_expr: STRNCMP '(' string_expr ',' string_expr ',' expression ')'  */
+#line 923 "parser.y"
+                                                                             {
+			(yyval.i_value) = strncmp((yyvsp[-5].s_value),(yyvsp[-3].s_value),(yyvsp[-1].i_value));
+			free((yyvsp[-5].s_value)); free((yyvsp[-3].s_value));
+		}
+#line 3979 "parser.c"
+    break;
+
+  case 158: /* int_expr: STRPBRK '(' string_expr ',' string_expr ')'  */
+#line 927 "parser.y"
+                                                              {
+			char *s = strpbrk((yyvsp[-3].s_value),(yyvsp[-1].s_value));
+			if (s) (yyval.i_value) = s - (yyvsp[-3].s_value);
+			else (yyval.i_value) = -1;
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 3990 "parser.c"
+    break;
+
+  case 159: /* int_expr: STRCHR '(' string_expr ',' string_expr ')'  */
+#line 933 "parser.y"
+                                                             {
+			char *s = strchr((yyvsp[-3].s_value),(yyvsp[-1].s_value)[0]);
+			if (s) (yyval.i_value) = s - (yyvsp[-3].s_value);
+			else (yyval.i_value) = -1;
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 4001 "parser.c"
+    break;
+
+  case 160: /* int_expr: STRRCHR '(' string_expr ',' string_expr ')'  */
+#line 939 "parser.y"
+                                                              {
+			char *s = strrchr((yyvsp[-3].s_value),(yyvsp[-1].s_value)[0]);
+			if (s) (yyval.i_value) = s - (yyvsp[-3].s_value);
+			else (yyval.i_value) = -1;
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 4012 "parser.c"
+    break;
+
+  case 161: /* int_expr: STRSTR '(' string_expr ',' string_expr ')'  */
+#line 945 "parser.y"
+                                                             {
+			char *s = strstr((yyvsp[-3].s_value),(yyvsp[-1].s_value));
+			if (s) (yyval.i_value) = s - (yyvsp[-3].s_value);
+			else (yyval.i_value) = -1;
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 4023 "parser.c"
+    break;
+
+  case 162: /* int_expr: STRSPN '(' string_expr ',' string_expr ')'  */
+#line 951 "parser.y"
+                                                             {
+			(yyval.i_value) = strspn((yyvsp[-3].s_value),(yyvsp[-1].s_value));
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 4032 "parser.c"
+    break;
+
+  case 163: /* int_expr: STRCSPN '(' string_expr ',' string_expr ')'  */
+#line 955 "parser.y"
+                                                              {
+			(yyval.i_value) = strcspn((yyvsp[-3].s_value),(yyvsp[-1].s_value));
+			free((yyvsp[-3].s_value)); free((yyvsp[-1].s_value));
+		}
+#line 4041 "parser.c"
+    break;
+
+  case 164: /* int_expr: STRING  */
+#line 959 "parser.y"
+                         {
+			if ( (yyvsp[0].s_value)[0] == '\'' && (yyvsp[0].s_value)[1] && (yyvsp[0].s_value)[2] == '\'' && !(yyvsp[0].s_value)[3] )
+				(yyval.i_value) = (yyvsp[0].s_value)[1];
+			else	yyerror("unrecognized expression '%s'", (yyvsp[0].s_value));
+			free((yyvsp[0].s_value));
+		}
+#line 4052 "parser.c"
+    break;
+
+  case 165: /* bool_expr: typed_expr EQ_OP typed_expr  */
+#line 968 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) == TOF((yyvsp[0].t_value)); }
+#line 4058 "parser.c"
+    break;
+
+  case 166: /* bool_expr: typed_expr NEQ_OP typed_expr  */
+#line 970 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) != TOF((yyvsp[0].t_value)); }
+#line 4064 "parser.c"
+    break;
+
+  case 167: /* bool_expr: typed_expr GE_OP typed_expr  */
+#line 972 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) >= TOF((yyvsp[0].t_value)); }
+#line 4070 "parser.c"
+    break;
+
+  case 168: /* bool_expr: typed_expr LE_OP typed_expr  */
+#line 974 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) <= TOF((yyvsp[0].t_value)); }
+#line 4076 "parser.c"
+    break;
+
+  case 169: /* bool_expr: typed_expr '<' typed_expr  */
+#line 976 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) < TOF((yyvsp[0].t_value)); }
+#line 4082 "parser.c"
+    break;
+
+  case 170: /* bool_expr: typed_expr '>' typed_expr  */
+#line 978 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) > TOF((yyvsp[0].t_value)); }
+#line 4088 "parser.c"
+    break;
+
+  case 171: /* bool_expr: typed_expr L_AND_OP typed_expr  */
+#line 980 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) && TOF((yyvsp[0].t_value)); }
+#line 4094 "parser.c"
+    break;
+
+  case 172: /* bool_expr: typed_expr L_OR_OP typed_expr  */
+#line 982 "parser.y"
+                        {(yyval.i_value) = TOF((yyvsp[-2].t_value)) || TOF((yyvsp[0].t_value)); }
+#line 4100 "parser.c"
+    break;
+
+  case 173: /* bool_expr: string_expr STR_EQ_OP string_expr  */
+#line 984 "parser.y"
+                        {(yyval.i_value) = strcmp((yyvsp[-2].s_value),(yyvsp[0].s_value)) == 0; free((yyvsp[-2].s_value)); free((yyvsp[0].s_value)); }
+#line 4106 "parser.c"
+    break;
+
+  case 174: /* bool_expr: string_expr STR_NEQ_OP string_expr  */
+#line 986 "parser.y"
+                        {(yyval.i_value) = strcmp((yyvsp[-2].s_value),(yyvsp[0].s_value)) != 0; free((yyvsp[-2].s_value)); free((yyvsp[0].s_value)); }
+#line 4112 "parser.c"
+    break;
+
+  case 175: /* bool_expr: NOT_OP typed_expr  */
+#line 987 "parser.y"
+                                    {(yyval.i_value) = (TOF((yyvsp[0].t_value)) ? 0:1); }
+#line 4118 "parser.c"
+    break;
+
+  case 176: /* bool_expr: L_YES  */
+#line 988 "parser.y"
+                                {(yyval.i_value) = -2; }
+#line 4124 "parser.c"
+    break;
+
+  case 177: /* bool_expr: L_NO  */
+#line 989 "parser.y"
+                                {(yyval.i_value) = 0; }
+#line 4130 "parser.c"
+    break;
+
+  case 178: /* bool_expr: L_ON  */
+#line 990 "parser.y"
+                                {(yyval.i_value) = -2; }
+#line 4136 "parser.c"
+    break;
+
+  case 179: /* bool_expr: L_OFF  */
+#line 991 "parser.y"
+                                {(yyval.i_value) = 0; }
+#line 4142 "parser.c"
+    break;
+
+  case 180: /* bool_expr: DEFINED '(' string_unquoted ')'  */
+#line 992 "parser.y"
+                                                  {
+			(yyval.i_value) = get_config_variable((yyvsp[-1].s_value)) !=0;
+			free((yyvsp[-1].s_value));
+		}
+#line 4151 "parser.c"
+    break;
+
+  case 182: /* real_expr: REALCAST '(' typed_expr ')'  */
+#line 999 "parser.y"
+                                              {(yyval.r_value) = TOF((yyvsp[-1].t_value));}
+#line 4157 "parser.c"
+    break;
+
+  case 183: /* variable_content: VARIABLE  */
+#line 1003 "parser.y"
+                         {
+			const char *s = (yyvsp[0].s_value);
+			if (get_config_variable(s))
+				s = "1";
+			else if (strncmp("c_",s,2)
+					&& strncmp("u_",s,2)
+					&& strncmp("h_",s,2) ) {
+				s = checked_getenv(s);
+				if (!s) s = "";
+			}
+			else
+				s = "0";
+			(yyval.s_value) = strdup(s);
+			free((yyvsp[0].s_value));
+		}
+#line 4177 "parser.c"
+    break;
+
+  case 184: /* string_unquoted: STRING  */
+#line 1020 "parser.y"
+                       {
+			(yyval.s_value) = (yyvsp[0].s_value);
+			if ((yyval.s_value)[0] == '\'' || (yyval.s_value)[0] == '\"') {
+				size_t len = strlen((yyvsp[0].s_value)) - 2;
+				memmove((yyval.s_value), (yyval.s_value)+1, len);
+				(yyval.s_value)[len] = '\0';
+			}
+		}
+#line 4190 "parser.c"
+    break;
+
+  case 186: /* string_expr: STRCAT '(' strarglist ')'  */
+#line 1031 "parser.y"
+                                            {(yyval.s_value) = (yyvsp[-1].s_value); }
+#line 4196 "parser.c"
+    break;
+
+  case 187: /* string_expr: STRSPLIT '(' string_expr ',' expression ',' expression ')'  */
+#line 1032 "parser.y"
+                                                                             {
+			int i = (yyvsp[-3].i_value);
+			int len = (yyvsp[-1].i_value);
+			int slen = strlen((yyvsp[-5].s_value));
+			if ((i >=0) && (i < slen) && (len > 0)) {
+				if ((i+len) > slen) len = slen - i;
+				(yyvsp[-5].s_value)[i+len] = 0;
+				(yyval.s_value) = strdup((yyvsp[-5].s_value) + i);
+			}
+			else
+				(yyval.s_value) = strdup("");
+			free((yyvsp[-5].s_value));
+		}
+#line 4214 "parser.c"
+    break;
+
+  case 188: /* string_expr: STRDEL '(' string_expr ',' expression ',' expression ')'  */
+#line 1045 "parser.y"
+                                                                           {
+			int i = (yyvsp[-3].i_value);
+			int len = (yyvsp[-1].i_value);
+			int slen = strlen((yyvsp[-5].s_value));
+			char *s = strdup((yyvsp[-5].s_value));
+			if ((i >=0) && (i < slen) && (len > 0)) {
+				if ((i+len) > slen) s[i] = 0;
+				else memmove(s+i, s+i+len, slen-i-len+1);
+			}
+			free((yyvsp[-5].s_value));
+			(yyval.s_value) = s;
+		}
+#line 4231 "parser.c"
+    break;
+
+  case 189: /* string_expr: SHELL '(' strarglist ')'  */
+#line 1057 "parser.y"
+                                           {
+			(yyval.s_value) = run_shell((yyvsp[-1].s_value));
+			free((yyvsp[-1].s_value));
+		}
+#line 4240 "parser.c"
+    break;
+
+  case 190: /* string_expr: variable_content  */
+#line 1061 "parser.y"
+                                   {(yyval.s_value) = (yyvsp[0].s_value);}
+#line 4246 "parser.c"
+    break;
+
+  case 192: /* strarglist: strarglist ',' strarglist_item  */
+#line 1065 "parser.y"
+                                                 {
+			char *s = malloc(strlen((yyvsp[-2].s_value))+strlen((yyvsp[0].s_value))+1);
+			strcpy(s, (yyvsp[-2].s_value));
+			strcat(s, (yyvsp[0].s_value));
+			(yyval.s_value) = s;
+			free((yyvsp[-2].s_value)); free((yyvsp[0].s_value));
+		}
+#line 4258 "parser.c"
+    break;
+
+  case 194: /* strarglist_item: '(' typed_expr ')'  */
+#line 1075 "parser.y"
+                                     {
+			int ret;
+			if ((yyvsp[-1].t_value).type == TYPE_REAL) {
+				ret = asprintf(&(yyval.s_value), "%g", (yyvsp[-1].t_value).value.r);
+				assert(ret != -1);
+			} else {
+				ret = asprintf(&(yyval.s_value), "%d", (yyvsp[-1].t_value).value.i);
+				assert(ret != -1);
+			}
+		}
+#line 4273 "parser.c"
+    break;
+
+  case 195: /* check_user_var_list: VARIABLE  */
+#line 1088 "parser.y"
+                         {
+			check_user_var((yyvsp[0].s_value));
+			free((yyvsp[0].s_value));
+		}
+#line 4282 "parser.c"
+    break;
+
+  case 196: /* check_user_var_list: check_user_var_list ',' VARIABLE  */
+#line 1092 "parser.y"
+                                                   {
+			check_user_var((yyvsp[0].s_value));
+			free((yyvsp[0].s_value));
+		}
+#line 4291 "parser.c"
+    break;
+
+  case 199: /* x_flag: L_DISPLAY string_expr  */
+#line 1103 "parser.y"
+                                        { free(config.X_display); config.X_display = (yyvsp[0].s_value); }
+#line 4297 "parser.c"
+    break;
+
+  case 200: /* x_flag: L_TITLE string_expr  */
+#line 1104 "parser.y"
+                                        { free(config.X_title); config.X_title = (yyvsp[0].s_value); }
+#line 4303 "parser.c"
+    break;
+
+  case 201: /* x_flag: X_TITLE_SHOW_APPNAME bool  */
+#line 1105 "parser.y"
+                                                { config.X_title_show_appname = ((yyvsp[0].i_value)!=0); }
+#line 4309 "parser.c"
+    break;
+
+  case 202: /* x_flag: ICON_NAME string_expr  */
+#line 1106 "parser.y"
+                                        { free(config.X_icon_name); config.X_icon_name = (yyvsp[0].s_value); }
+#line 4315 "parser.c"
+    break;
+
+  case 203: /* x_flag: X_BLINKRATE expression  */
+#line 1107 "parser.y"
+                                                { config.X_blinkrate = (yyvsp[0].i_value); }
+#line 4321 "parser.c"
+    break;
+
+  case 204: /* x_flag: X_SHARECMAP  */
+#line 1108 "parser.y"
+                                        { config.X_sharecmap = 1; }
+#line 4327 "parser.c"
+    break;
+
+  case 205: /* x_flag: X_MITSHM  */
+#line 1109 "parser.y"
+                                        { config.X_mitshm = 1; }
+#line 4333 "parser.c"
+    break;
+
+  case 206: /* x_flag: X_MITSHM bool  */
+#line 1110 "parser.y"
+                                        { config.X_mitshm = ((yyvsp[0].i_value)!=0); }
+#line 4339 "parser.c"
+    break;
+
+  case 207: /* x_flag: X_FONT string_expr  */
+#line 1111 "parser.y"
+                                                { free(config.X_font); config.X_font = (yyvsp[0].s_value); }
+#line 4345 "parser.c"
+    break;
+
+  case 208: /* x_flag: X_FIXED_ASPECT bool  */
+#line 1112 "parser.y"
+                                        { config.X_fixed_aspect = ((yyvsp[0].i_value)!=0); }
+#line 4351 "parser.c"
+    break;
+
+  case 209: /* x_flag: X_ASPECT_43  */
+#line 1113 "parser.y"
+                                        { config.X_aspect_43 = 1; }
+#line 4357 "parser.c"
+    break;
+
+  case 210: /* x_flag: X_LIN_FILT  */
+#line 1114 "parser.y"
+                                        { config.X_lin_filt = 1; }
+#line 4363 "parser.c"
+    break;
+
+  case 211: /* x_flag: X_BILIN_FILT  */
+#line 1115 "parser.y"
+                                        { config.X_bilin_filt = 1; }
+#line 4369 "parser.c"
+    break;
+
+  case 212: /* x_flag: X_MODE13FACT expression  */
+#line 1116 "parser.y"
+                                           { config.X_mode13fact = (yyvsp[0].i_value); }
+#line 4375 "parser.c"
+    break;
+
+  case 213: /* x_flag: X_WINSIZE INTEGER INTEGER  */
+#line 1118 "parser.y"
+                   {
+                     config.X_winsize_x = (yyvsp[-1].i_value);
+                     config.X_winsize_y = (yyvsp[0].i_value);
+                   }
+#line 4384 "parser.c"
+    break;
+
+  case 214: /* x_flag: X_WINSIZE expression ',' expression  */
+#line 1123 "parser.y"
+                   {
+                     config.X_winsize_x = (yyvsp[-2].i_value);
+                     config.X_winsize_y = (yyvsp[0].i_value);
+                   }
+#line 4393 "parser.c"
+    break;
+
+  case 215: /* x_flag: X_GAMMA expression  */
+#line 1127 "parser.y"
+                                      { config.X_gamma = (yyvsp[0].i_value); }
+#line 4399 "parser.c"
+    break;
+
+  case 216: /* x_flag: X_FULLSCREEN bool  */
+#line 1128 "parser.y"
+                                      { config.X_fullscreen = (yyvsp[0].i_value); }
+#line 4405 "parser.c"
+    break;
+
+  case 217: /* x_flag: X_NOCLOSE bool  */
+#line 1129 "parser.y"
+                                      { config.X_noclose = ((yyvsp[0].i_value)!=0); }
+#line 4411 "parser.c"
+    break;
+
+  case 218: /* x_flag: X_NORESIZE bool  */
+#line 1130 "parser.y"
+                                      { config.X_noresize = ((yyvsp[0].i_value)!=0); }
+#line 4417 "parser.c"
+    break;
+
+  case 219: /* x_flag: VGAEMU_MEMSIZE expression  */
+#line 1131 "parser.y"
+                                                { config.vgaemu_memsize = (yyvsp[0].i_value); }
+#line 4423 "parser.c"
+    break;
+
+  case 220: /* x_flag: VESAMODE INTEGER INTEGER  */
+#line 1132 "parser.y"
+                                           { set_vesamodes((yyvsp[-1].i_value),(yyvsp[0].i_value),0);}
+#line 4429 "parser.c"
+    break;
+
+  case 221: /* x_flag: VESAMODE INTEGER INTEGER INTEGER  */
+#line 1133 "parser.y"
+                                                   { set_vesamodes((yyvsp[-2].i_value),(yyvsp[-1].i_value),(yyvsp[0].i_value));}
+#line 4435 "parser.c"
+    break;
+
+  case 222: /* x_flag: VESAMODE expression ',' expression  */
+#line 1134 "parser.y"
+                                                     { set_vesamodes((yyvsp[-2].i_value),(yyvsp[0].i_value),0);}
+#line 4441 "parser.c"
+    break;
+
+  case 223: /* x_flag: VESAMODE expression ',' expression ',' expression  */
+#line 1136 "parser.y"
+                        { set_vesamodes((yyvsp[-4].i_value),(yyvsp[-2].i_value),(yyvsp[0].i_value));}
+#line 4447 "parser.c"
+    break;
+
+  case 224: /* x_flag: X_LFB bool  */
+#line 1137 "parser.y"
+                                        { config.X_lfb = ((yyvsp[0].i_value)!=0); }
+#line 4453 "parser.c"
+    break;
+
+  case 225: /* x_flag: X_PM_INTERFACE bool  */
+#line 1138 "parser.y"
+                                        { config.X_pm_interface = ((yyvsp[0].i_value)!=0); }
+#line 4459 "parser.c"
+    break;
+
+  case 226: /* x_flag: X_MGRAB_KEY string_expr  */
+#line 1139 "parser.y"
+                                          { free(config.X_mgrab_key); config.X_mgrab_key = (yyvsp[0].s_value); }
+#line 4465 "parser.c"
+    break;
+
+  case 227: /* x_flag: X_BACKGROUND_PAUSE bool  */
+#line 1140 "parser.y"
+                                                { config.X_background_pause = ((yyvsp[0].i_value)!=0); }
+#line 4471 "parser.c"
+    break;
+
+  case 230: /* sdl_flag: SDL_HWREND expression  */
+#line 1147 "parser.y"
+                                        { config.sdl_hwrend = ((yyvsp[0].i_value)!=0); }
+#line 4477 "parser.c"
+    break;
+
+  case 231: /* sdl_flag: SDL_FONTS string_expr  */
+#line 1148 "parser.y"
+                                        { free(config.sdl_fonts); config.sdl_fonts = (yyvsp[0].s_value); }
+#line 4483 "parser.c"
+    break;
+
+  case 232: /* sdl_flag: SDL_WCONTROLS expression  */
+#line 1149 "parser.y"
+                                                { config.sdl_wcontrols = ((yyvsp[0].i_value)!=0); }
+#line 4489 "parser.c"
+    break;
+
+  case 233: /* sdl_flag: SDL_CLIP_NATIVE bool  */
+#line 1150 "parser.y"
+                                                { config.sdl_clip_native = ((yyvsp[0].i_value)!=0); }
+#line 4495 "parser.c"
+    break;
+
+  case 236: /* sound_flag: SB_BASE expression  */
+#line 1158 "parser.y"
+                                        { config.sb_base = (yyvsp[0].i_value); }
+#line 4501 "parser.c"
+    break;
+
+  case 237: /* sound_flag: SB_DMA expression  */
+#line 1159 "parser.y"
+                                        { config.sb_dma = (yyvsp[0].i_value); }
+#line 4507 "parser.c"
+    break;
+
+  case 238: /* sound_flag: SB_HDMA expression  */
+#line 1160 "parser.y"
+                                     { config.sb_hdma = (yyvsp[0].i_value); }
+#line 4513 "parser.c"
+    break;
+
+  case 239: /* sound_flag: SB_IRQ expression  */
+#line 1161 "parser.y"
+                                        { config.sb_irq = (yyvsp[0].i_value); }
+#line 4519 "parser.c"
+    break;
+
+  case 240: /* sound_flag: MPU_BASE expression  */
+#line 1162 "parser.y"
+                                        { config.mpu401_base = (yyvsp[0].i_value); }
+#line 4525 "parser.c"
+    break;
+
+  case 241: /* sound_flag: MPU_BASE_MT32 expression  */
+#line 1163 "parser.y"
+                                                { config.mpu401_base_mt32 = (yyvsp[0].i_value); }
+#line 4531 "parser.c"
+    break;
+
+  case 242: /* sound_flag: MIDI_SYNTH string_expr  */
+#line 1164 "parser.y"
+                                                { free(config.midi_synth); config.midi_synth = (yyvsp[0].s_value); }
+#line 4537 "parser.c"
+    break;
+
+  case 243: /* sound_flag: MPU_IRQ int_bool  */
+#line 1165 "parser.y"
+                                        { config.mpu401_irq = (yyvsp[0].i_value); }
+#line 4543 "parser.c"
+    break;
+
+  case 244: /* sound_flag: MPU_IRQ_MT32 expression  */
+#line 1166 "parser.y"
+                                                { config.mpu401_irq_mt32 = (yyvsp[0].i_value); }
+#line 4549 "parser.c"
+    break;
+
+  case 245: /* sound_flag: SOUND_DRIVER string_expr  */
+#line 1167 "parser.y"
+                                                { free(config.sound_driver); config.sound_driver = (yyvsp[0].s_value); }
+#line 4555 "parser.c"
+    break;
+
+  case 246: /* sound_flag: MIDI_DRIVER string_expr  */
+#line 1168 "parser.y"
+                                                { free(config.midi_driver); config.midi_driver = (yyvsp[0].s_value); }
+#line 4561 "parser.c"
+    break;
+
+  case 247: /* sound_flag: FLUID_SFONT string_expr  */
+#line 1169 "parser.y"
+                                                { free(config.fluid_sfont); config.fluid_sfont = (yyvsp[0].s_value); }
+#line 4567 "parser.c"
+    break;
+
+  case 248: /* sound_flag: FLUID_VOLUME expression  */
+#line 1170 "parser.y"
+                                                { config.fluid_volume = (yyvsp[0].i_value); }
+#line 4573 "parser.c"
+    break;
+
+  case 249: /* sound_flag: MUNT_ROMS string_expr  */
+#line 1172 "parser.y"
+                        {
+				free(config.munt_roms_dir);
+				config.munt_roms_dir = concat_dir(dosemu_localdir_path, (yyvsp[0].s_value));
+				free((yyvsp[0].s_value));
+			}
+#line 4583 "parser.c"
+    break;
+
+  case 250: /* sound_flag: OPL2LPT_DEV string_expr  */
+#line 1178 "parser.y"
+                        {
+				free(config.opl2lpt_device);
+				config.opl2lpt_device = (yyvsp[0].s_value);
+			}
+#line 4592 "parser.c"
+    break;
+
+  case 251: /* sound_flag: OPL2LPT_TYPE string_expr  */
+#line 1183 "parser.y"
+                        {
+				if (strlen((yyvsp[0].s_value)) == 4 && isdigit((yyvsp[0].s_value)[3]))
+					config.opl2lpt_type = atoi((yyvsp[0].s_value) + 3) - 2;
+				else
+					yyerror("invalid value %s\n", (yyvsp[0].s_value));
+				free((yyvsp[0].s_value));
+			}
+#line 4604 "parser.c"
+    break;
+
+  case 252: /* sound_flag: SND_PLUGIN_PARAMS string_expr  */
+#line 1190 "parser.y"
+                                                { free(config.snd_plugin_params); config.snd_plugin_params = (yyvsp[0].s_value); }
+#line 4610 "parser.c"
+    break;
+
+  case 253: /* sound_flag: PCM_HPF bool  */
+#line 1191 "parser.y"
+                                        { config.pcm_hpf = ((yyvsp[0].i_value)!=0); }
+#line 4616 "parser.c"
+    break;
+
+  case 254: /* sound_flag: MIDI_FILE string_expr  */
+#line 1192 "parser.y"
+                                        { free(config.midi_file); config.midi_file = (yyvsp[0].s_value); }
+#line 4622 "parser.c"
+    break;
+
+  case 255: /* sound_flag: WAV_FILE string_expr  */
+#line 1193 "parser.y"
+                                        { free(config.wav_file); config.wav_file = (yyvsp[0].s_value); }
+#line 4628 "parser.c"
+    break;
+
+  case 256: /* sound_flag: SOUND_VTIME bool  */
+#line 1194 "parser.y"
+                                        { config.sound_vtime = ((yyvsp[0].i_value)!=0); }
+#line 4634 "parser.c"
+    break;
+
+  case 259: /* joystick_flag: JOY_DEVICE string_expr  */
+#line 1202 "parser.y"
+                                                { set_joy_device((yyvsp[0].s_value)); }
+#line 4640 "parser.c"
+    break;
+
+  case 260: /* joystick_flag: JOY_DOS_MIN expression  */
+#line 1203 "parser.y"
+                                                { config.joy_dos_min = (yyvsp[0].i_value); }
+#line 4646 "parser.c"
+    break;
+
+  case 261: /* joystick_flag: JOY_DOS_MAX expression  */
+#line 1204 "parser.y"
+                                                { config.joy_dos_max = (yyvsp[0].i_value); }
+#line 4652 "parser.c"
+    break;
+
+  case 262: /* joystick_flag: JOY_GRANULARITY expression  */
+#line 1205 "parser.y"
+                                                { config.joy_granularity = (yyvsp[0].i_value); }
+#line 4658 "parser.c"
+    break;
+
+  case 263: /* joystick_flag: JOY_LATENCY expression  */
+#line 1206 "parser.y"
+                                                { config.joy_latency = (yyvsp[0].i_value); }
+#line 4664 "parser.c"
+    break;
+
+  case 266: /* video_flag: VGA  */
+#line 1214 "parser.y"
+                                        { config.cardtype = CARD_VGA; }
+#line 4670 "parser.c"
+    break;
+
+  case 267: /* video_flag: MGA  */
+#line 1215 "parser.y"
+                                        { config.cardtype = CARD_MDA; }
+#line 4676 "parser.c"
+    break;
+
+  case 268: /* video_flag: CGA  */
+#line 1216 "parser.y"
+                                        { config.cardtype = CARD_CGA; }
+#line 4682 "parser.c"
+    break;
+
+  case 269: /* video_flag: EGA  */
+#line 1217 "parser.y"
+                                        { config.cardtype = CARD_EGA; }
+#line 4688 "parser.c"
+    break;
+
+  case 270: /* video_flag: NONE  */
+#line 1218 "parser.y"
+                                        { config.cardtype = CARD_NONE; }
+#line 4694 "parser.c"
+    break;
+
+  case 271: /* video_flag: CHIPSET CHIPSET_TYPE  */
+#line 1220 "parser.y"
+                    {
+		    config.chipset = (yyvsp[0].i_value);
+                    c_printf("CHIPSET: %d\n", (yyvsp[0].i_value));
+		    }
+#line 4703 "parser.c"
+    break;
+
+  case 272: /* video_flag: MEMSIZE expression  */
+#line 1224 "parser.y"
+                                        { config.gfxmemsize = (yyvsp[0].i_value); }
+#line 4709 "parser.c"
+    break;
+
+  case 273: /* video_flag: GRAPHICS  */
+#line 1226 "parser.y"
+                    { config.vga = 1;
+		    }
+#line 4716 "parser.c"
+    break;
+
+  case 274: /* video_flag: GRAPHICS L_AUTO  */
+#line 1229 "parser.y"
+                    { config.vga = -1;
+		    }
+#line 4723 "parser.c"
+    break;
+
+  case 275: /* video_flag: CONSOLE  */
+#line 1232 "parser.y"
+                    { config.console_video = 1;
+		    }
+#line 4730 "parser.c"
+    break;
+
+  case 276: /* video_flag: CONSOLE L_AUTO  */
+#line 1235 "parser.y"
+                    { config.console_video = -1;
+		    }
+#line 4737 "parser.c"
+    break;
+
+  case 277: /* video_flag: FULLREST  */
+#line 1237 "parser.y"
+                                        { config.fullrestore = 1; }
+#line 4743 "parser.c"
+    break;
+
+  case 278: /* video_flag: PARTREST  */
+#line 1238 "parser.y"
+                                        { config.fullrestore = 0; }
+#line 4749 "parser.c"
+    break;
+
+  case 279: /* video_flag: VBIOS_FILE string_expr  */
+#line 1239 "parser.y"
+                                                { free(config.vbios_file); config.vbios_file = (yyvsp[0].s_value);
+					  config.mapped_bios = 1;
+					  config.vbios_copy = 0; }
+#line 4757 "parser.c"
+    break;
+
+  case 280: /* video_flag: VGAEMUBIOS_FILE string_expr  */
+#line 1242 "parser.y"
+                                                { free(config.vgaemubios_file); config.vgaemubios_file = (yyvsp[0].s_value); }
+#line 4763 "parser.c"
+    break;
+
+  case 281: /* video_flag: VBIOS_COPY  */
+#line 1243 "parser.y"
+                                        { free(config.vbios_file);
+					  config.vbios_file = NULL;
+					  config.mapped_bios = 1;
+					  config.vbios_copy = 1; }
+#line 4772 "parser.c"
+    break;
+
+  case 282: /* video_flag: VBIOS_MMAP  */
+#line 1247 "parser.y"
+                                        { free(config.vbios_file);
+					  config.vbios_file = NULL;
+					  config.mapped_bios = 1;
+					  config.vbios_copy = 1; }
+#line 4781 "parser.c"
+    break;
+
+  case 283: /* video_flag: VBIOS_SEG expression  */
+#line 1252 "parser.y"
+                   {
+		   config.vbios_seg = (yyvsp[0].i_value);
+		   c_printf("CONF: VGA-BIOS-Segment %x\n", (yyvsp[0].i_value));
+		   if (((yyvsp[0].i_value) != 0xe000) && ((yyvsp[0].i_value) != 0xc000))
+		      {
+		      config.vbios_seg = detect_vbios_seg();
+		      if (config.vbios_seg == -1) config.vbios_seg = 0xc000;
+		      c_printf("CONF: VGA-BIOS-Segment set to 0x%x\n", config.vbios_seg);
+		      }
+		   }
+#line 4796 "parser.c"
+    break;
+
+  case 284: /* video_flag: VBIOS_SIZE_TOK expression  */
+#line 1263 "parser.y"
+                   {
+		   config.vbios_size = (yyvsp[0].i_value);
+		   c_printf("CONF: VGA-BIOS-Size %x\n", (yyvsp[0].i_value));
+		   if (((yyvsp[0].i_value) != 0x8000) && ((yyvsp[0].i_value) != 0x10000))
+		      {
+		      config.vbios_size = detect_vbios_size();
+		      if (config.vbios_size == -1) config.vbios_size = 0x10000;
+		      c_printf("CONF: VGA-BIOS-Size set to 0x%x\n", config.vbios_size);
+		      }
+		   }
+#line 4811 "parser.c"
+    break;
+
+  case 285: /* video_flag: VBIOS_POST  */
+#line 1273 "parser.y"
+                                        { config.vbios_post = 1; }
+#line 4817 "parser.c"
+    break;
+
+  case 286: /* video_flag: DUALMON  */
+#line 1274 "parser.y"
+                                        { config.dualmon = 1; }
+#line 4823 "parser.c"
+    break;
+
+  case 287: /* video_flag: FORCE_VT_SWITCH  */
+#line 1275 "parser.y"
+                                        { config.force_vt_switch = 1; }
+#line 4829 "parser.c"
+    break;
+
+  case 288: /* video_flag: PCI  */
+#line 1276 "parser.y"
+                                        { config.pci_video = 1; }
+#line 4835 "parser.c"
+    break;
+
+  case 289: /* video_flag: STRING  */
+#line 1278 "parser.y"
+                    { yyerror("unrecognized video option '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 4842 "parser.c"
+    break;
+
+  case 293: /* term_flag: ESCCHAR expression  */
+#line 1288 "parser.y"
+                                           { config.term_esc_char = (yyvsp[0].i_value); }
+#line 4848 "parser.c"
+    break;
+
+  case 294: /* term_flag: COLOR bool  */
+#line 1289 "parser.y"
+                                        { config.term_color = ((yyvsp[0].i_value)!=0); }
+#line 4854 "parser.c"
+    break;
+
+  case 295: /* term_flag: SIZE string_expr  */
+#line 1290 "parser.y"
+                                           { free(config.term_size); config.term_size = (yyvsp[0].s_value); }
+#line 4860 "parser.c"
+    break;
+
+  case 296: /* term_flag: STRING  */
+#line 1292 "parser.y"
+                    { yyerror("unrecognized terminal option '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 4867 "parser.c"
+    break;
+
+  case 300: /* debug_flag: VIDEO bool  */
+#line 1306 "parser.y"
+                                        { set_debug_level('v', ((yyvsp[0].i_value)!=0)); }
+#line 4873 "parser.c"
+    break;
+
+  case 301: /* debug_flag: L_OFF  */
+#line 1307 "parser.y"
+                                        { set_debug_level('a', 0); }
+#line 4879 "parser.c"
+    break;
+
+  case 302: /* debug_flag: SERIAL bool  */
+#line 1308 "parser.y"
+                                        { set_debug_level('s', ((yyvsp[0].i_value)!=0)); }
+#line 4885 "parser.c"
+    break;
+
+  case 303: /* debug_flag: CONFIG bool  */
+#line 1309 "parser.y"
+                                        { set_debug_level('c', ((yyvsp[0].i_value)!=0)); }
+#line 4891 "parser.c"
+    break;
+
+  case 304: /* debug_flag: DISK bool  */
+#line 1310 "parser.y"
+                                        { set_debug_level('d', ((yyvsp[0].i_value)!=0)); }
+#line 4897 "parser.c"
+    break;
+
+  case 305: /* debug_flag: READ bool  */
+#line 1311 "parser.y"
+                                        { set_debug_level('R', ((yyvsp[0].i_value)!=0)); }
+#line 4903 "parser.c"
+    break;
+
+  case 306: /* debug_flag: WRITE bool  */
+#line 1312 "parser.y"
+                                        { set_debug_level('W', ((yyvsp[0].i_value)!=0)); }
+#line 4909 "parser.c"
+    break;
+
+  case 307: /* debug_flag: KEYB bool  */
+#line 1313 "parser.y"
+                                        { set_debug_level('k', ((yyvsp[0].i_value)!=0)); }
+#line 4915 "parser.c"
+    break;
+
+  case 308: /* debug_flag: KEYBOARD bool  */
+#line 1314 "parser.y"
+                                        { set_debug_level('k', ((yyvsp[0].i_value)!=0)); }
+#line 4921 "parser.c"
+    break;
+
+  case 309: /* debug_flag: PRINTER bool  */
+#line 1315 "parser.y"
+                                        { set_debug_level('p', ((yyvsp[0].i_value)!=0)); }
+#line 4927 "parser.c"
+    break;
+
+  case 310: /* debug_flag: IO bool  */
+#line 1316 "parser.y"
+                                        { set_debug_level('i', ((yyvsp[0].i_value)!=0)); }
+#line 4933 "parser.c"
+    break;
+
+  case 311: /* debug_flag: PORT bool  */
+#line 1317 "parser.y"
+                                        { set_debug_level('i', ((yyvsp[0].i_value)!=0)); }
+#line 4939 "parser.c"
+    break;
+
+  case 312: /* debug_flag: WARNING bool  */
+#line 1318 "parser.y"
+                                        { set_debug_level('w', ((yyvsp[0].i_value)!=0)); }
+#line 4945 "parser.c"
+    break;
+
+  case 313: /* debug_flag: GENERAL bool  */
+#line 1319 "parser.y"
+                                        { set_debug_level('g', ((yyvsp[0].i_value)!=0)); }
+#line 4951 "parser.c"
+    break;
+
+  case 314: /* debug_flag: L_XMS bool  */
+#line 1320 "parser.y"
+                                        { set_debug_level('X', ((yyvsp[0].i_value)!=0)); }
+#line 4957 "parser.c"
+    break;
+
+  case 315: /* debug_flag: L_DPMI bool  */
+#line 1321 "parser.y"
+                                        { set_debug_level('M', ((yyvsp[0].i_value)!=0)); }
+#line 4963 "parser.c"
+    break;
+
+  case 316: /* debug_flag: MOUSE bool  */
+#line 1322 "parser.y"
+                                        { set_debug_level('m', ((yyvsp[0].i_value)!=0)); }
+#line 4969 "parser.c"
+    break;
+
+  case 317: /* debug_flag: HARDWARE bool  */
+#line 1323 "parser.y"
+                                        { set_debug_level('h', ((yyvsp[0].i_value)!=0)); }
+#line 4975 "parser.c"
+    break;
+
+  case 318: /* debug_flag: L_IPC bool  */
+#line 1324 "parser.y"
+                                        { set_debug_level('I', ((yyvsp[0].i_value)!=0)); }
+#line 4981 "parser.c"
+    break;
+
+  case 319: /* debug_flag: L_EMS bool  */
+#line 1325 "parser.y"
+                                        { set_debug_level('E', ((yyvsp[0].i_value)!=0)); }
+#line 4987 "parser.c"
+    break;
+
+  case 320: /* debug_flag: NETWORK bool  */
+#line 1326 "parser.y"
+                                        { set_debug_level('n', ((yyvsp[0].i_value)!=0)); }
+#line 4993 "parser.c"
+    break;
+
+  case 321: /* debug_flag: L_X bool  */
+#line 1327 "parser.y"
+                                        { set_debug_level('X', ((yyvsp[0].i_value)!=0)); }
+#line 4999 "parser.c"
+    break;
+
+  case 322: /* debug_flag: L_SDL bool  */
+#line 1328 "parser.y"
+                                        { set_debug_level('v', ((yyvsp[0].i_value)!=0)); }
+#line 5005 "parser.c"
+    break;
+
+  case 323: /* debug_flag: SOUND bool  */
+#line 1329 "parser.y"
+                                        { set_debug_level('S', ((yyvsp[0].i_value)!=0)); }
+#line 5011 "parser.c"
+    break;
+
+  case 324: /* debug_flag: JOYSTICK bool  */
+#line 1330 "parser.y"
+                                        { set_debug_level('j', ((yyvsp[0].i_value)!=0)); }
+#line 5017 "parser.c"
+    break;
+
+  case 325: /* debug_flag: STRING  */
+#line 1332 "parser.y"
+                    { yyerror("unrecognized debug flag '%s'", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5023 "parser.c"
+    break;
+
+  case 329: /* mouse_flag: DEVICE string_expr  */
+#line 1341 "parser.y"
+                                        { free(mptr->dev); mptr->dev = (yyvsp[0].s_value); }
+#line 5029 "parser.c"
+    break;
+
+  case 330: /* mouse_flag: INTERNALDRIVER  */
+#line 1342 "parser.y"
+                                        { mptr->intdrv = TRUE; }
+#line 5035 "parser.c"
+    break;
+
+  case 331: /* mouse_flag: EMULATE3BUTTONS  */
+#line 1343 "parser.y"
+                                        { mptr->emulate3buttons = TRUE; }
+#line 5041 "parser.c"
+    break;
+
+  case 332: /* mouse_flag: BAUDRATE expression  */
+#line 1344 "parser.y"
+                                        { mptr->baudRate = (yyvsp[0].i_value); }
+#line 5047 "parser.c"
+    break;
+
+  case 333: /* mouse_flag: CLEARDTR  */
+#line 1346 "parser.y"
+                    { if (mptr->dev_type == MOUSE_MOUSESYSTEMS)
+			 mptr->cleardtr = TRUE;
+		      else
+			 yyerror("option CLEARDTR is only valid for MicroSystems-mice");
+		    }
+#line 5057 "parser.c"
+    break;
+
+  case 334: /* mouse_flag: MICROSOFT  */
+#line 1352 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_MICROSOFT;
+		  mptr->flags = CS7 | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5066 "parser.c"
+    break;
+
+  case 335: /* mouse_flag: MS3BUTTON  */
+#line 1357 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_MS3BUTTON;
+		  mptr->flags = CS7 | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5075 "parser.c"
+    break;
+
+  case 336: /* mouse_flag: MOUSESYSTEMS  */
+#line 1362 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_MOUSESYSTEMS;
+		  mptr->flags = CS8 | CREAD | CLOCAL | HUPCL;
+/* is cstopb needed?  mptr->flags = CS8 | CSTOPB | CREAD | CLOCAL | HUPCL; */
+		  }
+#line 5085 "parser.c"
+    break;
+
+  case 337: /* mouse_flag: MMSERIES  */
+#line 1368 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_MMSERIES;
+		  mptr->flags = CS8 | PARENB | PARODD | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5094 "parser.c"
+    break;
+
+  case 338: /* mouse_flag: LOGITECH  */
+#line 1373 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_LOGITECH;
+		  mptr->flags = CS8 | CSTOPB | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5103 "parser.c"
+    break;
+
+  case 339: /* mouse_flag: PS2  */
+#line 1378 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_PS2;
+		  mptr->flags = 0;
+		  }
+#line 5112 "parser.c"
+    break;
+
+  case 340: /* mouse_flag: IMPS2  */
+#line 1383 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_IMPS2;
+		  mptr->flags = 0;
+		  }
+#line 5121 "parser.c"
+    break;
+
+  case 341: /* mouse_flag: MOUSEMAN  */
+#line 1388 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_MOUSEMAN;
+		  mptr->flags = CS7 | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5130 "parser.c"
+    break;
+
+  case 342: /* mouse_flag: HITACHI  */
+#line 1393 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_HITACHI;
+		  mptr->flags = CS8 | CREAD | CLOCAL | HUPCL;
+		  }
+#line 5139 "parser.c"
+    break;
+
+  case 343: /* mouse_flag: BUSMOUSE  */
+#line 1398 "parser.y"
+                  {
+		  mptr->dev_type = MOUSE_BUSMOUSE;
+		  mptr->flags = 0;
+		  }
+#line 5148 "parser.c"
+    break;
+
+  case 344: /* mouse_flag: UNGRAB_TWEAK bool  */
+#line 1403 "parser.y"
+                  {
+		  mptr->ignore_speed = ((yyvsp[0].i_value)!=0);
+		  }
+#line 5156 "parser.c"
+    break;
+
+  case 345: /* mouse_flag: STRING  */
+#line 1407 "parser.y"
+                    { yyerror("unrecognized mouse flag '%s'", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5162 "parser.c"
+    break;
+
+  case 349: /* keyboard_flag: LAYOUT string_expr  */
+#line 1416 "parser.y"
+                                        { keyb_layout((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5168 "parser.c"
+    break;
+
+  case 350: /* keyboard_flag: RAWKEYBOARD bool  */
+#line 1417 "parser.y"
+                                        { config.console_keyb = (yyvsp[0].i_value); }
+#line 5174 "parser.c"
+    break;
+
+  case 351: /* keyboard_flag: STRING  */
+#line 1419 "parser.y"
+                    { yyerror("unrecognized keyboard flag '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value));}
+#line 5181 "parser.c"
+    break;
+
+  case 355: /* $@13: %empty  */
+#line 1428 "parser.y"
+                                          { keyb_mod('C', (yyvsp[-1].i_value), 0); }
+#line 5187 "parser.c"
+    break;
+
+  case 357: /* $@14: %empty  */
+#line 1429 "parser.y"
+                                               { keyb_mod('a', (yyvsp[-1].i_value), 0); }
+#line 5193 "parser.c"
+    break;
+
+  case 359: /* $@15: %empty  */
+#line 1430 "parser.y"
+                                              { keyb_mod('c', (yyvsp[-1].i_value), 0); }
+#line 5199 "parser.c"
+    break;
+
+  case 361: /* $@16: %empty  */
+#line 1431 "parser.y"
+                                 { keyb_mod(' ', (yyvsp[-1].i_value), 0); }
+#line 5205 "parser.c"
+    break;
+
+  case 363: /* $@17: %empty  */
+#line 1432 "parser.y"
+                                           { keyb_mod('S', (yyvsp[-1].i_value), 0); }
+#line 5211 "parser.c"
+    break;
+
+  case 365: /* $@18: %empty  */
+#line 1433 "parser.y"
+                                         { keyb_mod('A', (yyvsp[-1].i_value), 0); }
+#line 5217 "parser.c"
+    break;
+
+  case 367: /* $@19: %empty  */
+#line 1434 "parser.y"
+                                            { keyb_mod('N', (yyvsp[-1].i_value), 0); }
+#line 5223 "parser.c"
+    break;
+
+  case 371: /* keyboard_modval: UNICODE  */
+#line 1441 "parser.y"
+                          { keyb_mod(0, (yyvsp[0].i_value), 1); }
+#line 5229 "parser.c"
+    break;
+
+  case 372: /* keyboard_modval: DGRAVE  */
+#line 1442 "parser.y"
+                         { keyb_mod(0, DKY_DEAD_GRAVE, 1); }
+#line 5235 "parser.c"
+    break;
+
+  case 373: /* keyboard_modval: DACUTE  */
+#line 1443 "parser.y"
+                         { keyb_mod(0, DKY_DEAD_ACUTE, 1); }
+#line 5241 "parser.c"
+    break;
+
+  case 374: /* keyboard_modval: DCIRCUM  */
+#line 1444 "parser.y"
+                          { keyb_mod(0, DKY_DEAD_CIRCUMFLEX, 1); }
+#line 5247 "parser.c"
+    break;
+
+  case 375: /* keyboard_modval: DTILDE  */
+#line 1445 "parser.y"
+                         { keyb_mod(0, DKY_DEAD_TILDE, 1); }
+#line 5253 "parser.c"
+    break;
+
+  case 376: /* keyboard_modval: DBREVE  */
+#line 1446 "parser.y"
+                         { keyb_mod(0, DKY_DEAD_BREVE, 1); }
+#line 5259 "parser.c"
+    break;
+
+  case 377: /* keyboard_modval: DABOVED  */
+#line 1447 "parser.y"
+                          { keyb_mod(0, DKY_DEAD_ABOVEDOT, 1); }
+#line 5265 "parser.c"
+    break;
+
+  case 378: /* keyboard_modval: DDIARES  */
+#line 1448 "parser.y"
+                          { keyb_mod(0, DKY_DEAD_DIAERESIS, 1); }
+#line 5271 "parser.c"
+    break;
+
+  case 379: /* keyboard_modval: DABOVER  */
+#line 1449 "parser.y"
+                          { keyb_mod(0, DKY_DEAD_ABOVERING, 1); }
+#line 5277 "parser.c"
+    break;
+
+  case 380: /* keyboard_modval: DDACUTE  */
+#line 1450 "parser.y"
+                          { keyb_mod(0, DKY_DEAD_DOUBLEACUTE, 1); }
+#line 5283 "parser.c"
+    break;
+
+  case 381: /* keyboard_modval: DCEDILLA  */
+#line 1451 "parser.y"
+                           { keyb_mod(0, DKY_DEAD_CEDILLA, 1); }
+#line 5289 "parser.c"
+    break;
+
+  case 382: /* keyboard_modval: DIOTA  */
+#line 1452 "parser.y"
+                        { keyb_mod(0, DKY_VOID, 1); }
+#line 5295 "parser.c"
+    break;
+
+  case 383: /* keyboard_modval: DOGONEK  */
+#line 1453 "parser.y"
+                          { keyb_mod(0,DKY_DEAD_OGONEK, 1); }
+#line 5301 "parser.c"
+    break;
+
+  case 384: /* keyboard_modval: DCARON  */
+#line 1454 "parser.y"
+                         { keyb_mod(0, DKY_DEAD_CARON, 1); }
+#line 5307 "parser.c"
+    break;
+
+  case 385: /* keyboard_modval: INTEGER  */
+#line 1455 "parser.y"
+                          { keyb_mod(0, (yyvsp[0].i_value), 0); }
+#line 5313 "parser.c"
+    break;
+
+  case 386: /* keyboard_modval: '(' expression ')'  */
+#line 1456 "parser.y"
+                                     { keyb_mod(0, (yyvsp[-1].i_value), 0); }
+#line 5319 "parser.c"
+    break;
+
+  case 387: /* keyboard_modval: string_unquoted  */
+#line 1457 "parser.y"
+                                  {
+			char *p = (yyvsp[0].s_value);
+			while (*p) keyb_mod(0, *p++, 0);
+			free((yyvsp[0].s_value));
+		}
+#line 5329 "parser.c"
+    break;
+
+  case 390: /* ttylocks_flag: DIRECTORY string_expr  */
+#line 1469 "parser.y"
+                                        { free(config.tty_lockdir); config.tty_lockdir = (yyvsp[0].s_value); }
+#line 5335 "parser.c"
+    break;
+
+  case 391: /* ttylocks_flag: NAMESTUB string_expr  */
+#line 1470 "parser.y"
+                                        { free(config.tty_lockfile); config.tty_lockfile = (yyvsp[0].s_value); }
+#line 5341 "parser.c"
+    break;
+
+  case 392: /* ttylocks_flag: BINARY  */
+#line 1471 "parser.y"
+                                        { config.tty_lockbinary = TRUE; }
+#line 5347 "parser.c"
+    break;
+
+  case 393: /* ttylocks_flag: STRING  */
+#line 1473 "parser.y"
+                    { yyerror("unrecognized ttylocks flag '%s'", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5353 "parser.c"
+    break;
+
+  case 397: /* serial_flag: DEVICE string_expr  */
+#line 1482 "parser.y"
+                                                { free(sptr->dev); sptr->dev = (yyvsp[0].s_value); }
+#line 5359 "parser.c"
+    break;
+
+  case 398: /* serial_flag: VIRTUAL  */
+#line 1483 "parser.y"
+                                          {
+					   if (isatty(0)) {
+					     sptr->virt = TRUE;
+					     sptr->pseudo = TRUE;
+					     no_local_video = 1;
+					     sptr->dev = strdup(ttyname(0));
+					     config.dumb_video = 1;
+					     if (!config.tty_stderr) // can be 2
+					       config.tty_stderr = 1;
+					   } else {
+					     error("FD 0 is not a tty, can't "
+					           "use a virtual com port\n");
+					     exit(1);
+					   }
+					  }
+#line 5379 "parser.c"
+    break;
+
+  case 399: /* serial_flag: PSEUDO  */
+#line 1498 "parser.y"
+                                          { sptr->pseudo = TRUE; }
+#line 5385 "parser.c"
+    break;
+
+  case 400: /* serial_flag: VMODEM  */
+#line 1499 "parser.y"
+                                          { sptr->vmodem = TRUE; }
+#line 5391 "parser.c"
+    break;
+
+  case 401: /* serial_flag: RTSCTS  */
+#line 1500 "parser.y"
+                                          { sptr->system_rtscts = TRUE; }
+#line 5397 "parser.c"
+    break;
+
+  case 402: /* serial_flag: LOWLAT  */
+#line 1501 "parser.y"
+                                          { sptr->low_latency = TRUE; }
+#line 5403 "parser.c"
+    break;
+
+  case 403: /* serial_flag: PCCOM  */
+#line 1502 "parser.y"
+                                          { sptr->custom = SER_CUSTOM_PCCOM; }
+#line 5409 "parser.c"
+    break;
+
+  case 404: /* serial_flag: COM expression  */
+#line 1503 "parser.y"
+                                          { sptr->real_comport = (yyvsp[0].i_value); }
+#line 5415 "parser.c"
+    break;
+
+  case 405: /* serial_flag: BASE expression  */
+#line 1504 "parser.y"
+                                                { sptr->base_port = (yyvsp[0].i_value); }
+#line 5421 "parser.c"
+    break;
+
+  case 406: /* serial_flag: IRQ expression  */
+#line 1505 "parser.y"
+                                                { sptr->irq = (yyvsp[0].i_value); }
+#line 5427 "parser.c"
+    break;
+
+  case 407: /* serial_flag: MOUSE  */
+#line 1506 "parser.y"
+                                        { sptr->mouse = 1;
+					  config.num_serial_mices++; }
+#line 5434 "parser.c"
+    break;
+
+  case 408: /* serial_flag: EXEC string_expr  */
+#line 1508 "parser.y"
+                                          { free(sptr->exec);
+					    sptr->exec = strdup((yyvsp[0].s_value)); }
+#line 5441 "parser.c"
+    break;
+
+  case 409: /* serial_flag: WRFILE string_expr  */
+#line 1510 "parser.y"
+                                          { free(sptr->wrfile);
+					    sptr->wrfile = strdup((yyvsp[0].s_value)); }
+#line 5448 "parser.c"
+    break;
+
+  case 410: /* serial_flag: NULLMM string_expr  */
+#line 1512 "parser.y"
+                                          { sptr->nullmm = atoi((yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5454 "parser.c"
+    break;
+
+  case 411: /* serial_flag: READONLY  */
+#line 1513 "parser.y"
+                                        { sptr->ro = 1; }
+#line 5460 "parser.c"
+    break;
+
+  case 412: /* serial_flag: STRING  */
+#line 1515 "parser.y"
+                    { yyerror("unrecognized serial flag '%s'", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5466 "parser.c"
+    break;
+
+  case 416: /* printer_flag: LPT expression  */
+#line 1524 "parser.y"
+                                        { c_printers = (yyvsp[0].i_value) - 1; }
+#line 5472 "parser.c"
+    break;
+
+  case 417: /* printer_flag: COMMAND string_expr  */
+#line 1525 "parser.y"
+                                        { free(pptr->prtcmd); pptr->prtcmd = (yyvsp[0].s_value); }
+#line 5478 "parser.c"
+    break;
+
+  case 418: /* printer_flag: TIMEOUT expression  */
+#line 1526 "parser.y"
+                                        { pptr->delay = (yyvsp[0].i_value); }
+#line 5484 "parser.c"
+    break;
+
+  case 419: /* printer_flag: L_FILE string_expr  */
+#line 1527 "parser.y"
+                                                { free(pptr->dev); pptr->dev = (yyvsp[0].s_value); }
+#line 5490 "parser.c"
+    break;
+
+  case 420: /* printer_flag: BASE expression  */
+#line 1528 "parser.y"
+                                                { pptr->base_port = (yyvsp[0].i_value); }
+#line 5496 "parser.c"
+    break;
+
+  case 421: /* printer_flag: STRING  */
+#line 1530 "parser.y"
+                    { yyerror("unrecognized printer flag %s", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5502 "parser.c"
+    break;
+
+  case 425: /* floppy_flag: READONLY  */
+#line 1539 "parser.y"
+                                        { dptr->rdonly = 1; }
+#line 5508 "parser.c"
+    break;
+
+  case 426: /* floppy_flag: THREEINCH  */
+#line 1540 "parser.y"
+                                { dptr->default_cmos = THREE_INCH_FLOPPY; }
+#line 5514 "parser.c"
+    break;
+
+  case 427: /* floppy_flag: THREEINCH_2880  */
+#line 1541 "parser.y"
+                                        { dptr->default_cmos = THREE_INCH_2880KFLOP; }
+#line 5520 "parser.c"
+    break;
+
+  case 428: /* floppy_flag: THREEINCH_720  */
+#line 1542 "parser.y"
+                                { dptr->default_cmos = THREE_INCH_720KFLOP; }
+#line 5526 "parser.c"
+    break;
+
+  case 429: /* floppy_flag: FIVEINCH  */
+#line 1543 "parser.y"
+                                { dptr->default_cmos = FIVE_INCH_FLOPPY; }
+#line 5532 "parser.c"
+    break;
+
+  case 430: /* floppy_flag: FIVEINCH_360  */
+#line 1544 "parser.y"
+                                { dptr->default_cmos = FIVE_INCH_360KFLOP; }
+#line 5538 "parser.c"
+    break;
+
+  case 431: /* floppy_flag: BOOT  */
+#line 1545 "parser.y"
+                                { dptr->boot = 1; }
+#line 5544 "parser.c"
+    break;
+
+  case 432: /* floppy_flag: L_FLOPPY string_expr  */
+#line 1547 "parser.y"
+                  {
+		  struct stat st;
+
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a floppy-device given.");
+		  if (stat((yyvsp[0].s_value), &st) < 0) {
+		    yyerror("Could not stat floppy device.");
+		  }
+		  if (S_ISREG(st.st_mode)) {
+		    dptr->type = IMAGE;
+		  } else if (S_ISBLK(st.st_mode)) {
+		    dptr->type = FLOPPY;
+		  } else if (S_ISDIR(st.st_mode)) {
+		    dptr->type = DIR_TYPE;
+		  } else {
+		    yyerror("Floppy device/file %s is wrong type", (yyvsp[0].s_value));
+		  }
+		  free(dptr->dev_name);
+		  dptr->dev_name = (yyvsp[0].s_value);
+		  dptr->floppy = 1;  // tell IMAGE and DIR we are a floppy
+		  }
+#line 5570 "parser.c"
+    break;
+
+  case 433: /* floppy_flag: DEVICE string_expr  */
+#line 1569 "parser.y"
+                  {
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a disk-image file or device given.");
+		  free(dptr->dev_name);
+		  dptr->dev_name = (yyvsp[0].s_value);
+		  }
+#line 5581 "parser.c"
+    break;
+
+  case 434: /* floppy_flag: DIRECTORY string_expr  */
+#line 1576 "parser.y"
+                  {
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a directory given.");
+		  dptr->type = DIR_TYPE;
+		  free(dptr->dev_name);
+		  dptr->dev_name = (yyvsp[0].s_value);
+		  }
+#line 5593 "parser.c"
+    break;
+
+  case 435: /* floppy_flag: STRING  */
+#line 1584 "parser.y"
+                    { yyerror("unrecognized floppy disk flag '%s'\n", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5599 "parser.c"
+    break;
+
+  case 439: /* disk_flag: READONLY  */
+#line 1591 "parser.y"
+                                        { dptr->rdonly = 1; }
+#line 5605 "parser.c"
+    break;
+
+  case 440: /* disk_flag: DISKCYL4096  */
+#line 1592 "parser.y"
+                                { dptr->diskcyl4096 = 1; }
+#line 5611 "parser.c"
+    break;
+
+  case 441: /* disk_flag: HDTYPE1  */
+#line 1593 "parser.y"
+                                { dptr->hdtype = 1; }
+#line 5617 "parser.c"
+    break;
+
+  case 442: /* disk_flag: HDTYPE2  */
+#line 1594 "parser.y"
+                                { dptr->hdtype = 2; }
+#line 5623 "parser.c"
+    break;
+
+  case 443: /* disk_flag: HDTYPE9  */
+#line 1595 "parser.y"
+                                { dptr->hdtype = 9; }
+#line 5629 "parser.c"
+    break;
+
+  case 444: /* disk_flag: SECTORS expression  */
+#line 1596 "parser.y"
+                                        { dptr->sectors = (yyvsp[0].i_value); }
+#line 5635 "parser.c"
+    break;
+
+  case 445: /* disk_flag: CYLINDERS expression  */
+#line 1597 "parser.y"
+                                        { dptr->tracks = (yyvsp[0].i_value); }
+#line 5641 "parser.c"
+    break;
+
+  case 446: /* disk_flag: TRACKS expression  */
+#line 1598 "parser.y"
+                                        { dptr->tracks = (yyvsp[0].i_value); }
+#line 5647 "parser.c"
+    break;
+
+  case 447: /* disk_flag: HEADS expression  */
+#line 1599 "parser.y"
+                                                { dptr->heads = (yyvsp[0].i_value); }
+#line 5653 "parser.c"
+    break;
+
+  case 448: /* disk_flag: OFFSET expression  */
+#line 1600 "parser.y"
+                                        { dptr->header = (yyvsp[0].i_value); }
+#line 5659 "parser.c"
+    break;
+
+  case 449: /* disk_flag: L_PARTITION  */
+#line 1601 "parser.y"
+                                        { dptr->part_image = 1; }
+#line 5665 "parser.c"
+    break;
+
+  case 450: /* disk_flag: OVERLAY string_expr  */
+#line 1603 "parser.y"
+                    {
+		    free(dptr->overlay);
+		    dptr->overlay = (yyvsp[0].s_value);
+		    }
+#line 5674 "parser.c"
+    break;
+
+  case 451: /* disk_flag: OVERLAY_COMMIT  */
+#line 1607 "parser.y"
+                                        { dptr->overlay_mode = COW_COMMIT; }
+#line 5680 "parser.c"
+    break;
+
+  case 452: /* disk_flag: OVERLAY_DISCARD  */
+#line 1608 "parser.y"
+                                        { dptr->overlay_mode = COW_DISCARD; }
+#line 5686 "parser.c"
+    break;
+
+  case 453: /* disk_flag: STRING  */
+#line 1610 "parser.y"
+                    { yyerror("unrecognized disk flag '%s'\n", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5692 "parser.c"
+    break;
+
+  case 455: /* disk_type: HDIMAGE string_expr  */
+#line 1615 "parser.y"
+                  {
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a harddisk-image file given.");
+		  set_hdimage(dptr, (yyvsp[0].s_value));
+		  }
+#line 5702 "parser.c"
+    break;
+
+  case 456: /* disk_type: WHOLEDISK STRING  */
+#line 1621 "parser.y"
+                  {
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a harddisk given.");
+		  dptr->type = HDISK;
+		  dptr->dev_name = (yyvsp[0].s_value);
+		  }
+#line 5713 "parser.c"
+    break;
+
+  case 457: /* disk_type: L_PARTITION string_expr INTEGER  */
+#line 1628 "parser.y"
+                  {
+                  yywarn("{ partition \"%s\" %d } the"
+			 " token '%d' is ignored and can be removed.",
+			 (yyvsp[-1].s_value),(yyvsp[0].i_value),(yyvsp[0].i_value));
+		  do_part((yyvsp[-1].s_value));
+		  }
+#line 5724 "parser.c"
+    break;
+
+  case 458: /* disk_type: L_PARTITION string_expr  */
+#line 1635 "parser.y"
+                  { do_part((yyvsp[0].s_value)); }
+#line 5730 "parser.c"
+    break;
+
+  case 459: /* disk_type: DIRECTORY string_expr  */
+#line 1637 "parser.y"
+                  {
+		  if (dptr->dev_name != NULL)
+		    yyerror("Two names for a directory given.");
+		  dptr->type = DIR_TYPE;
+		  dptr->dev_name = (yyvsp[0].s_value);
+		  }
+#line 5741 "parser.c"
+    break;
+
+  case 460: /* disk_type: STRING  */
+#line 1644 "parser.y"
+                    { yyerror("unrecognized disk type '%s'\n", (yyvsp[0].s_value)); free((yyvsp[0].s_value)); }
+#line 5747 "parser.c"
+    break;
+
+  case 464: /* port_flag: INTEGER  */
+#line 1654 "parser.y"
+                   {
+		   c_printf("CONF: I/O port 0x%04x\n", (unsigned short)(yyvsp[0].i_value));
+	           allow_io((yyvsp[0].i_value), 1, ports_permission, ports_ormask,
+	                    ports_andmask, portspeed);
+		   if (portspeed) portspeed += ((portspeed>0) ? 1 : -1);
+	           }
+#line 5758 "parser.c"
+    break;
+
+  case 465: /* port_flag: '(' expression ')'  */
+#line 1661 "parser.y"
+                   {
+	           allow_io((yyvsp[-1].i_value), 1, ports_permission, ports_ormask,
+	                    ports_andmask, portspeed);
+		   if (portspeed) portspeed += ((portspeed>0) ? 1 : -1);
+	           }
+#line 5768 "parser.c"
+    break;
+
+  case 466: /* port_flag: RANGE INTEGER INTEGER  */
+#line 1667 "parser.y"
+                   {
+		   if (portspeed > 1) portspeed = 0;
+		   c_printf("CONF: range of I/O ports 0x%04x-0x%04x\n",
+			    (unsigned short)(yyvsp[-1].i_value), (unsigned short)(yyvsp[0].i_value));
+		   allow_io((yyvsp[-1].i_value), (yyvsp[0].i_value) - (yyvsp[-1].i_value) + 1, ports_permission, ports_ormask,
+			    ports_andmask, portspeed);
+		   portspeed=0;
+		   }
+#line 5781 "parser.c"
+    break;
+
+  case 467: /* port_flag: RANGE expression ',' expression  */
+#line 1676 "parser.y"
+                   {
+		   if (portspeed > 1) portspeed = 0;
+		   c_printf("CONF: range of I/O ports 0x%04x-0x%04x\n",
+			    (unsigned short)(yyvsp[-2].i_value), (unsigned short)(yyvsp[0].i_value));
+		   allow_io((yyvsp[-2].i_value), (yyvsp[0].i_value) - (yyvsp[-2].i_value) + 1, ports_permission, ports_ormask,
+			    ports_andmask, portspeed);
+		   portspeed=0;
+		   }
+#line 5794 "parser.c"
+    break;
+
+  case 468: /* port_flag: RDONLY  */
+#line 1684 "parser.y"
+                                        { ports_permission = IO_READ; }
+#line 5800 "parser.c"
+    break;
+
+  case 469: /* port_flag: WRONLY  */
+#line 1685 "parser.y"
+                                        { ports_permission = IO_WRITE; }
+#line 5806 "parser.c"
+    break;
+
+  case 470: /* port_flag: RDWR  */
+#line 1686 "parser.y"
+                                        { ports_permission = IO_RDWR; }
+#line 5812 "parser.c"
+    break;
+
+  case 471: /* port_flag: ORMASK expression  */
+#line 1687 "parser.y"
+                                        { ports_ormask = (yyvsp[0].i_value); }
+#line 5818 "parser.c"
+    break;
+
+  case 472: /* port_flag: ANDMASK expression  */
+#line 1688 "parser.y"
+                                        { ports_andmask = (yyvsp[0].i_value); }
+#line 5824 "parser.c"
+    break;
+
+  case 473: /* port_flag: FAST  */
+#line 1689 "parser.y"
+                                        { portspeed = 1; }
+#line 5830 "parser.c"
+    break;
+
+  case 474: /* port_flag: SLOW  */
+#line 1690 "parser.y"
+                                        { portspeed = -1; }
+#line 5836 "parser.c"
+    break;
+
+  case 475: /* port_flag: DEVICE string_expr  */
+#line 1691 "parser.y"
+                                        { /* compatibility */ free((yyvsp[0].s_value)); }
+#line 5842 "parser.c"
+    break;
+
+  case 476: /* port_flag: STRING  */
+#line 1693 "parser.y"
+                    { yyerror("unrecognized port command '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 5849 "parser.c"
+    break;
+
+  case 480: /* trace_port_flag: INTEGER  */
+#line 1702 "parser.y"
+                        { register_port_traceing((yyvsp[0].i_value), (yyvsp[0].i_value)); }
+#line 5855 "parser.c"
+    break;
+
+  case 481: /* trace_port_flag: '(' expression ')'  */
+#line 1704 "parser.y"
+                        { register_port_traceing((yyvsp[-1].i_value), (yyvsp[-1].i_value)); }
+#line 5861 "parser.c"
+    break;
+
+  case 482: /* trace_port_flag: RANGE INTEGER INTEGER  */
+#line 1706 "parser.y"
+                        { register_port_traceing((yyvsp[-1].i_value), (yyvsp[0].i_value)); }
+#line 5867 "parser.c"
+    break;
+
+  case 483: /* trace_port_flag: RANGE expression ',' expression  */
+#line 1708 "parser.y"
+                        { register_port_traceing((yyvsp[-2].i_value), (yyvsp[0].i_value)); }
+#line 5873 "parser.c"
+    break;
+
+  case 484: /* trace_port_flag: CLEAR  */
+#line 1709 "parser.y"
+                        { clear_port_traceing(); }
+#line 5879 "parser.c"
+    break;
+
+  case 485: /* trace_port_flag: STRING  */
+#line 1711 "parser.y"
+                    { yyerror("unrecognized port trace command '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 5886 "parser.c"
+    break;
+
+  case 489: /* trace_mmio_flag: INTEGER  */
+#line 1722 "parser.y"
+      { register_mmio_tracing((yyvsp[0].i_value), (yyvsp[0].i_value));
+        c_printf("CONF: MMIO tracing registered for 0x%x\n", (yyvsp[0].i_value)); }
+#line 5893 "parser.c"
+    break;
+
+  case 490: /* trace_mmio_flag: '(' expression ')'  */
+#line 1725 "parser.y"
+      { register_mmio_tracing((yyvsp[-1].i_value), (yyvsp[-1].i_value));
+        c_printf("CONF: MMIO tracing registered for 0x%x\n", (yyvsp[-1].i_value)); }
+#line 5900 "parser.c"
+    break;
+
+  case 491: /* trace_mmio_flag: RANGE INTEGER INTEGER  */
+#line 1728 "parser.y"
+      { register_mmio_tracing((yyvsp[-1].i_value), (yyvsp[0].i_value));
+        c_printf("CONF: MMIO tracing registered for 0x%x-0x%x\n", (yyvsp[-1].i_value), (yyvsp[0].i_value)); }
+#line 5907 "parser.c"
+    break;
+
+  case 492: /* trace_mmio_flag: RANGE expression ',' expression  */
+#line 1731 "parser.y"
+      { register_mmio_tracing((yyvsp[-2].i_value), (yyvsp[0].i_value));
+        c_printf("CONF: MMIO tracing registered for 0x%x-0x%x\n", (yyvsp[-2].i_value), (yyvsp[0].i_value)); }
+#line 5914 "parser.c"
+    break;
+
+  case 493: /* trace_mmio_flag: STRING  */
+#line 1734 "parser.y"
+       { yyerror("unrecognized mmio trace command '%s'", (yyvsp[0].s_value));
+         free((yyvsp[0].s_value)); }
+#line 5921 "parser.c"
+    break;
+
+  case 497: /* sillyint_flag: INTEGER  */
+#line 1744 "parser.y"
+                          { set_irq_value(1, (yyvsp[0].i_value)); }
+#line 5927 "parser.c"
+    break;
+
+  case 498: /* sillyint_flag: '(' expression ')'  */
+#line 1745 "parser.y"
+                                     { set_irq_value(1, (yyvsp[-1].i_value)); }
+#line 5933 "parser.c"
+    break;
+
+  case 499: /* sillyint_flag: USE_SIGIO expression  */
+#line 1746 "parser.y"
+                                       { set_irq_value(0x10001, (yyvsp[0].i_value)); }
+#line 5939 "parser.c"
+    break;
+
+  case 500: /* sillyint_flag: RANGE INTEGER INTEGER  */
+#line 1747 "parser.y"
+                                        { set_irq_range(1, (yyvsp[-1].i_value), (yyvsp[0].i_value)); }
+#line 5945 "parser.c"
+    break;
+
+  case 501: /* sillyint_flag: RANGE expression ',' expression  */
+#line 1748 "parser.y"
+                                                  { set_irq_range(1, (yyvsp[-2].i_value), (yyvsp[0].i_value)); }
+#line 5951 "parser.c"
+    break;
+
+  case 502: /* sillyint_flag: USE_SIGIO RANGE INTEGER INTEGER  */
+#line 1749 "parser.y"
+                                                  { set_irq_range(0x10001, (yyvsp[-1].i_value), (yyvsp[0].i_value)); }
+#line 5957 "parser.c"
+    break;
+
+  case 503: /* sillyint_flag: USE_SIGIO RANGE expression ',' expression  */
+#line 1750 "parser.y"
+                                                            { set_irq_range(0x10001, (yyvsp[-2].i_value), (yyvsp[0].i_value)); }
+#line 5963 "parser.c"
+    break;
+
+  case 504: /* sillyint_flag: STRING  */
+#line 1752 "parser.y"
+                    { yyerror("unrecognized irqpassing command '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 5970 "parser.c"
+    break;
+
+  case 508: /* ems_flag: INTEGER  */
+#line 1763 "parser.y"
+                   {
+		     config.ems_size = (yyvsp[0].i_value);
+		     if ((yyvsp[0].i_value) > 0) c_printf("CONF: %dk bytes EMS memory\n", (yyvsp[0].i_value));
+	           }
+#line 5979 "parser.c"
+    break;
+
+  case 509: /* ems_flag: '(' expression ')'  */
+#line 1768 "parser.y"
+                   {
+		     config.ems_size = (yyvsp[-1].i_value);
+		     if ((yyvsp[-1].i_value) > 0) c_printf("CONF: %dk bytes EMS memory\n", (yyvsp[-1].i_value));
+	           }
+#line 5988 "parser.c"
+    break;
+
+  case 510: /* ems_flag: EMS_SIZE expression  */
+#line 1773 "parser.y"
+                   {
+		     config.ems_size = (yyvsp[0].i_value);
+		     if ((yyvsp[0].i_value) > 0) c_printf("CONF: %dk bytes EMS memory\n", (yyvsp[0].i_value));
+		   }
+#line 5997 "parser.c"
+    break;
+
+  case 511: /* ems_flag: EMS_FRAME expression  */
+#line 1778 "parser.y"
+                   {
+/* is there a technical reason why the EMS frame can't be at 0xC0000 or
+   0xA0000 if there's space? */
+#if 0
+		     if ( (((yyvsp[0].i_value) & 0xfc00)>=0xc800) && (((yyvsp[0].i_value) & 0xfc00)<=0xe000) ) {
+		       config.ems_frame = (yyvsp[0].i_value) & 0xfc00;
+		       c_printf("CONF: EMS-frame = 0x%04x\n", config.ems_frame);
+		     }
+		     else yyerror("wrong EMS-frame: 0x%04x", (yyvsp[0].i_value));
+#endif
+	             config.ems_frame = (yyvsp[0].i_value) & 0xfc00;
+		     c_printf("CONF: EMS-frame = 0x%04x\n", config.ems_frame);
+		   }
+#line 6015 "parser.c"
+    break;
+
+  case 512: /* ems_flag: EMS_UMA_PAGES expression  */
+#line 1792 "parser.y"
+                   {
+		     config.ems_uma_pages = (yyvsp[0].i_value);
+		   }
+#line 6023 "parser.c"
+    break;
+
+  case 513: /* ems_flag: EMS_CONV_PAGES expression  */
+#line 1796 "parser.y"
+                   {
+		     config.ems_cnv_pages = (yyvsp[0].i_value);
+		   }
+#line 6031 "parser.c"
+    break;
+
+  case 514: /* ems_flag: STRING  */
+#line 1800 "parser.y"
+                    { yyerror("unrecognized ems command '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 6038 "parser.c"
+    break;
+
+  case 518: /* hardware_ram_flag: INTEGER  */
+#line 1811 "parser.y"
+                   {
+                     if (!register_hardware_ram('h', (yyvsp[0].i_value), PAGE_SIZE)) {
+                       yyerror("wrong hardware ram address : 0x%08x", (yyvsp[0].i_value));
+                     }
+	           }
+#line 6048 "parser.c"
+    break;
+
+  case 519: /* hardware_ram_flag: '(' expression ')'  */
+#line 1817 "parser.y"
+                   {
+                     if (!register_hardware_ram('h', (yyvsp[-1].i_value), PAGE_SIZE)) {
+                       yyerror("wrong hardware ram address : 0x%08x", (yyvsp[-1].i_value));
+                     }
+	           }
+#line 6058 "parser.c"
+    break;
+
+  case 520: /* hardware_ram_flag: RANGE INTEGER INTEGER  */
+#line 1823 "parser.y"
+                   {
+                     if (register_hardware_ram('h', (yyvsp[-1].i_value), (yyvsp[0].i_value) - (yyvsp[-1].i_value)))
+	               c_printf("CONF: hardware ram pages at 0x%08x-%08x\n", (yyvsp[-1].i_value), (yyvsp[0].i_value));
+                     else
+                       yyerror("wrong hardware ram address : 0x%08x", (yyvsp[-1].i_value));
+		   }
+#line 6069 "parser.c"
+    break;
+
+  case 521: /* hardware_ram_flag: RANGE expression ',' expression  */
+#line 1830 "parser.y"
+                   {
+                     if (register_hardware_ram('h', (yyvsp[-2].i_value), (yyvsp[0].i_value) - (yyvsp[-2].i_value)))
+	               c_printf("CONF: hardware ram pages at 0x%08x-%08x\n", (yyvsp[-2].i_value), (yyvsp[0].i_value));
+                     else
+                       yyerror("wrong hardware ram address : 0x%08x", (yyvsp[-2].i_value));
+		   }
+#line 6080 "parser.c"
+    break;
+
+  case 522: /* hardware_ram_flag: STRING  */
+#line 1837 "parser.y"
+                    { yyerror("unrecognized hardware ram command '%s'", (yyvsp[0].s_value));
+		      free((yyvsp[0].s_value)); }
+#line 6087 "parser.c"
+    break;
+
+  case 526: /* int_bool: expression  */
+#line 1851 "parser.y"
+                {
+			if ((yyvsp[0].i_value) == -2) {
+				yyerror("got 'on', expected 'off' or an integer");
+			}
+		}
+#line 6097 "parser.c"
+    break;
+
+  case 527: /* irq_bool: expression  */
+#line 1858 "parser.y"
+                           {
+			if ( (yyvsp[0].i_value) && (((yyvsp[0].i_value) < 2) || ((yyvsp[0].i_value) > 15)) ) {
+				yyerror("got '%d', expected 'off' or an integer 2..15", (yyvsp[0].i_value));
+			} 
+		}
+#line 6107 "parser.c"
+    break;
+
+  case 528: /* speaker: L_OFF  */
+#line 1867 "parser.y"
+                                { (yyval.i_value) = SPKR_OFF; }
+#line 6113 "parser.c"
+    break;
+
+  case 529: /* speaker: NATIVE  */
+#line 1868 "parser.y"
+                                { (yyval.i_value) = SPKR_NATIVE; }
+#line 6119 "parser.c"
+    break;
+
+  case 530: /* speaker: EMULATED  */
+#line 1869 "parser.y"
+                                { (yyval.i_value) = SPKR_EMULATED; }
+#line 6125 "parser.c"
+    break;
+
+  case 531: /* speaker: STRING  */
+#line 1870 "parser.y"
+                                { yyerror("got '%s', expected 'emulated' or 'native'", (yyvsp[0].s_value));
+				  free((yyvsp[0].s_value)); }
+#line 6132 "parser.c"
+    break;
+
+  case 532: /* speaker: error  */
+#line 1872 "parser.y"
+                                { yyerror("expected 'emulated' or 'native'"); }
+#line 6138 "parser.c"
+    break;
+
+  case 533: /* cpu_vm: L_AUTO  */
+#line 1875 "parser.y"
+                                { (yyval.i_value) = -1; }
+#line 6144 "parser.c"
+    break;
+
+  case 534: /* cpu_vm: VM86  */
+#line 1876 "parser.y"
+                                { (yyval.i_value) = CPUVM_VM86; }
+#line 6150 "parser.c"
+    break;
+
+  case 535: /* cpu_vm: KVM  */
+#line 1877 "parser.y"
+                                { (yyval.i_value) = CPUVM_KVM; }
+#line 6156 "parser.c"
+    break;
+
+  case 536: /* cpu_vm: EMULATED  */
+#line 1878 "parser.y"
+                                {
+#ifdef X86_EMULATOR
+				 (yyval.i_value) = CPUVM_EMU;
+#else
+				 yyerror("CPU emulator not compiled in");
+#endif
+				}
+#line 6168 "parser.c"
+    break;
+
+  case 537: /* cpu_vm: STRING  */
+#line 1885 "parser.y"
+                                { yyerror("got '%s' for cpu_vm", (yyvsp[0].s_value));
+				  free((yyvsp[0].s_value)); }
+#line 6175 "parser.c"
+    break;
+
+  case 538: /* cpu_vm: error  */
+#line 1887 "parser.y"
+                                { yyerror("bad value for cpu_vm"); }
+#line 6181 "parser.c"
+    break;
+
+  case 539: /* cpu_vm_dpmi: L_AUTO  */
+#line 1890 "parser.y"
+                                { (yyval.i_value) = -1; }
+#line 6187 "parser.c"
+    break;
+
+  case 540: /* cpu_vm_dpmi: NATIVE  */
+#line 1891 "parser.y"
+                                { (yyval.i_value) = CPUVM_NATIVE; }
+#line 6193 "parser.c"
+    break;
+
+  case 541: /* cpu_vm_dpmi: KVM  */
+#line 1892 "parser.y"
+                                { (yyval.i_value) = CPUVM_KVM; }
+#line 6199 "parser.c"
+    break;
+
+  case 542: /* cpu_vm_dpmi: EMULATED  */
+#line 1893 "parser.y"
+                                { (yyval.i_value) = CPUVM_EMU; }
+#line 6205 "parser.c"
+    break;
+
+  case 543: /* cpu_vm_dpmi: STRING  */
+#line 1894 "parser.y"
+                                { yyerror("got '%s' for cpu_vm_dpmi", (yyvsp[0].s_value));
+				  free((yyvsp[0].s_value)); }
+#line 6212 "parser.c"
+    break;
+
+  case 544: /* cpu_vm_dpmi: error  */
+#line 1896 "parser.y"
+                                { yyerror("bad value for cpu_vm_dpmi"); }
+#line 6218 "parser.c"
+    break;
+
+  case 547: /* charset_flag: INTERNAL STRING  */
+#line 1902 "parser.y"
+                                  { set_internal_charset ((yyvsp[0].s_value)); }
+#line 6224 "parser.c"
+    break;
+
+  case 548: /* charset_flag: EXTERNAL STRING  */
+#line 1903 "parser.y"
+                                  { set_external_charset ((yyvsp[0].s_value)); }
+#line 6230 "parser.c"
+    break;
+
+
+#line 6234 "parser.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1906 "parser.y"
+
+
+	/* features */
+
+static void handle_features(int which, int value)
+{
+  if ((which < 0)
+	|| (which >= (sizeof(config.features) / sizeof(config.features[0])))) {
+    c_printf("CONF: wrong feature number %d\n", which);
+    return;
+  }
+  config.features[which] = value;
+  c_printf("CONF: feature %d set to %d\n", which, value);
+}
+
+	/* joystick */
+
+static void set_joy_device(char *devstring)
+{
+  char *spacepos;
+
+  free(config.joy_device[0]);
+  config.joy_device[0] = devstring;
+  config.joy_device[1] = NULL;
+  spacepos = strchr(devstring, ' ');
+  if (spacepos != NULL) {
+    *spacepos = '\0';
+    config.joy_device[1] = spacepos + 1;
+  }
+}
+
+	/* mouse */
+
+static void start_mouse(void)
+{
+  mptr = &config.mouse;
+  mptr->fd = -1;
+  mptr->com = -1;
+  mptr->com_num = -1;
+  mptr->has3buttons = 1;	// drivers can disable this
+}
+
+static void stop_mouse(void)
+{
+  char *p, *p1;
+  if (mptr->dev && (p = strstr(mptr->dev, "com")) && strlen(p) > 3) {
+    /* parse comX setting */
+    if (!isdigit(p[3]) || isdigit(p[4])) {
+      yyerror("wrong $_mouse_dev setting");
+      return;
+    }
+    mptr->com_num = atoi(p + 3);
+    /* see if something else is specified and remove comX */
+    if (p > mptr->dev) {
+      p[-1] = 0;
+    } else if ((p1 = strchr(p, ','))) {
+      int l;
+      p1++;
+      l = strlen(p1);
+      memmove(mptr->dev, p1, l + 1);
+    } else {
+      free(mptr->dev);
+      mptr->dev = NULL;
+    }
+    c_printf("MOUSE: using COM%i\n", mptr->com);
+  }
+
+  mptr->type = mptr->dev_type;
+  c_printf("MOUSE: %s, type %x using internaldriver: %s, emulate3buttons: %s baudrate: %d\n", 
+        mptr->dev && mptr->dev[0] ? mptr->dev : "no device specified",
+        mptr->type, mptr->intdrv ? "yes" : "no", 
+        mptr->emulate3buttons ? "yes" : "no", mptr->baudRate);
+}
+
+	/* debug */
+
+static void start_ports(void)
+{
+  ports_permission = IO_RDWR;
+  ports_ormask = 0;
+  ports_andmask = 0xFFFF;
+}
+
+	/* debug */
+
+static void start_debug(void)
+{
+  set_debug_level('a', 0);	      /* Default is no debugging output at all */
+}
+
+	/* video */
+
+static void start_video(void)
+{
+  free(config.vbios_file);
+  config.vbios_file = NULL;
+  config.vbios_copy = 0;
+  config.vbios_seg  = 0xc000;
+  config.vbios_size = 0x10000;
+  config.console_video = 0;
+  config.cardtype = CARD_NONE;
+  config.chipset = PLAINVGA;
+  config.mapped_bios = 0;
+  config.vga = 0;
+  config.gfxmemsize = 256;
+  config.fullrestore = 0;
+  config.dualmon = 0;
+  config.force_vt_switch = 0;
+}
+
+static void stop_video(void)
+{
+  if ((config.cardtype != CARD_VGA) || !config.console_video) {
+    config.vga = 0;
+  }
+}
+
+	/* vesa modes */
+static void set_vesamodes(int width, int height, int color_bits)
+{
+  vesamode_type *vmt = malloc(sizeof *vmt);
+  if(vmt != NULL) {
+    vmt->width = width;
+    vmt->height = height;
+    vmt->color_bits = color_bits;
+    vmt->next = config.vesamode_list;
+    config.vesamode_list = vmt;
+  }
+}
+
+	/* vbios detection */
+static int auto_vbios_seg = -1;
+static int auto_vbios_size = -1;
+
+static void detect_vbios(void)
+{
+  unsigned char c[0x21];
+  int foffset;
+
+  if (auto_vbios_seg != -1) return;
+  if (!can_do_root_stuff || config.vbios_file) return;
+  for (foffset = 0xc0000; foffset < 0xf0000; foffset += 0x800) {
+    load_file("/dev/mem", foffset, c, sizeof(c));
+    if (c[0]==0x55 && c[1]==0xaa
+        && c[0x1e]=='I' && c[0x1f]=='B' && c[0x20]=='M') {
+      auto_vbios_seg = foffset >> 4;
+      auto_vbios_size = PAGE_ALIGN(c[2] * 0x200);
+      break;
+    }
+  }
+}
+
+static int detect_vbios_seg(void)
+{
+  detect_vbios();
+  return auto_vbios_seg;
+}
+
+static int detect_vbios_size(void)
+{
+  detect_vbios();
+  return auto_vbios_size;
+}
+
+static void stop_ttylocks(void)
+{
+  c_printf("SER: directory %s namestub %s binary %s\n", config.tty_lockdir,
+	   config.tty_lockfile,(config.tty_lockbinary?"Yes":"No"));
+}
+
+	/* serial */
+
+static void start_serial(void)
+{
+  if (c_ser >= MAX_SER)
+    sptr = &nullser;
+  else {
+    /* The defaults for interrupt, base_port, real_comport and dev are 
+    ** automatically filled in inside the do_ser_init routine of serial.c
+    */
+    sptr = &com_cfg[c_ser];
+    sptr->dev = NULL;
+    sptr->irq = 0; 
+    sptr->base_port = 0;
+    sptr->end_port = 0;
+    sptr->real_comport = 0;
+    sptr->mouse = 0;
+    sptr->virt = FALSE;
+    sptr->pseudo = FALSE;
+    sptr->system_rtscts = FALSE;
+    sptr->low_latency = FALSE;
+    sptr->dmx_port = 0;
+    sptr->custom = SER_CUSTOM_NONE;
+  }
+}
+
+
+static void stop_serial(void)
+{
+  if (c_ser >= MAX_SER) {
+    c_printf("SER: too many ports, ignoring %s\n", sptr->dev);
+    return;
+  }
+  c_printf("SER%d: %s", c_ser, sptr->dev ?: "none");
+  if (sptr->base_port)
+    c_printf(" port %x", sptr->base_port);
+  if (sptr->irq)
+    c_printf(" irq %x", sptr->irq);
+  c_printf("\n");
+  c_ser++;
+  config.num_ser = c_ser;
+}
+
+	/* keyboard */
+
+static int keyboard_statement_already = 0;
+
+static void start_keyboard(void)
+{
+  if (!keyboard_statement_already)
+    config.layout_auto = 1;
+  config.console_keyb = 0;
+  keyboard_statement_already = 1;
+}
+
+static void stop_terminal(void)
+{
+}
+
+	/* printer */
+
+static void start_printer(void)
+{
+  pptr->prtcmd = NULL;
+  pptr->dev = NULL;
+  pptr->remaining = -1;
+  pptr->delay = 10;
+}
+
+static void stop_printer(void)
+{
+  printer_config(c_printers, pptr);
+  c_printf("CONF(LPT%d) f: %s   c: %s  t: %d  port: %x\n",
+           c_printers, pptr->dev, pptr->prtcmd,
+           pptr->delay, pptr->base_port);
+  c_printers++;
+  if (c_printers > config.num_lpt)
+    config.num_lpt = c_printers;
+}
+
+	/* disk */
+
+static void start_floppy(void)
+{
+  if (c_fdisks >= MAX_FDISKS)
+    {
+    yyerror("There are too many floppy disks defined");
+    dptr = &nulldisk;          /* Dummy-Entry to avoid core-dumps */
+    }
+  else
+    dptr = &disktab[c_fdisks];
+
+  dptr->sectors = 0;             /* setup default values */
+  dptr->heads   = 0;
+  dptr->tracks  = 0;
+  dptr->type    = FLOPPY;
+  dptr->default_cmos = THREE_INCH_FLOPPY;
+  dptr->timeout = 0;
+  dptr->dev_name = NULL;              /* default-values */
+  dptr->rdonly = 0;
+  dptr->header = 0;
+}
+
+static void dp_init(struct disk *dptr)
+{
+  dptr->type    =  NODISK;
+  dptr->sectors = -1;
+  dptr->heads   = -1;
+  dptr->tracks  = -1;
+  dptr->fdesc   = -1;
+  dptr->hdtype = 0;
+  dptr->timeout = 0;
+  dptr->dev_name = NULL;              /* default-values */
+  dptr->overlay = NULL;
+  dptr->overlay_mode = COW_KEEP;
+  dptr->rdonly = 0;
+  dptr->header = 0;
+}
+
+static void start_disk(void)
+{
+  if (c_hdisks >= MAX_HDISKS)
+    {
+    yyerror("There are too many hard disks defined");
+    dptr = &nulldisk;          /* Dummy-Entry to avoid core-dumps */
+    }
+  else
+    dptr = &hdisktab[c_hdisks];
+
+  dp_init(dptr);
+}
+
+static void start_vnet(char *mode)
+{
+  if (strcmp(mode, "off") == 0) {
+    config.vnet = VNET_TYPE_NONE;
+    return;
+  }
+  if (strcmp(mode, "") == 0) {
+    config.vnet = VNET_TYPE_AUTO;
+    return;
+  }
+  if (strcmp(mode, "tap") == 0) {
+    config.vnet = VNET_TYPE_TAP;
+    return;
+  }
+  if (strcmp(mode, "vde") == 0) {
+    config.vnet = VNET_TYPE_VDE;
+    return;
+  }
+  if (strcmp(mode, "slirp") == 0) {
+    config.vnet = VNET_TYPE_SLIRP;
+    return;
+  }
+  if (strcmp(mode, "eth") == 0)
+    config.vnet = VNET_TYPE_ETH;
+  else {
+    error("Unknown vnet mode \"%s\"\n", mode);
+    config.exitearly = 1;
+  }
+}
+
+static void do_part(char *dev)
+{
+  if (dptr->dev_name != NULL)
+    yyerror("Two names for a partition given.");
+  dptr->type = PARTITION;
+  free(dptr->dev_name);
+  dptr->dev_name = dev;
+#ifdef __linux__
+  dptr->part_info.number = atoi(dptr->dev_name+8);
+#endif
+  if (dptr->part_info.number == 0)
+    yyerror("%s must be a PARTITION, can't find number suffix!\n",
+	    dptr->dev_name);
+}
+
+static void stop_disk(int token)
+{
+#ifdef __linux__
+  FILE   *f;
+  struct mntent *mtab;
+  int    mounted_rw;
+#endif
+
+  if (dptr == &nulldisk)              /* is there any disk? */
+    return;                           /* no, nothing to do */
+
+  if (!dptr->dev_name) {               /* Is there a file/device-name? */
+    if (token == L_FLOPPY)
+      error("floppy %c: no device/file-name given!\n", 'A'+c_fdisks);
+    else
+      error("drive %c: no device/file-name given!\n", 'C'+c_hdisks);
+    return;
+  } else {                               /* check the file/device for existance */
+      struct stat st;
+
+      if (stat(dptr->dev_name, &st) != 0) { /* Does this file exist? */
+        yyerror("disk: device/file %s doesn't exist.", dptr->dev_name);
+      }
+    }
+
+  if (dptr->type == NODISK)    /* Is it one of image, floppy, harddisk ? */
+    yyerror("disk: no device/file-name given!"); /* No, error */
+  else
+    c_printf("CONF: disk type '%s'", disk_t_str(dptr->type));
+
+  if (dptr->type == PARTITION) {
+    c_printf(" partition# %d", dptr->part_info.number);
+#ifdef __linux__
+    mtab = NULL;
+    if ((f = setmntent(MOUNTED, "r")) != NULL) {
+      while ((mtab = getmntent(f)))
+        if (!strcmp(dptr->dev_name, mtab->mnt_fsname)) break;
+      endmntent(f);
+    }
+    if (mtab) {
+      mounted_rw = ( hasmntopt(mtab, MNTOPT_RW) != NULL );
+      if (mounted_rw && !dptr->rdonly) 
+        yyerror("\n\nYou specified '%s' for read-write Direct Partition Access,"
+                "\nit is currently mounted read-write on '%s' !!!\n",
+                dptr->dev_name, mtab->mnt_dir);
+      else if (mounted_rw) 
+        yywarn("You specified '%s' for read-only Direct Partition Access,"
+               "\n         it is currently mounted read-write on '%s'.\n",
+               dptr->dev_name, mtab->mnt_dir);
+      else if (!dptr->rdonly) 
+        yywarn("You specified '%s' for read-write Direct Partition Access,"
+               "\n         it is currently mounted read-only on '%s'.\n",
+               dptr->dev_name, mtab->mnt_dir);
+    }
+#endif
+  }
+
+  if (dptr->type == IMAGE && dptr->part_image)
+    dptr->type = PARTITION; // image of a partition
+
+  if (dptr->overlay_mode != COW_KEEP && !dptr->overlay && dptr->dev_name) {
+    dptr->overlay = malloc(strlen(dptr->dev_name) + 5);
+    sprintf(dptr->overlay, "%s.cow", dptr->dev_name);
+  }
+  if (dptr->overlay && !(dptr->type == IMAGE ||
+      (dptr->type == PARTITION && dptr->part_image)))
+    yyerror("disk: overlay %s needs an image file", dptr->overlay);
+
+  if (dptr->type == IMAGE) {
+    char buf[HEADER_SIZE];
+    struct image_header *header = (struct image_header *)&buf;
+    int fd;
+
+    dptr->header = 0;
+
+    fd = open(dptr->dev_name, O_RDONLY);
+    if (fd != -1) {
+      if (read(fd, &buf, sizeof buf) == HEADER_SIZE) {
+        if (memcmp(header->sig, IMAGE_MAGIC, IMAGE_MAGIC_SIZE) == 0)
+          dptr->header = header->header_end;
+        c_printf(" header_size: %ld", (long)dptr->header);
+      }
+      close(fd);
+    }
+  }
+
+  if (dptr->type == DIR_TYPE)
+    dptr->mfs_idx = mfs_define_drive(dptr->dev_name);
+  else
+    dptr->mfs_idx = 0;
+
+  if (token == L_FLOPPY) {
+    c_printf(" floppy %c:\n", 'A'+c_fdisks);
+    disktab[c_fdisks].drive_num = c_fdisks;
+    c_fdisks++;
+  }
+  else {
+    c_printf(" drive %c:\n", 'C'+c_hdisks);
+    hdisktab[c_hdisks].drive_num = (c_hdisks | 0x80);
+    hdisktab[c_hdisks].log_offs = skipped_disks;
+    c_hdisks++;
+  }
+}
+
+	/* keyboard */
+
+static void do_keyb_layout(const char *layout, int alt)
+{
+  struct keytable_entry *kt = keytable_list;
+
+  while (kt->name) {
+    if (strcmp(kt->name, layout) == 0) {
+      if (alt) {
+        c_printf("CONF: Alternate keyboard-layout %s\n", kt->name);
+        config.altkeytable = kt;
+      } else {
+        c_printf("CONF: Keyboard-layout %s\n", kt->name);
+        config.keytable = kt;
+      }
+      config.layout_auto = 0;
+      return;
+    }
+    kt++;
+  }
+  yyerror("CONF: ERROR -- Keyboard has incorrect layout %s\n", layout);
+}
+
+static void keyb_layout(char *layout)
+{
+  char *p = layout;
+  char *p1;
+
+  if (strcmp(p, "auto") == 0) {
+    /* auto: do it later */
+    config.keytable = NULL;
+    config.layout_auto = 1;
+    return;
+  }
+  while ((p1 = strsep(&p, ",")))
+    do_keyb_layout(p1, p1 != layout);
+}
+
+static void keytable_start(char *layout)
+{
+  keyboard_statement_already = 1;
+  /* switch to builtin layout, then apply mods */
+  keyb_layout(layout);
+}
+
+static void keytable_stop(void)
+{
+}
+
+static void dump_keytables_to_file(char *name)
+{
+  FILE * f;
+  struct keytable_entry *kt = keytable_list;
+
+  f = fopen(name, "w");
+  if (!f) {
+    error("cannot create keytable file %s\n", name);
+    exit(1);
+  }
+  
+  while (kt->name) {
+    dump_keytable(f, kt);
+    kt++;
+  }
+  fclose(f);
+  exit(0);
+}
+
+static void set_irq_value(int bits, int i1)
+{
+  if ((i1>2) && (i1<=15)) {
+    config.sillyint |= (bits << i1);
+    c_printf("CONF: IRQ %d for irqpassing", i1);
+    if (bits & 0x10000)  c_printf(" uses SIGIO\n");
+    else c_printf("\n");
+  }
+  else yyerror("wrong IRQ for irqpassing command: %d", i1);
+}
+
+static void set_irq_range(int bits, int i1, int i2) {
+  int i;
+  if ( (i1<3) || (i1>15) || (i2<3) || (i2>15) || (i1 > i2 ) ) {
+    yyerror("wrong IRQ range for irqpassing command: %d .. %d", i1, i2);
+  }
+  else {
+    for (i=i1; i<=i2; i++) config.sillyint |= (bits << i);
+    c_printf("CONF: range of IRQs for irqpassing %d .. %d", i1, i2);
+    if (bits & 0x10000)  c_printf(" uses SIGIO\n");
+    else c_printf("\n");
+  }
+}
+
+
+	/* errors & warnings */
+
+void yywarn(const char *string, ...)
+{
+  va_list vars;
+  error("@Warning: ");
+  va_start(vars, string);
+  vprint(string, vars);
+  va_end(vars);
+  error("@\n");
+  warnings++;
+}
+
+void yyerror(const char *string, ...)
+{
+  va_list vars;
+  va_start(vars, string);
+  if (include_stack_ptr != 0 && !last_include) {
+	  int i;
+	  error("@In file included from %s:%d\n",
+		  include_fnames[0], include_lines[0]);
+	  for(i = 1; i < include_stack_ptr; i++) {
+		  error("@                 from %s:%d\n",
+			  include_fnames[i], include_lines[i]);
+	  }
+	  last_include = 1;
+  }
+  error("@Error in %s: (line %.3d) ", 
+	  include_fnames[include_stack_ptr], line_count);
+  vprint(string, vars);
+  error("@\n");
+  va_end(vars);
+  errors++;
+}
+
+
+/*
+ * open_file - opens the configuration-file named *filename and returns
+ *             a file-pointer. The error/warning-counters are reset to zero.
+ */
+
+static FILE *open_file(const char *filename)
+{
+  errors   = 0;                  /* Reset error counter */
+  warnings = 0;                  /* Reset counter for warnings */
+
+  if (!filename) return 0;
+  return fopen(filename, "re"); /* Open config-file */
+}
+
+/*
+ * close_file - Close the configuration file and issue a message about
+ *              errors/warnings that occured. If there were errors, the
+ *              flag early-exit is that, so dosemu won't really.
+ */
+
+static void close_file(FILE * file)
+{
+  if (file) fclose(file);                  /* Close the config-file */
+
+  if(errors)
+    error("@%d error(s) detected while parsing the configuration-file\n",
+	    errors);
+  if(warnings)
+    error("@%d warning(s) detected while parsing the configuration-file\n",
+	    warnings);
+
+  if (errors != 0)               /* Exit dosemu on errors */
+    {
+      config.exitearly = TRUE;
+    }
+  errors = 0;
+  warnings = 0;
+}
+
+static void set_hdimage(struct disk *dptr, char *name)
+{
+  char *l = strstr(name, ".lnk");
+
+  c_printf("Setting up hdimage %s\n", name);
+  if (l && strlen(l) == 4) {
+    const char *tmpl = "eval printf `cat %s`";
+    char *cmd, path[1024], *rname;
+    FILE *f;
+    size_t ret;
+
+    asprintf(&cmd, tmpl, name);
+    free(name);
+    f = popen(cmd, "r");
+    free(cmd);
+    ret = fread(path, 1, sizeof(path), f);
+    pclose(f);
+    if (ret == 0)
+      return;
+    path[ret] = '\0';
+    c_printf("Link resolved to %s\n", path);
+    rname = expand_path(path);
+    if (access(rname, R_OK) != 0) {
+      warn("hdimage: %s does not exist\n", rname);
+      free(rname);
+      return;
+    }
+    free(dptr->dev_name);
+    dptr->dev_name = rname;
+    dptr->type = DIR_TYPE;
+    c_printf("Set up as a directory\n");
+    return;
+  }
+  dptr->type = IMAGE;
+  free(dptr->dev_name);
+  dptr->dev_name = name;
+  c_printf("Set up as an image\n");
+}
+
+static int add_drive(const char *name, int rdonly)
+{
+  struct disk *dptr = &hdisktab[c_hdisks];
+  char *rname = expand_path(name);
+  if (access(rname, R_OK) != 0) {
+    free(rname);
+    return -1;
+  }
+  dp_init(dptr);
+  dptr->dev_name = rname;
+  dptr->type = DIR_TYPE;
+  dptr->rdonly = rdonly;
+  dptr->drive_num = (c_hdisks | 0x80);
+  dptr->log_offs = skipped_disks;
+  dptr->mfs_idx = mfs_define_drive(rname);
+  c_printf("Added drive %i (%x): %s\n", c_hdisks, dptr->drive_num, name);
+  c_hdisks++;
+  return 0;
+}
+
+static void set_drive_c(void)
+{
+  int err;
+
+  c_printf("Setting up drive C, %s\n", dosemu_drive_c_path);
+  if (!config.alt_drv_c && !exists_dir(dosemu_drive_c_path)) {
+    char *system_str;
+    c_printf("Creating default drive C\n");
+    err = asprintf(&system_str, "mkdir -p %s/tmp", dosemu_drive_c_path);
+    assert(err != -1);
+    err = system(system_str);
+    free(system_str);
+    if (err) {
+      error("unable to create %s\n", dosemu_drive_c_path);
+      return;
+    }
+  }
+  if (config.alt_drv_c && c_hdisks) {
+    error("wrong mapping of Group 0 to %c\n", 'C' + c_hdisks);
+    dosemu_drive_c_path = strdup(DRIVE_C_DEFAULT);
+    config.alt_drv_c = 0;
+  }
+  config.drive_c_num = c_hdisks | 0x80;
+  err = add_drive(dosemu_drive_c_path, 0);
+  assert(!err);
+}
+
+static void set_dosemu_drive(void)
+{
+  if (!commands_path) {
+    error("can't map utility drive, dosemu2 installation incomplete\n");
+    leavedos(3);
+    return;
+  }
+  add_drive(commands_path, 1);
+}
+
+static void set_default_drives(void)
+{
+#define AD(p) do { \
+    if (p) \
+      add_drive(p, 1); \
+} while (0)
+  c_printf("Setting up default drives from %c\n", 'C' + c_hdisks);
+  if (config.try_freedos) {
+    AD(fddir_boot);
+    AD(fddir_default);
+  } else {
+    AD(comcom_dir);
+    AD(xbat_dir);
+  }
+}
+
+static void set_hostfs_drives(char *drivespec)
+{
+  char *p;
+  int err;
+
+  while ((p = strsep(&drivespec, " "))) {
+    int ro = 0;
+    int cd = 0;
+    int grp = 0;
+    char *d = strchr(p, ':');
+    if (d) {
+      switch (d[1]) {
+	case 'r':
+	    ro++;
+	    break;
+	case 'c':
+	    cd++;
+	    break;
+	case 'g':
+	    grp++;
+	    break;
+      }
+      *d = '\0';
+    }
+    err = add_extra_drive(p, ro, cd, grp);
+    if (err)
+	config.exitearly = 1;
+  }
+}
+
+/* Parse TimeMode, Paul Crawford and Andrew Brooks 2004-08-01 */
+/* Accepts "bios", "pit", "linux", default is "bios". Use with TIMEMODE token */
+int parse_timemode(const char *timemodestr)
+{
+   if (timemodestr == NULL || timemodestr[0] == '\0')
+     return(TM_BIOS); /* default */
+   if (strcmp(timemodestr, "linux")==0)
+     return(TM_LINUX);
+   if (strcmp(timemodestr, "pit")==0)
+     return(TM_PIT);
+   if (strcmp(timemodestr, "bios")==0)
+     return(TM_BIOS);
+   yyerror("Unrecognised time mode (not bios, pit or linux)");
+   return(TM_BIOS);
+}
+
+char *commandline_statements;
+
+static void do_parse(FILE *fp, const char *confname, const char *errtx)
+{
+  yyin = fp;
+  line_count = 1;
+  include_stack_ptr = 0;
+  c_printf("CONF: Parsing %s file.\n", confname);
+  file_being_parsed = strdup(confname);
+  include_fnames[include_stack_ptr] = file_being_parsed;
+  yyrestart(fp);
+  if (yyparse())
+    yyerror(errtx, confname);
+  close_file(fp);
+  include_stack_ptr = 0;
+  include_fnames[include_stack_ptr] = 0;
+  free(file_being_parsed);
+}
+
+int parse_config(const char *confname, const char *dosrcname, int nodosrc)
+{
+  char *dosrc = NULL;
+  FILE *fd;
+#if YYDEBUG != 0
+  yydebug  = 1;
+#endif
+
+  define_config_variable(PARSER_VERSION_STRING);
+  define_config_variable("c_system");
+
+  yy_vbuffer = dosemu_conf;
+  do_parse(NULL, "built-in dosemu.conf", "error in built-in dosemu.conf");
+  if (confname) {
+    yy_vbuffer = NULL;
+    fd = open_file(confname);
+    if (!fd) {
+      fprintf(stderr, "Cannot open base config file %s, Aborting DOSEMU.\n", confname);
+      exit(1);
+    }
+    do_parse(fd, confname, "error in configuration file %s");
+  }
+  move_dosemu_local_dir();
+  if (!nodosrc) {
+    char *newdosrc = NULL;
+    if (!dosrcname) {
+      dosrcname = getenv("_dosemurc");
+      newdosrc = assemble_path(dosemu_localdir_path, dosrcname);
+      if (access(newdosrc, R_OK) == -1)
+        dosrcname = NULL;
+      else
+        dosrcname = newdosrc;
+    }
+    if (!dosrcname) {
+      dosrc = assemble_path(dosemu_localdir_path, DOSEMU_RC);
+      if (access(dosrc, R_OK) == -1) {
+        free(dosrc);
+        dosrc = get_path_in_HOME(DOSEMU_RC);
+      } else if (newdosrc) {
+        error("config file %s missing.\n\tUsing %s\n"
+              "\tExecute `mv %s %s`\n\tto silence this error.\n",
+              newdosrc, dosrc, dosrc, newdosrc);
+      }
+      if (access(dosrc, R_OK) == -1) {
+        free(dosrc);
+        dosrc = NULL;
+      }
+    } else {
+      dosrc = strdup(dosrcname);
+    }
+    if (newdosrc) {
+      free(newdosrc);
+      newdosrc = NULL;
+    }
+  }
+  if (dosrc) {
+    define_config_variable("c_user");
+    yy_vbuffer = NULL;
+    fd = open_file(dosrc);
+    if (!fd) {
+      fprintf(stderr, "Cannot open base config file %s, Aborting DOSEMU.\n",
+            dosrc);
+      free(dosrc);
+      exit(1);
+    }
+    do_parse(fd, dosrc, "error in configuration file %s");
+    free(dosrc);
+  }
+  yy_vbuffer = global_conf;
+  do_parse(NULL, "built-in global.conf", "error in built-in global.conf");
+
+  undefine_config_variable("c_system");
+
+  /* Now we parse any commandline statements from option '-I'
+   */
+
+  if (commandline_statements) {
+      #define XX_NAME "commandline"
+
+      open_file(0);
+      define_config_variable("c_comline");
+      c_printf("Parsing " XX_NAME  " statements.\n");
+      yyin=0;				 /* say: we have no input file */
+      yy_vbuffer=commandline_statements; /* this is the input to scan */
+      do_parse(0, XX_NAME, "error in user's %s statement");
+      undefine_config_variable("c_comline");
+  }
+
+#ifdef TESTING
+  error("TESTING: parser is terminating program\n");
+  exit(0);
+#endif
+  return 1;
+}
+
+#define MAX_CONFIGVARIABLES 128
+char *config_variables[MAX_CONFIGVARIABLES+1] = {0};
+static int config_variables_count = 0;
+static int config_variables_last = 0;
+
+
+char *get_config_variable(const char *name)
+{
+  int i;
+  for (i=0; i< config_variables_count; i++) {
+    if (!strcmp(name, config_variables[i])) {
+      config_variables_last = i;
+      return config_variables[i];
+    }
+  }
+  return 0;
+}
+
+int define_config_variable(const char *name)
+{
+  if (!get_config_variable(name)) {
+    if (config_variables_count < MAX_CONFIGVARIABLES) {
+      config_variables[config_variables_count++] = strdup(name);
+    }
+    else {
+      c_printf("CONF: overflow on config variable list\n");
+      return 0;
+    }
+  }
+  c_printf("CONF: config variable %s set\n", name);
+  return 1;
+}
+
+static int undefine_config_variable(const char *name)
+{
+  if (get_config_variable(name)) {
+    int i;
+    if (!strcmp(name, CONFNAME_V3USED)) parser_version_3_style_used = 0;
+    free(config_variables[config_variables_last]);
+    for (i=config_variables_last; i<(config_variables_count-1); i++) {
+      config_variables[i] = config_variables[i+1];
+    }
+    config_variables_count--;
+    c_printf("CONF: config variable %s unset\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+char *checked_getenv(const char *name)
+{
+  return getenv(name);
+}
+
+static void check_user_var(char *name)
+{
+	char *name_;
+	char *s;
+
+	name_ = malloc(strlen(name)+sizeof(USERVAR_PREF));
+	strcpy(name_, USERVAR_PREF);
+	strcat(name_, name);
+	s = getenv(name_);
+	if (s) {
+		if (getenv(name))
+			c_printf("CONF: variable %s replaced by user\n", name);
+		setenv(name, s, 1);
+		unsetenv(name_);
+	}
+	free(name_);
+}
+
+
+static char *run_shell(char *command)
+{
+	int pipefds[2];
+	pid_t pid;
+	char excode[16] = "1";
+
+	setenv("DOSEMU_SHELL_RETURN", excode, 1);
+	if (pipe(pipefds)) return strdup("");
+	pid = fork();
+	if (pid == -1) return strdup("");
+	if (!pid) {
+		/* child */
+		int ret;
+		close(pipefds[0]);	/* we won't read from the pipe */
+		dup2(pipefds[1], 1);	/* make the pipe child's stdout */
+		priv_drop();	/* drop any priviledges */
+		ret = system(command);
+			/* tell the parent: "we have finished",
+			 * this way we need not to play games with select()
+			 */
+		if (ret == -1) ret = errno;
+		else ret >>=8;
+		write(pipefds[1],"\0\0\0",4);
+		close(pipefds[1]);
+		_exit(ret);
+	}
+	else {
+		/* parent */
+		char *buf = 0;
+		int recsize = 128;
+		int bufsize = 0;
+		int ptr =0;
+		int ret;
+		int status;
+
+		close(pipefds[1]);	/* we won't write to the pipe */
+		do {
+			bufsize = ptr + recsize;
+			if (!buf) buf = malloc(bufsize);
+			else buf = realloc(buf, bufsize);
+			ret = read(pipefds[0], buf+ptr, recsize -1);
+			if (ret > 0) {
+				ptr += ret;
+			}
+		} while (ret >0 && (ret < 4 || memcmp(buf+ptr-4,"\0\0\0",4)));
+		close(pipefds[0]);
+		waitpid(pid, &status, 0);
+		buf[ptr] = 0;
+		if (!buf[0]) {
+			free(buf);
+			buf = strdup("");
+		}
+		sprintf(excode, "%d", WEXITSTATUS(status));
+		setenv("DOSEMU_SHELL_RETURN", excode, 1);
+		return buf;
+	}
+}
+
+
+struct for_each_entry {
+	char *list;
+	char *ptr;
+	int skip_restart;
+};
+
+#define FOR_EACH_DEPTH	16
+static struct for_each_entry *for_each_list = 0;
+
+static int for_each_handling(int loopid, char *varname, char *delim, char *list)
+{
+	struct for_each_entry *fe;
+	char * _new;
+	char saved;
+	if (!for_each_list) {
+		int size = FOR_EACH_DEPTH * sizeof(struct for_each_entry);
+		for_each_list = malloc(size);
+		memset(for_each_list, 0, size);
+	}
+	if (loopid > FOR_EACH_DEPTH) {
+		yyerror("too deeply nested foreach\n");
+		return 0;
+	}
+	fe = for_each_list + loopid;
+	if (!fe->list) {
+		/* starting the loop */
+		fe->ptr = fe->list = strdup(list);
+		fe->skip_restart = 0;
+		if (loopid) {
+			/* in inner loops we need to skip the restart */
+			fe->skip_restart = 1;
+		}
+	}
+	else {
+		if (fe->skip_restart) {
+			fe->skip_restart = 0;
+			return 1;
+		}
+	}
+	while (fe->ptr[0] && strchr(delim,fe->ptr[0])) fe->ptr++;
+	/* subsequent call */
+	if (!fe->ptr[0]) {
+		/* loop end */
+		free(fe->list);
+		fe->list = 0;
+		return (0);
+	}
+	_new = strpbrk(fe->ptr, delim);
+	if (!_new) _new = strchr(fe->ptr,0);
+	saved = *_new;
+	*_new = 0;
+	setenv(varname,fe->ptr,1);
+	if (saved) _new++;
+	fe->ptr = _new;
+	return (1);
+}
+
+#ifdef TESTING_MAIN
+
+static void die(char *reason)
+{
+  error("par dead: %s\n", reason);
+  exit(0);
+}
+
+int
+main(int argc, char **argv)
+{
+  if (argc != 2)
+    die("no filename!");
+
+  if (!parse_config(argv[1], argv[2] /* will be NULL if not given */))
+    die("parse failed!\n");
+}
+
+#endif
+
+/* for keyboard plugin */
+
+
+
+static void keyb_mod(int wich, t_keysym keynum, int unicode)
+{
+	static t_keysym *table = 0;
+	static int count = 0;
+
+	if (wich == ' ') {
+		switch (keynum & 0xFF00) {
+		case 0x000: wich = ' '; break;
+		case 0x100: wich = 'S'; break;
+		case 0x200: wich = 'A'; break;
+		case 0x300: wich = 'N'; break;
+		case 0x400: wich = 'C'; break;
+		case 0x500: wich = 'a'; break;
+		case 0x600: wich = 'c'; break;
+		default: 
+			/* It's a bad value ditch it */
+			wich ='X'; table = 0; count = 0; break;
+		}
+		keynum &= 0xFF;
+	}
+
+	switch (wich) {
+	case ' ': table = config.keytable->key_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'S': table = config.keytable->shift_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'A': table = config.keytable->alt_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'C': table = config.keytable->ctrl_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'a': table = config.keytable->shift_alt_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'c': table = config.keytable->ctrl_alt_map;
+		count=config.keytable->sizemap;
+		break;
+	case 'N': table = config.keytable->num_table;
+		count=config.keytable->sizepad;
+		break;
+	}
+
+
+	if (!table || (count == 0) || (wich != 0 && keynum >= count)) {
+		count = 0;
+		table = 0;
+		return;
+	}
+	if (wich != 0) {
+		table += keynum;
+		count -= keynum;
+		return;
+	}
+	if (!unicode) {
+		if (keynum == 0) {
+			keynum = DKY_VOID;
+		} else {
+			keynum = keynum + 0xEF00;
+		}
+	}
+	if (count > 0) {
+		*table++ = keynum;
+		count--;
+	}
+}
+
+
+static const char *get_key_name(t_keysym key)
+{
+	struct key_names {
+		t_keysym key;
+		const char *name;
+	};
+	static struct key_names names[] =
+	{
+		{ DKY_DEAD_GRAVE,	"dgrave"},
+		{ DKY_DEAD_ACUTE,	"dacute"},
+		{ DKY_DEAD_CIRCUMFLEX,	"dcircum"},
+		{ DKY_DEAD_TILDE,	"dtilde"},
+		{ DKY_DEAD_BREVE,	"dbreve"},
+		{ DKY_DEAD_ABOVEDOT,	"daboved"},
+		{ DKY_DEAD_DIAERESIS,	"ddiares"},
+		{ DKY_DEAD_ABOVERING,	"dabover"},
+		{ DKY_DEAD_DOUBLEACUTE,	"ddacute"},
+		{ DKY_DEAD_CEDILLA,	"dcedilla"},
+		{ DKY_DEAD_OGONEK,	"dogonek"},
+		{ DKY_DEAD_CARON,	"dcaron"},
+	};
+	int i;
+	for(i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+		if (names[i].key == key) {
+			return names[i].name;
+		}
+	}
+	return 0;
+}
+
+static void dump_keytable_part(FILE *f, t_keysym *map, int size)
+{
+  int i, in_string=0;
+  t_keysym c;
+  const char *cc; 
+  char comma=' ', buf[16];
+
+  /* Note: This code assumes every font is a superset of ascii */
+  if (!map) {
+	  return;
+  }
+  size--;
+  for (i=0; i<=size; i++) {
+    c = map[i];
+    if (!(i & 15)) fprintf(f,"    ");
+    cc = get_key_name(c);
+    if (!cc && (c < 128) && isprint(c) && !strchr("\\\"\'`", c)) {
+      if (in_string) fputc(c,f);
+      else {
+        fprintf(f, "%c\"%c", comma, c);
+        in_string = 1;
+      }
+    }
+    else {
+      if (!cc) {
+	if (((c > 0) && (c < 128)) || ((c >= 0xEF00) && (c <= 0xEFFF))) {
+	  sprintf(buf, "%d", c & 0xFF);
+	} else if (c == DKY_VOID) {
+	  strcpy(buf, "0");
+	} else {
+	  sprintf(buf, "\\u%04x", c);
+	}
+	cc = buf;
+      }
+      if (!in_string) fprintf(f, "%c%s", comma, cc);
+      else {
+        fprintf(f, "\",%s", cc);
+        in_string = 0;
+      }
+    }
+    if ((i & 15) == 15) {
+      if (in_string) fputc('"', f);
+      if (i < size) fputc(',', f);
+      fputc('\n', f);
+      in_string = 0;
+      comma = ' ';
+    }
+    else comma = ',';
+  }
+  if (in_string) fputc('"', f);
+  fputc('\n', f);
+}
+
+
+void dump_keytable(FILE *f, struct keytable_entry *kt)
+{
+    fprintf(f, "keytable %s {\n", kt->name);
+    fprintf(f, "  0=\n");
+    dump_keytable_part(f, kt->key_map, kt->sizemap);
+    fprintf(f, "  shift 0=\n");
+    dump_keytable_part(f, kt->shift_map, kt->sizemap);
+    fprintf(f, "  alt 0=\n");
+    dump_keytable_part(f, kt->alt_map, kt->sizemap);
+    fprintf(f, "  numpad 0=\n");
+    dump_keytable_part(f, kt->num_table, kt->sizepad-1);
+    fprintf(f, "  ctrl 0=\n");
+    dump_keytable_part(f, kt->ctrl_map, kt->sizemap);
+    fprintf(f, "  shift-alt 0=\n");
+    dump_keytable_part(f, kt->shift_alt_map, kt->sizemap);
+    fprintf(f, "  ctrl-alt 0=\n");
+    dump_keytable_part(f, kt->ctrl_alt_map, kt->sizemap);
+    fprintf(f, "}\n\n\n");
+}
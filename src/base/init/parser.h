@@ -0,0 +1,774 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_PARSER_H_INCLUDED
+# define YY_YY_PARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    INTEGER = 258,                 /* INTEGER  */
+    L_OFF = 259,                   /* L_OFF  */
+    L_ON = 260,                    /* L_ON  */
+    L_AUTO = 261,                  /* L_AUTO  */
+    L_YES = 262,                   /* L_YES  */
+    L_NO = 263,                    /* L_NO  */
+    CHIPSET_TYPE = 264,            /* CHIPSET_TYPE  */
+    REAL = 265,                    /* REAL  */
+    STRING = 266,                  /* STRING  */
+    VARIABLE = 267,                /* VARIABLE  */
+    EXPRTEST = 268,                /* EXPRTEST  */
+    INTCAST = 269,                 /* INTCAST  */
+    REALCAST = 270,                /* REALCAST  */
+    AND_OP = 271,                  /* AND_OP  */
+    OR_OP = 272,                   /* OR_OP  */
+    XOR_OP = 273,                  /* XOR_OP  */
+    SHR_OP = 274,                  /* SHR_OP  */
+    SHL_OP = 275,                  /* SHL_OP  */
+    NOT_OP = 276,                  /* NOT_OP  */
+    EQ_OP = 277,                   /* EQ_OP  */
+    GE_OP = 278,                   /* GE_OP  */
+    LE_OP = 279,                   /* LE_OP  */
+    NEQ_OP = 280,                  /* NEQ_OP  */
+    STR_EQ_OP = 281,               /* STR_EQ_OP  */
+    STR_NEQ_OP = 282,              /* STR_NEQ_OP  */
+    L_AND_OP = 283,                /* L_AND_OP  */
+    L_OR_OP = 284,                 /* L_OR_OP  */
+    UMINUS = 285,                  /* UMINUS  */
+    UPLUS = 286,                   /* UPLUS  */
+    BIT_NOT_OP = 287,              /* BIT_NOT_OP  */
+    STRLEN = 288,                  /* STRLEN  */
+    STRTOL = 289,                  /* STRTOL  */
+    STRNCMP = 290,                 /* STRNCMP  */
+    STRCAT = 291,                  /* STRCAT  */
+    STRPBRK = 292,                 /* STRPBRK  */
+    STRSPLIT = 293,                /* STRSPLIT  */
+    STRCHR = 294,                  /* STRCHR  */
+    STRRCHR = 295,                 /* STRRCHR  */
+    STRSTR = 296,                  /* STRSTR  */
+    STRDEL = 297,                  /* STRDEL  */
+    STRSPN = 298,                  /* STRSPN  */
+    STRCSPN = 299,                 /* STRCSPN  */
+    SHELL = 300,                   /* SHELL  */
+    DEFINED = 301,                 /* DEFINED  */
+    DEFINE = 302,                  /* DEFINE  */
+    UNDEF = 303,                   /* UNDEF  */
+    IFSTATEMENT = 304,             /* IFSTATEMENT  */
+    WHILESTATEMENT = 305,          /* WHILESTATEMENT  */
+    FOREACHSTATEMENT = 306,        /* FOREACHSTATEMENT  */
+    CHECKUSERVAR = 307,            /* CHECKUSERVAR  */
+    TICKLESS_IDLE = 308,           /* TICKLESS_IDLE  */
+    FASTFLOPPY = 309,              /* FASTFLOPPY  */
+    HOGTHRESH = 310,               /* HOGTHRESH  */
+    SPEAKER = 311,                 /* SPEAKER  */
+    IPXSUPPORT = 312,              /* IPXSUPPORT  */
+    IPXNETWORK = 313,              /* IPXNETWORK  */
+    NOVELLHACK = 314,              /* NOVELLHACK  */
+    ETHDEV = 315,                  /* ETHDEV  */
+    ETHRING = 316,                 /* ETHRING  */
+    TAPDEV = 317,                  /* TAPDEV  */
+    VDESWITCH = 318,               /* VDESWITCH  */
+    SLIRPARGS = 319,               /* SLIRPARGS  */
+    NETSOCK = 320,                 /* NETSOCK  */
+    VNET = 321,                    /* VNET  */
+    DEBUG = 322,                   /* DEBUG  */
+    MOUSE = 323,                   /* MOUSE  */
+    SERIAL = 324,                  /* SERIAL  */
+    COM = 325,                     /* COM  */
+    KEYBOARD = 326,                /* KEYBOARD  */
+    TERMINAL = 327,                /* TERMINAL  */
+    VIDEO = 328,                   /* VIDEO  */
+    EMURETRACE = 329,              /* EMURETRACE  */
+    TIMER = 330,                   /* TIMER  */
+    MATHCO = 331,                  /* MATHCO  */
+    CPU = 332,                     /* CPU  */
+    CPUSPEED = 333,                /* CPUSPEED  */
+    BOOTDRIVE = 334,               /* BOOTDRIVE  */
+    SWAP_BOOTDRIVE = 335,          /* SWAP_BOOTDRIVE  */
+    DISK_URING = 336,              /* DISK_URING  */
+    DISK_CACHE = 337,              /* DISK_CACHE  */
+    DISK_CACHE_WB = 338,           /* DISK_CACHE_WB  */
+    FATFS_WRITE = 339,             /* FATFS_WRITE  */
+    L_XMS = 340,                   /* L_XMS  */
+    L_DPMI = 341,                  /* L_DPMI  */
+    DPMI_BASE = 342,               /* DPMI_BASE  */
+    HUGEPAGES = 343,               /* HUGEPAGES  */
+    PM_DOS_API = 344,              /* PM_DOS_API  */
+    NO_NULL_CHECKS = 345,          /* NO_NULL_CHECKS  */
+    PORTS = 346,                   /* PORTS  */
+    DISK = 347,                    /* DISK  */
+    DOSMEM = 348,                  /* DOSMEM  */
+    EXT_MEM = 349,                 /* EXT_MEM  */
+    L_EMS = 350,                   /* L_EMS  */
+    UMB_A0 = 351,                  /* UMB_A0  */
+    UMB_B0 = 352,                  /* UMB_B0  */
+    UMB_F0 = 353,                  /* UMB_F0  */
+    HMA = 354,                     /* HMA  */
+    DOS_UP = 355,                  /* DOS_UP  */
+    EMS_SIZE = 356,                /* EMS_SIZE  */
+    EMS_FRAME = 357,               /* EMS_FRAME  */
+    EMS_UMA_PAGES = 358,           /* EMS_UMA_PAGES  */
+    EMS_CONV_PAGES = 359,          /* EMS_CONV_PAGES  */
+    TTYLOCKS = 360,                /* TTYLOCKS  */
+    L_SOUND = 361,                 /* L_SOUND  */
+    L_SND_OSS = 362,               /* L_SND_OSS  */
+    L_JOYSTICK = 363,              /* L_JOYSTICK  */
+    FILE_LOCK_LIMIT = 364,         /* FILE_LOCK_LIMIT  */
+    FILE_OPEN_LIMIT = 365,         /* FILE_OPEN_LIMIT  */
+    ABORT = 366,                   /* ABORT  */
+    WARN = 367,                    /* WARN  */
+    ERROR = 368,                   /* ERROR  */
+    L_FLOPPY = 369,                /* L_FLOPPY  */
+    EMUSYS = 370,                  /* EMUSYS  */
+    L_X = 371,                     /* L_X  */
+    L_SDL = 372,                   /* L_SDL  */
+    DOSEMUMAP = 373,               /* DOSEMUMAP  */
+    LOGBUFSIZE = 374,              /* LOGBUFSIZE  */
+    LOGFILESIZE = 375,             /* LOGFILESIZE  */
+    MAPPINGDRIVER = 376,           /* MAPPINGDRIVER  */
+    LFN_SUPPORT = 377,             /* LFN_SUPPORT  */
+    FFS_REDIR = 378,               /* FFS_REDIR  */
+    SET_INT_HOOKS = 379,           /* SET_INT_HOOKS  */
+    TRACE_IRETS = 380,             /* TRACE_IRETS  */
+    FINT_REVECT = 381,             /* FINT_REVECT  */
+    EMULATED = 382,                /* EMULATED  */
+    NATIVE = 383,                  /* NATIVE  */
+    CPUEMU = 384,                  /* CPUEMU  */
+    CPU_VM = 385,                  /* CPU_VM  */
+    CPU_VM_DPMI = 386,             /* CPU_VM_DPMI  */
+    VM86 = 387,                    /* VM86  */
+    KVM = 388,                     /* KVM  */
+    RAWKEYBOARD = 389,             /* RAWKEYBOARD  */
+    PRESTROKE = 390,               /* PRESTROKE  */
+    KEYTABLE = 391,                /* KEYTABLE  */
+    SHIFT_MAP = 392,               /* SHIFT_MAP  */
+    ALT_MAP = 393,                 /* ALT_MAP  */
+    NUMPAD_MAP = 394,              /* NUMPAD_MAP  */
+    DUMP = 395,                    /* DUMP  */
+    LAYOUT = 396,                  /* LAYOUT  */
+    DGRAVE = 397,                  /* DGRAVE  */
+    DACUTE = 398,                  /* DACUTE  */
+    DCIRCUM = 399,                 /* DCIRCUM  */
+    DTILDE = 400,                  /* DTILDE  */
+    DBREVE = 401,                  /* DBREVE  */
+    DABOVED = 402,                 /* DABOVED  */
+    DDIARES = 403,                 /* DDIARES  */
+    DABOVER = 404,                 /* DABOVER  */
+    DDACUTE = 405,                 /* DDACUTE  */
+    DCEDILLA = 406,                /* DCEDILLA  */
+    DIOTA = 407,                   /* DIOTA  */
+    DOGONEK = 408,                 /* DOGONEK  */
+    DCARON = 409,                  /* DCARON  */
+    NETWORK = 410,                 /* NETWORK  */
+    PKTDRIVER = 411,               /* PKTDRIVER  */
+    NE2K = 412,                    /* NE2K  */
+    DIRECTORY = 413,               /* DIRECTORY  */
+    NAMESTUB = 414,                /* NAMESTUB  */
+    BINARY = 415,                  /* BINARY  */
+    BASE = 416,                    /* BASE  */
+    IRQ = 417,                     /* IRQ  */
+    DEVICE = 418,                  /* DEVICE  */
+    CHARSET = 419,                 /* CHARSET  */
+    BAUDRATE = 420,                /* BAUDRATE  */
+    VIRTUAL = 421,                 /* VIRTUAL  */
+    VMODEM = 422,                  /* VMODEM  */
+    PSEUDO = 423,                  /* PSEUDO  */
+    RTSCTS = 424,                  /* RTSCTS  */
+    LOWLAT = 425,                  /* LOWLAT  */
+    PCCOM = 426,                   /* PCCOM  */
+    EXEC = 427,                    /* EXEC  */
+    WRFILE = 428,                  /* WRFILE  */
+    NULLMM = 429,                  /* NULLMM  */
+    MICROSOFT = 430,               /* MICROSOFT  */
+    MS3BUTTON = 431,               /* MS3BUTTON  */
+    LOGITECH = 432,                /* LOGITECH  */
+    MMSERIES = 433,                /* MMSERIES  */
+    MOUSEMAN = 434,                /* MOUSEMAN  */
+    HITACHI = 435,                 /* HITACHI  */
+    MOUSESYSTEMS = 436,            /* MOUSESYSTEMS  */
+    BUSMOUSE = 437,                /* BUSMOUSE  */
+    PS2 = 438,                     /* PS2  */
+    IMPS2 = 439,                   /* IMPS2  */
+    INTERNALDRIVER = 440,          /* INTERNALDRIVER  */
+    EMULATE3BUTTONS = 441,         /* EMULATE3BUTTONS  */
+    CLEARDTR = 442,                /* CLEARDTR  */
+    UNGRAB_TWEAK = 443,            /* UNGRAB_TWEAK  */
+    L_DISPLAY = 444,               /* L_DISPLAY  */
+    L_TITLE = 445,                 /* L_TITLE  */
+    X_TITLE_SHOW_APPNAME = 446,    /* X_TITLE_SHOW_APPNAME  */
+    ICON_NAME = 447,               /* ICON_NAME  */
+    X_BLINKRATE = 448,             /* X_BLINKRATE  */
+    X_SHARECMAP = 449,             /* X_SHARECMAP  */
+    X_MITSHM = 450,                /* X_MITSHM  */
+    X_FONT = 451,                  /* X_FONT  */
+    X_FIXED_ASPECT = 452,          /* X_FIXED_ASPECT  */
+    X_ASPECT_43 = 453,             /* X_ASPECT_43  */
+    X_LIN_FILT = 454,              /* X_LIN_FILT  */
+    X_BILIN_FILT = 455,            /* X_BILIN_FILT  */
+    X_MODE13FACT = 456,            /* X_MODE13FACT  */
+    X_WINSIZE = 457,               /* X_WINSIZE  */
+    X_NOCLOSE = 458,               /* X_NOCLOSE  */
+    X_NORESIZE = 459,              /* X_NORESIZE  */
+    X_GAMMA = 460,                 /* X_GAMMA  */
+    X_FULLSCREEN = 461,            /* X_FULLSCREEN  */
+    VGAEMU_MEMSIZE = 462,          /* VGAEMU_MEMSIZE  */
+    VESAMODE = 463,                /* VESAMODE  */
+    X_LFB = 464,                   /* X_LFB  */
+    X_PM_INTERFACE = 465,          /* X_PM_INTERFACE  */
+    X_MGRAB_KEY = 466,             /* X_MGRAB_KEY  */
+    X_BACKGROUND_PAUSE = 467,      /* X_BACKGROUND_PAUSE  */
+    SDL_HWREND = 468,              /* SDL_HWREND  */
+    SDL_FONTS = 469,               /* SDL_FONTS  */
+    SDL_WCONTROLS = 470,           /* SDL_WCONTROLS  */
+    SDL_CLIP_NATIVE = 471,         /* SDL_CLIP_NATIVE  */
+    VGA = 472,                     /* VGA  */
+    MGA = 473,                     /* MGA  */
+    CGA = 474,                     /* CGA  */
+    EGA = 475,                     /* EGA  */
+    NONE = 476,                    /* NONE  */
+    CONSOLE = 477,                 /* CONSOLE  */
+    GRAPHICS = 478,                /* GRAPHICS  */
+    CHIPSET = 479,                 /* CHIPSET  */
+    FULLREST = 480,                /* FULLREST  */
+    PARTREST = 481,                /* PARTREST  */
+    MEMSIZE = 482,                 /* MEMSIZE  */
+    VBIOS_SIZE_TOK = 483,          /* VBIOS_SIZE_TOK  */
+    VBIOS_SEG = 484,               /* VBIOS_SEG  */
+    VGAEMUBIOS_FILE = 485,         /* VGAEMUBIOS_FILE  */
+    VBIOS_FILE = 486,              /* VBIOS_FILE  */
+    VBIOS_COPY = 487,              /* VBIOS_COPY  */
+    VBIOS_MMAP = 488,              /* VBIOS_MMAP  */
+    DUALMON = 489,                 /* DUALMON  */
+    VBIOS_POST = 490,              /* VBIOS_POST  */
+    VGA_FONTS = 491,               /* VGA_FONTS  */
+    FORCE_VT_SWITCH = 492,         /* FORCE_VT_SWITCH  */
+    PCI = 493,                     /* PCI  */
+    COLOR = 494,                   /* COLOR  */
+    ESCCHAR = 495,                 /* ESCCHAR  */
+    XTERM_TITLE = 496,             /* XTERM_TITLE  */
+    SIZE = 497,                    /* SIZE  */
+    IO = 498,                      /* IO  */
+    PORT = 499,                    /* PORT  */
+    CONFIG = 500,                  /* CONFIG  */
+    READ = 501,                    /* READ  */
+    WRITE = 502,                   /* WRITE  */
+    KEYB = 503,                    /* KEYB  */
+    PRINTER = 504,                 /* PRINTER  */
+    WARNING = 505,                 /* WARNING  */
+    GENERAL = 506,                 /* GENERAL  */
+    HARDWARE = 507,                /* HARDWARE  */
+    L_IPC = 508,                   /* L_IPC  */
+    SOUND = 509,                   /* SOUND  */
+    TRACE = 510,                   /* TRACE  */
+    CLEAR = 511,                   /* CLEAR  */
+    TRACE_MMIO = 512,              /* TRACE_MMIO  */
+    UEXEC = 513,                   /* UEXEC  */
+    LPATHS = 514,                  /* LPATHS  */
+    HDRIVES = 515,                 /* HDRIVES  */
+    LPT = 516,                     /* LPT  */
+    COMMAND = 517,                 /* COMMAND  */
+    TIMEOUT = 518,                 /* TIMEOUT  */
+    L_FILE = 519,                  /* L_FILE  */
+    L_PARTITION = 520,             /* L_PARTITION  */
+    WHOLEDISK = 521,               /* WHOLEDISK  */
+    SECTORS = 522,                 /* SECTORS  */
+    CYLINDERS = 523,               /* CYLINDERS  */
+    TRACKS = 524,                  /* TRACKS  */
+    HEADS = 525,                   /* HEADS  */
+    OFFSET = 526,                  /* OFFSET  */
+    HDIMAGE = 527,                 /* HDIMAGE  */
+    HDTYPE1 = 528,                 /* HDTYPE1  */
+    HDTYPE2 = 529,                 /* HDTYPE2  */
+    HDTYPE9 = 530,                 /* HDTYPE9  */
+    DISKCYL4096 = 531,             /* DISKCYL4096  */
+    OVERLAY = 532,                 /* OVERLAY  */
+    OVERLAY_COMMIT = 533,          /* OVERLAY_COMMIT  */
+    OVERLAY_DISCARD = 534,         /* OVERLAY_DISCARD  */
+    THREEINCH = 535,               /* THREEINCH  */
+    THREEINCH_720 = 536,           /* THREEINCH_720  */
+    THREEINCH_2880 = 537,          /* THREEINCH_2880  */
+    FIVEINCH = 538,                /* FIVEINCH  */
+    FIVEINCH_360 = 539,            /* FIVEINCH_360  */
+    READONLY = 540,                /* READONLY  */
+    BOOT = 541,                    /* BOOT  */
+    DEFAULT_DRIVES = 542,          /* DEFAULT_DRIVES  */
+    SKIP_DRIVES = 543,             /* SKIP_DRIVES  */
+    RDONLY = 544,                  /* RDONLY  */
+    WRONLY = 545,                  /* WRONLY  */
+    RDWR = 546,                    /* RDWR  */
+    ORMASK = 547,                  /* ORMASK  */
+    ANDMASK = 548,                 /* ANDMASK  */
+    RANGE = 549,                   /* RANGE  */
+    FAST = 550,                    /* FAST  */
+    SLOW = 551,                    /* SLOW  */
+    SILLYINT = 552,                /* SILLYINT  */
+    USE_SIGIO = 553,               /* USE_SIGIO  */
+    HARDWARE_RAM = 554,            /* HARDWARE_RAM  */
+    SB_BASE = 555,                 /* SB_BASE  */
+    SB_IRQ = 556,                  /* SB_IRQ  */
+    SB_DMA = 557,                  /* SB_DMA  */
+    SB_HDMA = 558,                 /* SB_HDMA  */
+    MPU_BASE = 559,                /* MPU_BASE  */
+    MPU_BASE_MT32 = 560,           /* MPU_BASE_MT32  */
+    MPU_IRQ = 561,                 /* MPU_IRQ  */
+    MPU_IRQ_MT32 = 562,            /* MPU_IRQ_MT32  */
+    MIDI_SYNTH = 563,              /* MIDI_SYNTH  */
+    SOUND_DRIVER = 564,            /* SOUND_DRIVER  */
+    MIDI_DRIVER = 565,             /* MIDI_DRIVER  */
+    FLUID_SFONT = 566,             /* FLUID_SFONT  */
+    FLUID_VOLUME = 567,            /* FLUID_VOLUME  */
+    MUNT_ROMS = 568,               /* MUNT_ROMS  */
+    OPL2LPT_DEV = 569,             /* OPL2LPT_DEV  */
+    OPL2LPT_TYPE = 570,            /* OPL2LPT_TYPE  */
+    SND_PLUGIN_PARAMS = 571,       /* SND_PLUGIN_PARAMS  */
+    PCM_HPF = 572,                 /* PCM_HPF  */
+    MIDI_FILE = 573,               /* MIDI_FILE  */
+    WAV_FILE = 574,                /* WAV_FILE  */
+    SOUND_VTIME = 575,             /* SOUND_VTIME  */
+    CDROM = 576,                   /* CDROM  */
+    ASPI = 577,                    /* ASPI  */
+    DEVICETYPE = 578,              /* DEVICETYPE  */
+    TARGET = 579,                  /* TARGET  */
+    FEATURE = 580,                 /* FEATURE  */
+    JOYSTICK = 581,                /* JOYSTICK  */
+    JOY_DEVICE = 582,              /* JOY_DEVICE  */
+    JOY_DOS_MIN = 583,             /* JOY_DOS_MIN  */
+    JOY_DOS_MAX = 584,             /* JOY_DOS_MAX  */
+    JOY_GRANULARITY = 585,         /* JOY_GRANULARITY  */
+    JOY_LATENCY = 586,             /* JOY_LATENCY  */
+    CLI_TIMEOUT = 587,             /* CLI_TIMEOUT  */
+    TIMEMODE = 588,                /* TIMEMODE  */
+    TIMER_TWEAKS = 589,            /* TIMER_TWEAKS  */
+    UNICODE = 590,                 /* UNICODE  */
+    SHIFT_ALT_MAP = 591,           /* SHIFT_ALT_MAP  */
+    CTRL_MAP = 592,                /* CTRL_MAP  */
+    CTRL_ALT_MAP = 593,            /* CTRL_ALT_MAP  */
+    INTERNAL = 594,                /* INTERNAL  */
+    EXTERNAL = 595                 /* EXTERNAL  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define INTEGER 258
+#define L_OFF 259
+#define L_ON 260
+#define L_AUTO 261
+#define L_YES 262
+#define L_NO 263
+#define CHIPSET_TYPE 264
+#define REAL 265
+#define STRING 266
+#define VARIABLE 267
+#define EXPRTEST 268
+#define INTCAST 269
+#define REALCAST 270
+#define AND_OP 271
+#define OR_OP 272
+#define XOR_OP 273
+#define SHR_OP 274
+#define SHL_OP 275
+#define NOT_OP 276
+#define EQ_OP 277
+#define GE_OP 278
+#define LE_OP 279
+#define NEQ_OP 280
+#define STR_EQ_OP 281
+#define STR_NEQ_OP 282
+#define L_AND_OP 283
+#define L_OR_OP 284
+#define UMINUS 285
+#define UPLUS 286
+#define BIT_NOT_OP 287
+#define STRLEN 288
+#define STRTOL 289
+#define STRNCMP 290
+#define STRCAT 291
+#define STRPBRK 292
+#define STRSPLIT 293
+#define STRCHR 294
+#define STRRCHR 295
+#define STRSTR 296
+#define STRDEL 297
+#define STRSPN 298
+#define STRCSPN 299
+#define SHELL 300
+#define DEFINED 301
+#define DEFINE 302
+#define UNDEF 303
+#define IFSTATEMENT 304
+#define WHILESTATEMENT 305
+#define FOREACHSTATEMENT 306
+#define CHECKUSERVAR 307
+#define TICKLESS_IDLE 308
+#define FASTFLOPPY 309
+#define HOGTHRESH 310
+#define SPEAKER 311
+#define IPXSUPPORT 312
+#define IPXNETWORK 313
+#define NOVELLHACK 314
+#define ETHDEV 315
+#define ETHRING 316
+#define TAPDEV 317
+#define VDESWITCH 318
+#define SLIRPARGS 319
+#define NETSOCK 320
+#define VNET 321
+#define DEBUG 322
+#define MOUSE 323
+#define SERIAL 324
+#define COM 325
+#define KEYBOARD 326
+#define TERMINAL 327
+#define VIDEO 328
+#define EMURETRACE 329
+#define TIMER 330
+#define MATHCO 331
+#define CPU 332
+#define CPUSPEED 333
+#define BOOTDRIVE 334
+#define SWAP_BOOTDRIVE 335
+#define DISK_URING 336
+#define DISK_CACHE 337
+#define DISK_CACHE_WB 338
+#define FATFS_WRITE 339
+#define L_XMS 340
+#define L_DPMI 341
+#define DPMI_BASE 342
+#define HUGEPAGES 343
+#define PM_DOS_API 344
+#define NO_NULL_CHECKS 345
+#define PORTS 346
+#define DISK 347
+#define DOSMEM 348
+#define EXT_MEM 349
+#define L_EMS 350
+#define UMB_A0 351
+#define UMB_B0 352
+#define UMB_F0 353
+#define HMA 354
+#define DOS_UP 355
+#define EMS_SIZE 356
+#define EMS_FRAME 357
+#define EMS_UMA_PAGES 358
+#define EMS_CONV_PAGES 359
+#define TTYLOCKS 360
+#define L_SOUND 361
+#define L_SND_OSS 362
+#define L_JOYSTICK 363
+#define FILE_LOCK_LIMIT 364
+#define FILE_OPEN_LIMIT 365
+#define ABORT 366
+#define WARN 367
+#define ERROR 368
+#define L_FLOPPY 369
+#define EMUSYS 370
+#define L_X 371
+#define L_SDL 372
+#define DOSEMUMAP 373
+#define LOGBUFSIZE 374
+#define LOGFILESIZE 375
+#define MAPPINGDRIVER 376
+#define LFN_SUPPORT 377
+#define FFS_REDIR 378
+#define SET_INT_HOOKS 379
+#define TRACE_IRETS 380
+#define FINT_REVECT 381
+#define EMULATED 382
+#define NATIVE 383
+#define CPUEMU 384
+#define CPU_VM 385
+#define CPU_VM_DPMI 386
+#define VM86 387
+#define KVM 388
+#define RAWKEYBOARD 389
+#define PRESTROKE 390
+#define KEYTABLE 391
+#define SHIFT_MAP 392
+#define ALT_MAP 393
+#define NUMPAD_MAP 394
+#define DUMP 395
+#define LAYOUT 396
+#define DGRAVE 397
+#define DACUTE 398
+#define DCIRCUM 399
+#define DTILDE 400
+#define DBREVE 401
+#define DABOVED 402
+#define DDIARES 403
+#define DABOVER 404
+#define DDACUTE 405
+#define DCEDILLA 406
+#define DIOTA 407
+#define DOGONEK 408
+#define DCARON 409
+#define NETWORK 410
+#define PKTDRIVER 411
+#define NE2K 412
+#define DIRECTORY 413
+#define NAMESTUB 414
+#define BINARY 415
+#define BASE 416
+#define IRQ 417
+#define DEVICE 418
+#define CHARSET 419
+#define BAUDRATE 420
+#define VIRTUAL 421
+#define VMODEM 422
+#define PSEUDO 423
+#define RTSCTS 424
+#define LOWLAT 425
+#define PCCOM 426
+#define EXEC 427
+#define WRFILE 428
+#define NULLMM 429
+#define MICROSOFT 430
+#define MS3BUTTON 431
+#define LOGITECH 432
+#define MMSERIES 433
+#define MOUSEMAN 434
+#define HITACHI 435
+#define MOUSESYSTEMS 436
+#define BUSMOUSE 437
+#define PS2 438
+#define IMPS2 439
+#define INTERNALDRIVER 440
+#define EMULATE3BUTTONS 441
+#define CLEARDTR 442
+#define UNGRAB_TWEAK 443
+#define L_DISPLAY 444
+#define L_TITLE 445
+#define X_TITLE_SHOW_APPNAME 446
+#define ICON_NAME 447
+#define X_BLINKRATE 448
+#define X_SHARECMAP 449
+#define X_MITSHM 450
+#define X_FONT 451
+#define X_FIXED_ASPECT 452
+#define X_ASPECT_43 453
+#define X_LIN_FILT 454
+#define X_BILIN_FILT 455
+#define X_MODE13FACT 456
+#define X_WINSIZE 457
+#define X_NOCLOSE 458
+#define X_NORESIZE 459
+#define X_GAMMA 460
+#define X_FULLSCREEN 461
+#define VGAEMU_MEMSIZE 462
+#define VESAMODE 463
+#define X_LFB 464
+#define X_PM_INTERFACE 465
+#define X_MGRAB_KEY 466
+#define X_BACKGROUND_PAUSE 467
+#define SDL_HWREND 468
+#define SDL_FONTS 469
+#define SDL_WCONTROLS 470
+#define SDL_CLIP_NATIVE 471
+#define VGA 472
+#define MGA 473
+#define CGA 474
+#define EGA 475
+#define NONE 476
+#define CONSOLE 477
+#define GRAPHICS 478
+#define CHIPSET 479
+#define FULLREST 480
+#define PARTREST 481
+#define MEMSIZE 482
+#define VBIOS_SIZE_TOK 483
+#define VBIOS_SEG 484
+#define VGAEMUBIOS_FILE 485
+#define VBIOS_FILE 486
+#define VBIOS_COPY 487
+#define VBIOS_MMAP 488
+#define DUALMON 489
+#define VBIOS_POST 490
+#define VGA_FONTS 491
+#define FORCE_VT_SWITCH 492
+#define PCI 493
+#define COLOR 494
+#define ESCCHAR 495
+#define XTERM_TITLE 496
+#define SIZE 497
+#define IO 498
+#define PORT 499
+#define CONFIG 500
+#define READ 501
+#define WRITE 502
+#define KEYB 503
+#define PRINTER 504
+#define WARNING 505
+#define GENERAL 506
+#define HARDWARE 507
+#define L_IPC 508
+#define SOUND 509
+#define TRACE 510
+#define CLEAR 511
+#define TRACE_MMIO 512
+#define UEXEC 513
+#define LPATHS 514
+#define HDRIVES 515
+#define LPT 516
+#define COMMAND 517
+#define TIMEOUT 518
+#define L_FILE 519
+#define L_PARTITION 520
+#define WHOLEDISK 521
+#define SECTORS 522
+#define CYLINDERS 523
+#define TRACKS 524
+#define HEADS 525
+#define OFFSET 526
+#define HDIMAGE 527
+#define HDTYPE1 528
+#define HDTYPE2 529
+#define HDTYPE9 530
+#define DISKCYL4096 531
+#define OVERLAY 532
+#define OVERLAY_COMMIT 533
+#define OVERLAY_DISCARD 534
+#define THREEINCH 535
+#define THREEINCH_720 536
+#define THREEINCH_2880 537
+#define FIVEINCH 538
+#define FIVEINCH_360 539
+#define READONLY 540
+#define BOOT 541
+#define DEFAULT_DRIVES 542
+#define SKIP_DRIVES 543
+#define RDONLY 544
+#define WRONLY 545
+#define RDWR 546
+#define ORMASK 547
+#define ANDMASK 548
+#define RANGE 549
+#define FAST 550
+#define SLOW 551
+#define SILLYINT 552
+#define USE_SIGIO 553
+#define HARDWARE_RAM 554
+#define SB_BASE 555
+#define SB_IRQ 556
+#define SB_DMA 557
+#define SB_HDMA 558
+#define MPU_BASE 559
+#define MPU_BASE_MT32 560
+#define MPU_IRQ 561
+#define MPU_IRQ_MT32 562
+#define MIDI_SYNTH 563
+#define SOUND_DRIVER 564
+#define MIDI_DRIVER 565
+#define FLUID_SFONT 566
+#define FLUID_VOLUME 567
+#define MUNT_ROMS 568
+#define OPL2LPT_DEV 569
+#define OPL2LPT_TYPE 570
+#define SND_PLUGIN_PARAMS 571
+#define PCM_HPF 572
+#define MIDI_FILE 573
+#define WAV_FILE 574
+#define SOUND_VTIME 575
+#define CDROM 576
+#define ASPI 577
+#define DEVICETYPE 578
+#define TARGET 579
+#define FEATURE 580
+#define JOYSTICK 581
+#define JOY_DEVICE 582
+#define JOY_DOS_MIN 583
+#define JOY_DOS_MAX 584
+#define JOY_GRANULARITY 585
+#define JOY_LATENCY 586
+#define CLI_TIMEOUT 587
+#define TIMEMODE 588
+#define TIMER_TWEAKS 589
+#define UNICODE 590
+#define SHIFT_ALT_MAP 591
+#define CTRL_MAP 592
+#define CTRL_ALT_MAP 593
+#define INTERNAL 594
+#define EXTERNAL 595
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 185 "parser.y"
+
+	int i_value;
+	char *s_value;
+	float r_value;
+	struct {
+		int type;
+		union {
+			int i;
+			float r;
+		} value;
+	} t_value;
+
+#line 760 "parser.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_PARSER_H_INCLUDED  */
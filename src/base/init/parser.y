@@ -230,15 +230,17 @@ enum {
 %token CHECKUSERVAR
 
 	/* main options */
+%token TICKLESS_IDLE
 %token FASTFLOPPY HOGTHRESH SPEAKER IPXSUPPORT IPXNETWORK NOVELLHACK
-%token ETHDEV TAPDEV VDESWITCH SLIRPARGS NETSOCK VNET
+%token ETHDEV ETHRING TAPDEV VDESWITCH SLIRPARGS NETSOCK VNET
 %token DEBUG MOUSE SERIAL COM KEYBOARD TERMINAL VIDEO EMURETRACE TIMER
-%token MATHCO CPU CPUSPEED BOOTDRIVE SWAP_BOOTDRIVE
-%token L_XMS L_DPMI DPMI_BASE PM_DOS_API NO_NULL_CHECKS
+%token MATHCO CPU CPUSPEED BOOTDRIVE SWAP_BOOTDRIVE DISK_URING
+%token DISK_CACHE DISK_CACHE_WB FATFS_WRITE
+%token L_XMS L_DPMI DPMI_BASE HUGEPAGES PM_DOS_API NO_NULL_CHECKS
 %token PORTS DISK DOSMEM EXT_MEM
 %token L_EMS UMB_A0 UMB_B0 UMB_F0 HMA DOS_UP
 %token EMS_SIZE EMS_FRAME EMS_UMA_PAGES EMS_CONV_PAGES
-%token TTYLOCKS L_SOUND L_SND_OSS L_JOYSTICK FILE_LOCK_LIMIT
+%token TTYLOCKS L_SOUND L_SND_OSS L_JOYSTICK FILE_LOCK_LIMIT FILE_OPEN_LIMIT
 %token ABORT WARN ERROR
 %token L_FLOPPY EMUSYS L_X L_SDL
 %token DOSEMUMAP LOGBUFSIZE LOGFILESIZE MAPPINGDRIVER
@@ -290,6 +292,7 @@ enum {
 	/* disk */
 %token L_PARTITION WHOLEDISK
 %token SECTORS CYLINDERS TRACKS HEADS OFFSET HDIMAGE HDTYPE1 HDTYPE2 HDTYPE9 DISKCYL4096
+%token OVERLAY OVERLAY_COMMIT OVERLAY_DISCARD
 	/* floppy */
 %token THREEINCH THREEINCH_720 THREEINCH_2880 FIVEINCH FIVEINCH_360 READONLY BOOT
 %token DEFAULT_DRIVES SKIP_DRIVES
@@ -304,7 +307,7 @@ enum {
 %token MPU_IRQ MPU_IRQ_MT32 MIDI_SYNTH
 %token SOUND_DRIVER MIDI_DRIVER FLUID_SFONT FLUID_VOLUME
 %token MUNT_ROMS OPL2LPT_DEV OPL2LPT_TYPE
-%token SND_PLUGIN_PARAMS PCM_HPF MIDI_FILE WAV_FILE
+%token SND_PLUGIN_PARAMS PCM_HPF MIDI_FILE WAV_FILE SOUND_VTIME
 	/* CD-ROM */
 %token CDROM
 	/* ASPI driver */
@@ -345,6 +348,7 @@ optdelim	: ';'
 line:		CHARSET '{' charset_flags '}' {}
 		/* charset flags */
 		| HOGTHRESH expression	{ config.hogthreshold = $2; }
+		| TICKLESS_IDLE bool	{ config.tickless_idle = ($2!=0); }
 		| DEFINE string_unquoted{ define_config_variable($2); free($2); }
 		| UNDEF string_unquoted	{ undefine_config_variable($2); free($2); }
 		| IFSTATEMENT '(' expression ')' {
@@ -434,6 +438,10 @@ line:		CHARSET '{' charset_flags '}' {}
 		    {
 		    config.file_lock_limit = $2;
 		    }
+		| FILE_OPEN_LIMIT INTEGER
+		    {
+		    config.file_open_limit = $2;
+		    }
 		| LFN_SUPPORT bool
 		    {
 		    config.lfn = ($2!=0);
@@ -529,6 +537,22 @@ line:		CHARSET '{' charset_flags '}' {}
 		    {
 		      config.swap_bootdrv = ($2!=0);
 		    }
+		| DISK_URING bool
+		    {
+		      config.disk_uring = ($2!=0);
+		    }
+		| DISK_CACHE int_expr
+		    {
+		      config.disk_cache = $2;
+		    }
+		| DISK_CACHE_WB bool
+		    {
+		      config.disk_cache_wb = ($2!=0);
+		    }
+		| FATFS_WRITE bool
+		    {
+		      config.fatfs_write = ($2!=0);
+		    }
 		| DEFAULT_DRIVES int_expr
 		    {
 		      c_printf("default_drives %i\n", $2);
@@ -628,6 +652,11 @@ line:		CHARSET '{' charset_flags '}' {}
 		    config.dpmi_base = $2;
 		    c_printf("CONF: DPMI base addr = %#x\n", $2);
 		    }
+		| HUGEPAGES bool
+		    {
+		    config.hugepages = ($2!=0);
+		    c_printf("CONF: huge pages %s\n", ($2) ? "on" : "off");
+		    }
 		| PM_DOS_API bool
 		    {
 		    config.pm_dos_api = ($2!=0);
@@ -669,6 +698,11 @@ line:		CHARSET '{' charset_flags '}' {}
 				($2) ? "enabled" : "disabled");
 		    }
 		| ETHDEV string_expr	{ free(config.ethdev); config.ethdev = $2; }
+		| ETHRING bool
+		    {
+			config.eth_ring = ($2!=0);
+			c_printf("CONF: eth rings %s\n", ($2) ? "on" : "off");
+		    }
 		| TAPDEV string_expr	{ free(config.tapdev); config.tapdev = $2; }
 		| VDESWITCH string_expr	{ free(config.vdeswitch); config.vdeswitch = $2; }
 		| SLIRPARGS string_expr	{ free(config.slirp_args); config.slirp_args = $2; }
@@ -1157,6 +1191,7 @@ sound_flag	: SB_BASE expression	{ config.sb_base = $2; }
 		| PCM_HPF bool		{ config.pcm_hpf = ($2!=0); }
 		| MIDI_FILE string_expr	{ free(config.midi_file); config.midi_file = $2; }
 		| WAV_FILE string_expr	{ free(config.wav_file); config.wav_file = $2; }
+		| SOUND_VTIME bool	{ config.sound_vtime = ($2!=0); }
 		;
 
 	/* joystick emulation */
@@ -1564,6 +1599,13 @@ disk_flag	: READONLY		{ dptr->rdonly = 1; }
 		| HEADS expression		{ dptr->heads = $2; }
 		| OFFSET expression	{ dptr->header = $2; }
 		| L_PARTITION		{ dptr->part_image = 1; }
+		| OVERLAY string_expr
+		    {
+		    free(dptr->overlay);
+		    dptr->overlay = $2;
+		    }
+		| OVERLAY_COMMIT	{ dptr->overlay_mode = COW_COMMIT; }
+		| OVERLAY_DISCARD	{ dptr->overlay_mode = COW_DISCARD; }
 		| STRING
 		    { yyerror("unrecognized disk flag '%s'\n", $1); free($1); }
 		| error
@@ -2144,6 +2186,8 @@ static void dp_init(struct disk *dptr)
   dptr->hdtype = 0;
   dptr->timeout = 0;
   dptr->dev_name = NULL;              /* default-values */
+  dptr->overlay = NULL;
+  dptr->overlay_mode = COW_KEEP;
   dptr->rdonly = 0;
   dptr->header = 0;
 }
@@ -2266,6 +2310,14 @@ static void stop_disk(int token)
   if (dptr->type == IMAGE && dptr->part_image)
     dptr->type = PARTITION; // image of a partition
 
+  if (dptr->overlay_mode != COW_KEEP && !dptr->overlay && dptr->dev_name) {
+    dptr->overlay = malloc(strlen(dptr->dev_name) + 5);
+    sprintf(dptr->overlay, "%s.cow", dptr->dev_name);
+  }
+  if (dptr->overlay && !(dptr->type == IMAGE ||
+      (dptr->type == PARTITION && dptr->part_image)))
+    yyerror("disk: overlay %s needs an image file", dptr->overlay);
+
   if (dptr->type == IMAGE) {
     char buf[HEADER_SIZE];
     struct image_header *header = (struct image_header *)&buf;
@@ -96,6 +96,11 @@ static void paste_run(void)
 	}
 }
 
+static int paste_busy(void)
+{
+	return (paste_buffer != NULL);
+}
+
 /* register keyboard at the back of the linked list */
 void register_keyboard_client(struct keyboard_client *keyboard)
 {
@@ -152,7 +157,7 @@ int keyb_client_init(void)
 		}
 	}
 
-	sigalrm_register_handler(paste_run);
+	sigalrm_register_idle_handler(paste_run, paste_busy);
 
 	return TRUE;
 }
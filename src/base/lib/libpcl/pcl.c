@@ -40,6 +40,8 @@
 #endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "pcl.h"
 #include "pcl_private.h"
 #include "pcl_ctx.h"
@@ -79,24 +81,114 @@ static void co_runner(void *arg)
 	abort();
 }
 
-static coroutine *do_co_create(void (*func)(void *), void *data, void *stack,
-		int size, int corosize)
+static int co_page_align(int size)
 {
+	long pgsz = sysconf(_SC_PAGESIZE);
+
+	return (size + pgsz - 1) & ~(pgsz - 1);
+}
+
+/*
+ * Stacks are mapped with an inaccessible guard page below them, so an
+ * overflow faults instead of corrupting whatever is mapped nearby.
+ * Nothing is committed until touched.
+ */
+void *co_stack_alloc(int size)
+{
+	long pgsz = sysconf(_SC_PAGESIZE);
+	char *p;
+
+	size = co_page_align(size);
+	p = mmap(NULL, size + pgsz, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (p == MAP_FAILED)
+		return NULL;
+	if (mprotect(p, pgsz, PROT_NONE) == -1) {
+		munmap(p, size + pgsz);
+		return NULL;
+	}
+	return p + pgsz;
+}
+
+void co_stack_free(void *stack, int size)
+{
+	long pgsz = sysconf(_SC_PAGESIZE);
+
+	munmap((char *) stack - pgsz, co_page_align(size) + pgsz);
+}
+
+/*
+ * High-water mark of a stack from co_stack_alloc(): the pages that were
+ * ever touched are resident, and the stack grows down.
+ */
+int co_stack_used(void *stack, int size)
+{
+	long pgsz = sysconf(_SC_PAGESIZE);
+	int i, n = co_page_align(size) / pgsz;
+	unsigned char *vec = malloc(n);
+
+	if (!vec)
+		return -1;
+	if (mincore(stack, n * pgsz, vec) == -1) {
+		free(vec);
+		return -1;
+	}
+	for (i = 0; i < n && !(vec[i] & 1); i++);
+	free(vec);
+	return (n - i) * pgsz;
+}
+
+static void *co_stack_get(cothread_ctx *tctx, int size)
+{
+	struct co_stk_free **p, *f;
+
+	for (p = &tctx->stk_pool; *p; p = &(*p)->next) {
+		if ((*p)->size != size)
+			continue;
+		f = *p;
+		*p = f->next;
+		tctx->stk_pooled--;
+		return (char *) f + sizeof(*f) - size;
+	}
+	return co_stack_alloc(size);
+}
+
+static void co_stack_put(cothread_ctx *tctx, void *stack, int size)
+{
+	struct co_stk_free *f;
+
+	if (tctx->stk_pooled >= CO_STK_POOL) {
+		co_stack_free(stack, size);
+		return;
+	}
+	/* keep the node at the top, where the pages are already committed */
+	f = (struct co_stk_free *) ((char *) stack + size - sizeof(*f));
+	f->size = size;
+	f->next = tctx->stk_pool;
+	tctx->stk_pool = f;
+	tctx->stk_pooled++;
+}
+
+static coroutine *do_co_create(cothread_ctx *tctx, void (*func)(void *),
+		void *data, void *stack, int size)
+{
+	int corosize = CO_STK_COROSIZE(tctx->ctx_sizeof);
 	int alloc = 0;
 	coroutine *co;
 
-	if ((size &= ~(sizeof(long) - 1)) < CO_MIN_SIZE)
+	if ((size &= ~(_CO_STK_ALIGN - 1)) < CO_MIN_SIZE)
 		return NULL;
 	if (stack == NULL) {
-		size = CO_STK_COROSIZE(size + corosize);
-		stack = malloc(size);
+		size = co_page_align(size + corosize);
+		stack = co_stack_get(tctx, size);
 		if (stack == NULL)
 			return NULL;
 		alloc = size;
 	}
-	co = stack;
-	co->stack = (char *) stack + CO_STK_COROSIZE(corosize);
-	co->stack_size = size;
+	/* the coroutine goes on top, so that the stack grows away from it */
+	co = (coroutine *) ((char *) stack + size - corosize);
+	co->stack = stack;
+	co->stack_size = size - corosize;
 	co->alloc = alloc;
 	co->func = func;
 	co->data = data;
@@ -111,16 +203,16 @@ coroutine_t co_create(cohandle_t handle, void (*func)(void *), void *data,
 	coroutine *co;
 	cothread_ctx *tctx = (cothread_ctx *)handle;
 
-	co = do_co_create(func, data, stack, size, tctx->ctx_sizeof);
+	co = do_co_create(tctx, func, data, stack, size);
 	if (!co)
 		return NULL;
 	co->ctx = tctx->co_main.ctx;
 	co->ctx.cc = co->stk;
 	co->ctx_main = tctx;
 	if (co->ctx.ops->create_context(&co->ctx, co_runner, co, co->stack,
-			size - CO_STK_COROSIZE(tctx->ctx_sizeof)) < 0) {
+			co->stack_size) < 0) {
 		if (co->alloc)
-			free(co);
+			co_stack_put(tctx, co->stack, co->alloc);
 		return NULL;
 	}
 
@@ -138,7 +230,7 @@ void co_delete(coroutine_t coro)
 		exit(1);
 	}
 	if (co->alloc)
-		free(co);
+		co_stack_put(tctx, co->stack, co->alloc);
 }
 
 void co_call(coroutine_t coro)
@@ -210,6 +302,8 @@ static void do_co_init(cothread_ctx *tctx)
 	tctx->co_main.ctx_main = tctx;
 	tctx->co_main.exited = 0;
 	tctx->co_curr = &tctx->co_main;
+	tctx->stk_pool = NULL;
+	tctx->stk_pooled = 0;
 }
 
 cohandle_t co_thread_init(enum CoBackend b)
@@ -226,7 +320,12 @@ cohandle_t co_thread_init(enum CoBackend b)
 void co_thread_cleanup(cohandle_t handle)
 {
 	cothread_ctx *tctx = (cothread_ctx *)handle;
+	struct co_stk_free *f;
 
+	while ((f = tctx->stk_pool)) {
+		tctx->stk_pool = f->next;
+		co_stack_free((char *) f + sizeof(*f) - f->size, f->size);
+	}
 	free(tctx);
 }
 
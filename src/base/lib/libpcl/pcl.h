@@ -64,5 +64,9 @@ PCLXC coroutine_t co_current(cohandle_t handle);
 PCLXC void *co_get_data(coroutine_t coro);
 PCLXC void *co_set_data(coroutine_t coro, void *data);
 
+PCLXC void *co_stack_alloc(int size);
+PCLXC void co_stack_free(void *stack, int size);
+PCLXC int co_stack_used(void *stack, int size);
+
 #endif
 
@@ -37,6 +37,7 @@
 #define CO_STK_ALIGN(x) (((x) + _CO_STK_ALIGN - 1) & ~(_CO_STK_ALIGN - 1))
 #define CO_STK_COROSIZE(x) CO_STK_ALIGN((x) + sizeof(coroutine))
 #define CO_MIN_SIZE (4 * 1024)
+#define CO_STK_POOL 8
 
 struct s_co_ctx;
 struct pcl_ctx_ops {
@@ -76,10 +77,17 @@ struct s_coroutine {
 	char stk[0];
 } coroutine;
 
+struct co_stk_free {
+	struct co_stk_free *next;
+	int size;
+};
+
 typedef struct s_cothread_ctx {
 	co_base co_main;
 	co_base *co_curr;
 	int ctx_sizeof;
+	struct co_stk_free *stk_pool;
+	int stk_pooled;
 	char stk0[0];
 } cothread_ctx;
 
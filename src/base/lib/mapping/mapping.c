@@ -404,6 +404,87 @@ void *mmap_mapping(int cap, void *target, size_t mapsize, int protect)
   return addr;
 }
 
+/* The part of the guest memory that asks for transparent huge pages.
+ * The kernel splits a huge page where the protection of its 4K pages
+ * changes, so the DPMI page attributes keep working. */
+static dosaddr_t hp_base;
+static uint32_t hp_size;
+
+static void hugepages_advise(dosaddr_t targ, size_t mapsize)
+{
+#ifdef MADV_HUGEPAGE
+  dosaddr_t beg = _max(targ, hp_base);
+  dosaddr_t end = _min((dosaddr_t)(targ + mapsize), hp_base + hp_size);
+
+  if (beg >= end)
+    return;
+  if (madvise(MEM_BASE32(beg), end - beg, MADV_HUGEPAGE) == -1)
+    error("madvise(MADV_HUGEPAGE) failed: %s\n", strerror(errno));
+#endif
+}
+
+void mapping_hugepages(dosaddr_t base, uint32_t size)
+{
+#ifdef MADV_HUGEPAGE
+  dosaddr_t end = (base + size) & HUGE_PAGE_MASK;
+  char buf[64] = "";
+  FILE *f;
+
+  base = HUGE_PAGE_ALIGN(base);
+  if (end <= base)
+    return;
+  f = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (f) {
+    fgets(buf, sizeof(buf), f);
+    fclose(f);
+  }
+  if (!strstr(buf, "[always]") && !strstr(buf, "[madvise]")) {
+    error("transparent huge pages are disabled, $_hugepages ignored\n");
+    return;
+  }
+  hp_base = base;
+  hp_size = end - base;
+  Q_printf("MAPPING: huge pages for %#x-%#x\n", hp_base, end);
+  hugepages_advise(hp_base, hp_size);
+#else
+  error("huge pages are not supported on this system\n");
+#endif
+}
+
+/* Log how much of the resident memory is backed by huge pages. */
+void mapping_report_hugepages(void)
+{
+  FILE *f;
+  char line[256];
+  unsigned long start, end, kb, rss = 0, huge = 0;
+  uintptr_t lo, hi;
+  int in = 0;
+
+  if (!hp_size)
+    return;
+  f = fopen("/proc/self/smaps", "r");
+  if (!f)
+    return;
+  lo = (uintptr_t)MEM_BASE32(hp_base);
+  hi = lo + hp_size;
+  while (fgets(line, sizeof(line), f)) {
+    if (sscanf(line, "%lx-%lx ", &start, &end) == 2) {
+      in = (start < hi && end > lo);
+      continue;
+    }
+    if (!in)
+      continue;
+    if (sscanf(line, "Rss: %lu kB", &kb) == 1)
+      rss += kb;
+    else if (sscanf(line, "AnonHugePages: %lu kB", &kb) == 1)
+      huge += kb;
+  }
+  fclose(f);
+  dbug_printf("MAPPING: %lu of %lu kB resident in %#x-%#x are huge pages"
+      " (%lu%%)\n", huge, rss, hp_base, hp_base + hp_size,
+      rss ? huge * 100 / rss : 0);
+}
+
 /* Restore mapping previously broken by direct mmap() call. */
 int restore_mapping(int cap, dosaddr_t targ, size_t mapsize)
 {
@@ -412,6 +493,8 @@ int restore_mapping(int cap, dosaddr_t targ, size_t mapsize)
   assert((cap & MAPPING_DPMI) && (targ != (dosaddr_t)-1));
   target = MEM_BASE32(targ);
   addr = mmap_mapping(cap, target, mapsize, PROT_READ | PROT_WRITE);
+  /* the new mapping doesn't inherit the advice */
+  hugepages_advise(targ, mapsize);
   if (is_kvm_map(cap))
     mprotect_kvm(cap, targ, mapsize, PROT_READ | PROT_WRITE);
   return (addr == target ? 0 : -1);
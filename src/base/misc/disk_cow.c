@@ -0,0 +1,328 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Purpose: copy-on-write overlays for disk images.
+ *
+ * The base image is opened read-only and may be shared by any number
+ * of sessions. Writes go to a sparse overlay file:
+ *
+ *   0                  header (struct cow_header)
+ *   COW_HDR_SIZE       bitmap, one bit per COW_BLOCK of the base image
+ *   data_offset        the blocks, each at data_offset + its base offset
+ *
+ * A block is copied up from the base on its first partial write. Only
+ * written blocks take space in the overlay. The header and the bitmap
+ * are mmap'd.
+ *
+ * On close the overlay is kept, committed into the base image or
+ * discarded, depending on the disk's overlay mode.
+ */
+
+#include "emu.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include "utilities.h"
+#include "disks.h"
+
+#define COW_MAGIC "DOSEMUCW"
+#define COW_VERSION 1
+#define COW_BLOCK 4096
+#define COW_HDR_SIZE 4096
+
+struct cow_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t block_size;
+  uint64_t base_size;
+  int64_t base_mtime;		/* the base must not change under the overlay */
+  uint64_t data_offset;
+} __attribute__((packed));
+
+struct disk_cow {
+  int fd;
+  struct cow_header *hdr;
+  unsigned char *bitmap;
+  size_t map_len;
+  uint64_t nblocks;
+
+  /* statistics */
+  unsigned long long rd_base, rd_cow, wr, copy_ups;
+};
+
+static int blk_present(struct disk_cow *c, uint64_t b)
+{
+  return c->bitmap[b >> 3] & (1 << (b & 7));
+}
+
+static void blk_set(struct disk_cow *c, uint64_t b)
+{
+  c->bitmap[b >> 3] |= 1 << (b & 7);
+}
+
+static uint64_t cow_count(struct disk_cow *c)
+{
+  uint64_t b, n = 0;
+
+  for (b = 0; b < c->nblocks; b++)
+    if (blk_present(c, b))
+      n++;
+  return n;
+}
+
+int cow_open(struct disk *dp)
+{
+  struct disk_cow *c;
+  struct stat st, ost;
+  uint64_t bitmap_len;
+  int fd;
+
+  if (fstat(dp->fdesc, &st) == -1 || !S_ISREG(st.st_mode)) {
+    error("overlay %s: base %s is not an image file\n", dp->overlay,
+	dp->dev_name);
+    return -1;
+  }
+
+  fd = open(dp->overlay, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd == -1) {
+    error("can't open overlay %s: %s\n", dp->overlay, strerror(errno));
+    return -1;
+  }
+  if (flock(fd, LOCK_EX | LOCK_NB) == -1) {
+    error("overlay %s is in use by another session\n", dp->overlay);
+    close(fd);
+    return -1;
+  }
+  fstat(fd, &ost);
+
+  c = calloc(1, sizeof(*c));
+  c->fd = fd;
+  c->nblocks = (st.st_size + COW_BLOCK - 1) / COW_BLOCK;
+  bitmap_len = (c->nblocks + 7) / 8;
+  bitmap_len = (bitmap_len + COW_BLOCK - 1) & ~(uint64_t)(COW_BLOCK - 1);
+  c->map_len = COW_HDR_SIZE + bitmap_len;
+
+  if (ost.st_size == 0) {
+    /* new overlay: the data area stays sparse */
+    if (ftruncate(fd, c->map_len + c->nblocks * COW_BLOCK) == -1) {
+      error("can't create overlay %s: %s\n", dp->overlay, strerror(errno));
+      goto err;
+    }
+  } else if (ost.st_size < c->map_len) {
+    error("overlay %s is truncated\n", dp->overlay);
+    goto err;
+  }
+
+  c->hdr = mmap(NULL, c->map_len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (c->hdr == MAP_FAILED) {
+    error("can't map overlay %s: %s\n", dp->overlay, strerror(errno));
+    goto err;
+  }
+  c->bitmap = (unsigned char *)c->hdr + COW_HDR_SIZE;
+
+  if (ost.st_size == 0) {
+    memcpy(c->hdr->magic, COW_MAGIC, sizeof(c->hdr->magic));
+    c->hdr->version = COW_VERSION;
+    c->hdr->block_size = COW_BLOCK;
+    c->hdr->base_size = st.st_size;
+    c->hdr->base_mtime = st.st_mtime;
+    c->hdr->data_offset = c->map_len;
+    d_printf("DISK: created overlay %s for %s\n", dp->overlay, dp->dev_name);
+  } else {
+    if (memcmp(c->hdr->magic, COW_MAGIC, sizeof(c->hdr->magic)) ||
+	c->hdr->version != COW_VERSION || c->hdr->block_size != COW_BLOCK ||
+	c->hdr->data_offset != c->map_len) {
+      error("%s is not an overlay\n", dp->overlay);
+      goto err_unmap;
+    }
+    if (c->hdr->base_size != st.st_size ||
+	c->hdr->base_mtime != st.st_mtime) {
+      error("base image %s changed since overlay %s was created\n",
+	  dp->dev_name, dp->overlay);
+      goto err_unmap;
+    }
+    d_printf("DISK: using overlay %s for %s, %"PRIu64" of %"PRIu64
+	" blocks modified\n", dp->overlay, dp->dev_name, cow_count(c),
+	c->nblocks);
+  }
+
+  dp->cow = c;
+  return 0;
+
+err_unmap:
+  munmap(c->hdr, c->map_len);
+err:
+  close(fd);
+  free(c);
+  return -1;
+}
+
+ssize_t cow_pread(const struct disk *dp, void *buf, size_t len, off_t ofs)
+{
+  struct disk_cow *c = dp->cow;
+  size_t done = 0, n;
+  uint64_t b, e;
+  int in_cow;
+  ssize_t ret;
+
+  while (done < len) {
+    b = (ofs + done) / COW_BLOCK;
+    if (b >= c->nblocks)
+      break;
+    in_cow = blk_present(c, b);
+    /* take the run of blocks with the same origin in one go */
+    for (e = b + 1; e < c->nblocks && !!blk_present(c, e) == in_cow; e++);
+    n = _min(len - done, e * COW_BLOCK - (ofs + done));
+    if (in_cow) {
+      ret = pread(c->fd, (char *)buf + done, n, c->hdr->data_offset + ofs + done);
+      c->rd_cow += n;
+    } else {
+      ret = pread(dp->fdesc, (char *)buf + done, n, ofs + done);
+      c->rd_base += n;
+    }
+    if (ret == -1)
+      return done ? done : -1;
+    done += ret;
+    if (ret < n)
+      break;
+  }
+  return done;
+}
+
+/* bring the whole block into the overlay before it is partially written */
+static int cow_copy_up(const struct disk *dp, uint64_t b)
+{
+  struct disk_cow *c = dp->cow;
+  unsigned char blk[COW_BLOCK];
+  ssize_t ret;
+
+  ret = pread(dp->fdesc, blk, COW_BLOCK, b * COW_BLOCK);
+  if (ret == -1)
+    return -1;
+  memset(blk + ret, 0, COW_BLOCK - ret);
+  if (pwrite(c->fd, blk, COW_BLOCK, c->hdr->data_offset + b * COW_BLOCK) !=
+      COW_BLOCK)
+    return -1;
+  blk_set(c, b);
+  c->copy_ups++;
+  return 0;
+}
+
+ssize_t cow_pwrite(const struct disk *dp, const void *buf, size_t len,
+	off_t ofs)
+{
+  struct disk_cow *c = dp->cow;
+  uint64_t b, first, last;
+  ssize_t ret;
+
+  if (!len)
+    return 0;
+  first = ofs / COW_BLOCK;
+  last = (ofs + len - 1) / COW_BLOCK;
+  if (last >= c->nblocks)
+    return -1;
+
+  if ((ofs % COW_BLOCK) && !blk_present(c, first) &&
+      cow_copy_up(dp, first) == -1)
+    return -1;
+  if (((ofs + len) % COW_BLOCK) && !blk_present(c, last) &&
+      cow_copy_up(dp, last) == -1)
+    return -1;
+
+  ret = pwrite(c->fd, buf, len, c->hdr->data_offset + ofs);
+  if (ret != len)
+    return -1;
+  for (b = first; b <= last; b++)
+    blk_set(c, b);
+  c->wr += len;
+  return len;
+}
+
+static int cow_commit(struct disk *dp)
+{
+  struct disk_cow *c = dp->cow;
+  unsigned char blk[COW_BLOCK];
+  uint64_t b, n = 0;
+  size_t len;
+  int fd;
+
+  fd = open(dp->dev_name, O_WRONLY | O_CLOEXEC);
+  if (fd == -1) {
+    error("can't commit overlay %s: %s: %s\n", dp->overlay, dp->dev_name,
+	strerror(errno));
+    return -1;
+  }
+  for (b = 0; b < c->nblocks; b++) {
+    if (!blk_present(c, b))
+      continue;
+    len = _min(COW_BLOCK, c->hdr->base_size - b * COW_BLOCK);
+    if (pread(c->fd, blk, len, c->hdr->data_offset + b * COW_BLOCK) != len ||
+	pwrite(fd, blk, len, b * COW_BLOCK) != len) {
+      error("commit of overlay %s failed at block %"PRIu64": %s\n",
+	  dp->overlay, b, strerror(errno));
+      close(fd);
+      return -1;
+    }
+    n++;
+  }
+  if (fsync(fd) == -1) {
+    error("commit of overlay %s failed: %s\n", dp->overlay, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  close(fd);
+  d_printf("DISK: committed %"PRIu64" blocks of %s into %s\n", n,
+      dp->overlay, dp->dev_name);
+  return 0;
+}
+
+void cow_close(struct disk *dp)
+{
+  struct disk_cow *c = dp->cow;
+  int keep = 1;
+
+  if (!c)
+    return;
+
+  d_printf("DISK: overlay %s: %"PRIu64" blocks modified, read %llu bytes "
+      "from base and %llu from overlay, wrote %llu, %llu copy-ups\n",
+      dp->overlay, cow_count(c), c->rd_base, c->rd_cow, c->wr, c->copy_ups);
+
+  switch (dp->overlay_mode) {
+  case COW_COMMIT:
+    /* the committed overlay would no longer match the base */
+    keep = (cow_commit(dp) == -1);
+    break;
+  case COW_DISCARD:
+    keep = 0;
+    break;
+  }
+  if (keep)
+    msync(c->hdr, c->map_len, MS_SYNC);
+  else if (unlink(dp->overlay) == -1)
+    error("can't remove overlay %s: %s\n", dp->overlay, strerror(errno));
+
+  munmap(c->hdr, c->map_len);
+  close(c->fd);
+  free(c);
+  dp->cow = NULL;
+}
@@ -0,0 +1,451 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Purpose: asynchronous disk image I/O with io_uring.
+ *
+ * A BIOS disk request is split into chunks of up to URING_CHUNK bytes,
+ * all of which are submitted at once. The int13 thread then sleeps with
+ * interrupts enabled until the last chunk completes, so DOS keeps
+ * running its interrupt handlers in the meantime.
+ *
+ * The data goes through a bounce buffer registered with the ring rather
+ * than straight to DOS memory: the DOS memory can be remapped under the
+ * pinned pages (EMS, video memory) while the request is in flight.
+ */
+
+#include "emu.h"
+#ifdef HAVE_LINUX_IO_URING_H
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#include "coopth.h"
+#include "timers.h"
+#include "ioselect.h"
+#include "dos2linux.h"
+#include "utilities.h"
+#include "disks.h"
+
+#define URING_ENTRIES 16
+#define URING_CHUNK (64 * 1024)
+
+struct uring {
+  int fd;
+  int efd;
+  void *sq_ring, *cq_ring;
+  size_t sq_ring_sz, cq_ring_sz;
+  struct io_uring_sqe *sqes;
+  size_t sqes_sz;
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  struct io_uring_cqe *cqes;
+
+  unsigned char *buf;		/* URING_ENTRIES chunks */
+  int res[URING_ENTRIES];
+  int inflight;
+  int busy;
+  int broken;			/* submission failed, don't use any more */
+  int tried;
+  int tid;			/* waiting thread, or COOPTH_TID_INVALID */
+
+  /* statistics */
+  unsigned long long reqs, chunks, bytes, sync_reqs;
+  unsigned max_depth;
+  hitimer_t lat_total, lat_max;
+};
+
+static struct uring ring = { .fd = -1, .efd = -1 };
+
+static int sys_io_uring_setup(unsigned entries, struct io_uring_params *p)
+{
+  return syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int sys_io_uring_enter(int fd, unsigned to_submit,
+	unsigned min_complete, unsigned flags)
+{
+  return syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+	NULL, 0);
+}
+
+static int sys_io_uring_register(int fd, unsigned opcode, const void *arg,
+	unsigned nr_args)
+{
+  return syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+static void uring_unmap(void)
+{
+  if (ring.sqes && ring.sqes != MAP_FAILED)
+    munmap(ring.sqes, ring.sqes_sz);
+  if (ring.cq_ring && ring.cq_ring != MAP_FAILED &&
+      ring.cq_ring != ring.sq_ring)
+    munmap(ring.cq_ring, ring.cq_ring_sz);
+  if (ring.sq_ring && ring.sq_ring != MAP_FAILED)
+    munmap(ring.sq_ring, ring.sq_ring_sz);
+  ring.sqes = NULL;
+  ring.sq_ring = ring.cq_ring = NULL;
+}
+
+static void uring_reap(void)
+{
+  uint64_t cnt;
+  unsigned head;
+  struct io_uring_cqe *cqe;
+
+  if (read(ring.efd, &cnt, sizeof(cnt)) != sizeof(cnt) && errno != EAGAIN)
+    d_printf("DISK: uring eventfd read failed: %s\n", strerror(errno));
+
+  head = *ring.cq_head;
+  while (head != __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE)) {
+    cqe = &ring.cqes[head & *ring.cq_mask];
+    if (cqe->user_data < URING_ENTRIES)
+      ring.res[cqe->user_data] = cqe->res;
+    ring.inflight--;
+    head++;
+  }
+  __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+
+  if (!ring.inflight && ring.busy) {
+    if (ring.tid != COOPTH_TID_INVALID)
+      coopth_wake_up(ring.tid);
+    else
+      ring.busy = 0;		/* the requester was cancelled */
+  }
+}
+
+/* called on the main thread when the eventfd fires */
+static void uring_complete(int fd, void *arg)
+{
+  uring_reap();
+  ioselect_complete(fd);
+}
+
+static void uring_init(void)
+{
+  struct io_uring_params p;
+  struct iovec iov[URING_ENTRIES];
+  int i;
+
+  memset(&p, 0, sizeof(p));
+  ring.fd = sys_io_uring_setup(URING_ENTRIES, &p);
+  if (ring.fd == -1) {
+    error("DISK: io_uring not available (%s), using synchronous I/O\n",
+	strerror(errno));
+    return;
+  }
+
+  ring.sq_ring_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  ring.cq_ring_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    if (ring.cq_ring_sz > ring.sq_ring_sz)
+      ring.sq_ring_sz = ring.cq_ring_sz;
+  }
+  ring.sq_ring = mmap(NULL, ring.sq_ring_sz, PROT_READ | PROT_WRITE,
+	MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQ_RING);
+  if (ring.sq_ring == MAP_FAILED)
+    goto err;
+  if (p.features & IORING_FEAT_SINGLE_MMAP)
+    ring.cq_ring = ring.sq_ring;
+  else
+    ring.cq_ring = mmap(NULL, ring.cq_ring_sz, PROT_READ | PROT_WRITE,
+	MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_CQ_RING);
+  if (ring.cq_ring == MAP_FAILED)
+    goto err;
+  ring.sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+  ring.sqes = mmap(NULL, ring.sqes_sz, PROT_READ | PROT_WRITE,
+	MAP_SHARED | MAP_POPULATE, ring.fd, IORING_OFF_SQES);
+  if (ring.sqes == MAP_FAILED)
+    goto err;
+
+  ring.sq_head = ring.sq_ring + p.sq_off.head;
+  ring.sq_tail = ring.sq_ring + p.sq_off.tail;
+  ring.sq_mask = ring.sq_ring + p.sq_off.ring_mask;
+  ring.sq_array = ring.sq_ring + p.sq_off.array;
+  ring.cq_head = ring.cq_ring + p.cq_off.head;
+  ring.cq_tail = ring.cq_ring + p.cq_off.tail;
+  ring.cq_mask = ring.cq_ring + p.cq_off.ring_mask;
+  ring.cqes = ring.cq_ring + p.cq_off.cqes;
+
+  ring.buf = mmap(NULL, URING_ENTRIES * URING_CHUNK, PROT_READ | PROT_WRITE,
+	MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ring.buf == MAP_FAILED) {
+    ring.buf = NULL;
+    goto err;
+  }
+  for (i = 0; i < URING_ENTRIES; i++) {
+    iov[i].iov_base = ring.buf + i * URING_CHUNK;
+    iov[i].iov_len = URING_CHUNK;
+  }
+  if (sys_io_uring_register(ring.fd, IORING_REGISTER_BUFFERS, iov,
+	URING_ENTRIES) == -1)
+    goto err;
+
+  ring.efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (ring.efd == -1)
+    goto err;
+  if (sys_io_uring_register(ring.fd, IORING_REGISTER_EVENTFD, &ring.efd,
+	1) == -1)
+    goto err;
+  add_to_io_select(ring.efd, uring_complete, NULL);
+
+  ring.tid = COOPTH_TID_INVALID;
+  d_printf("DISK: using io_uring, %u entries\n", p.sq_entries);
+  return;
+
+err:
+  error("DISK: io_uring setup failed (%s), using synchronous I/O\n",
+	strerror(errno));
+  if (ring.efd != -1)
+    close(ring.efd);
+  ring.efd = -1;
+  if (ring.buf)
+    munmap(ring.buf, URING_ENTRIES * URING_CHUNK);
+  ring.buf = NULL;
+  uring_unmap();
+  close(ring.fd);
+  ring.fd = -1;
+}
+
+void disk_uring_done(void)
+{
+  if (ring.fd == -1)
+    return;
+
+  remove_from_io_select(ring.efd);
+  /* don't unmap the buffer under a request still in flight */
+  ring.tid = COOPTH_TID_INVALID;
+  while (ring.inflight) {
+    if (sys_io_uring_enter(ring.fd, 0, 1, IORING_ENTER_GETEVENTS) == -1 &&
+	errno != EINTR)
+      break;
+    uring_reap();
+  }
+
+  d_printf("DISK: io_uring: %llu requests in %llu chunks, %llu bytes, "
+	"%llu done synchronously\n", ring.reqs, ring.chunks, ring.bytes,
+	ring.sync_reqs);
+  if (ring.reqs)
+    d_printf("DISK: io_uring: max queue depth %u, latency avg %lluus, "
+	"max %lluus\n", ring.max_depth,
+	(unsigned long long)(ring.lat_total / ring.reqs),
+	(unsigned long long)ring.lat_max);
+
+  close(ring.efd);
+  ring.efd = -1;
+  munmap(ring.buf, URING_ENTRIES * URING_CHUNK);
+  ring.buf = NULL;
+  uring_unmap();
+  close(ring.fd);
+  ring.fd = -1;
+}
+
+/*
+ * Whether disk_uring_rw() can serve the request. The int13 thread can
+ * be re-entered from an interrupt handler while it sleeps on the ring;
+ * such nested requests are done synchronously.
+ */
+int disk_uring_avail(void)
+{
+  if (!ring.tried && config.disk_uring) {
+    ring.tried = 1;
+    uring_init();
+  }
+  if (ring.fd == -1 || ring.broken)
+    return 0;
+  if (ring.busy || !coopth_is_in_thread()) {
+    ring.sync_reqs++;
+    return 0;
+  }
+  return 1;
+}
+
+static void uring_prep(int k, int fd, unsigned len, off_t pos, int wr)
+{
+  unsigned tail = *ring.sq_tail;
+  unsigned idx = tail & *ring.sq_mask;
+  struct io_uring_sqe *sqe = &ring.sqes[idx];
+
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = wr ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED;
+  sqe->fd = fd;
+  sqe->addr = (unsigned long)(ring.buf + k * URING_CHUNK);
+  sqe->len = len;
+  sqe->off = pos;
+  sqe->buf_index = k;
+  sqe->user_data = k;
+  ring.sq_array[idx] = idx;
+  __atomic_store_n(ring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Read (wr=0) or write (wr=1) cnt bytes at file offset pos to/from DOS
+ * memory at buffer, or to rbuf / from wbuf if they are not NULL.
+ * Returns the number of bytes transferred, -1 on I/O error, or -2 if the
+ * request could not be submitted and has to be done synchronously.
+ */
+static int uring_rw(int fd, unsigned buffer, unsigned char *rbuf,
+	const unsigned char *wbuf, int cnt, off_t pos, int wr)
+{
+  int done = 0, n, k, chunks, len, ret, iflg;
+  hitimer_t t0, lat;
+
+  ring.busy = 1;
+  ring.tid = coopth_get_tid();
+  ring.reqs++;
+  t0 = GETusTIME(0);
+
+  while (done < cnt) {
+    n = _min(cnt - done, URING_ENTRIES * URING_CHUNK);
+    chunks = (n + URING_CHUNK - 1) / URING_CHUNK;
+    for (k = 0; k < chunks; k++) {
+      len = _min(n - k * URING_CHUNK, URING_CHUNK);
+      if (wr && wbuf)
+        memcpy(ring.buf + k * URING_CHUNK, wbuf + done + k * URING_CHUNK, len);
+      else if (wr)
+        memcpy_2unix(ring.buf + k * URING_CHUNK, buffer + done + k * URING_CHUNK,
+            len);
+      uring_prep(k, fd, len, pos + done + k * URING_CHUNK, wr);
+    }
+    ret = sys_io_uring_enter(ring.fd, chunks, 0, 0);
+    if (ret != chunks) {
+      /* the unsubmitted entries are stuck in the ring */
+      error("DISK: io_uring submit failed (%s), using synchronous I/O\n",
+          ret == -1 ? strerror(errno) : "short submit");
+      ring.broken = 1;
+      if (ret > 0)
+        ring.inflight += ret;
+      ring.tid = COOPTH_TID_INVALID;
+      if (!ring.inflight)
+        ring.busy = 0;
+      return -2;
+    }
+    ring.inflight += chunks;
+    ring.chunks += chunks;
+    if (ring.inflight > ring.max_depth)
+      ring.max_depth = ring.inflight;
+
+    iflg = isset_IF();
+    if (!iflg)
+      set_IF();
+    while (ring.inflight) {
+      if (coopth_sleep() == -1) {
+        /* cancelled: let uring_complete() release the ring */
+        ring.tid = COOPTH_TID_INVALID;
+        if (!iflg)
+          clear_IF();
+        return -1;
+      }
+    }
+    if (!iflg)
+      clear_IF();
+
+    for (k = 0; k < chunks; k++) {
+      len = _min(n - k * URING_CHUNK, URING_CHUNK);
+      ret = ring.res[k];
+      if (ret < 0) {
+        errno = -ret;
+        goto err;
+      }
+      if (!wr && ret && rbuf)
+        memcpy(rbuf + done + k * URING_CHUNK, ring.buf + k * URING_CHUNK, ret);
+      else if (!wr && ret)
+        memcpy_2dos(buffer + done + k * URING_CHUNK,
+            ring.buf + k * URING_CHUNK, ret);
+      if (ret < len) {
+        /* end of the image */
+        done += k * URING_CHUNK + ret;
+        goto out;
+      }
+    }
+    done += n;
+  }
+
+out:
+  lat = GETusTIME(0) - t0;
+  ring.lat_total += lat;
+  if (lat > ring.lat_max)
+    ring.lat_max = lat;
+  ring.bytes += done;
+  if (debug_level('d') > 5)
+    d_printf("DISK: io_uring %s of %i bytes done in %lluus\n",
+        wr ? "write" : "read", done, (unsigned long long)lat);
+  ring.busy = 0;
+  ring.tid = COOPTH_TID_INVALID;
+  return done;
+
+err:
+  ring.tid = COOPTH_TID_INVALID;
+  if (!ring.inflight)
+    ring.busy = 0;
+  return -1;
+}
+
+int disk_uring_rw(int fd, unsigned buffer, int cnt, off_t pos, int wr)
+{
+  return uring_rw(fd, buffer, NULL, NULL, cnt, pos, wr);
+}
+
+/* same with a host buffer, for the sector cache */
+int disk_uring_pread(int fd, void *buf, int cnt, off_t pos)
+{
+  return uring_rw(fd, 0, buf, NULL, cnt, pos, 0);
+}
+
+int disk_uring_pwrite(int fd, const void *buf, int cnt, off_t pos)
+{
+  return uring_rw(fd, 0, NULL, buf, cnt, pos, 1);
+}
+
+#else
+
+void disk_uring_done(void)
+{
+}
+
+int disk_uring_avail(void)
+{
+  static int warned;
+
+  if (config.disk_uring && !warned) {
+    warned = 1;
+    error("DISK: io_uring support not compiled in\n");
+  }
+  return 0;
+}
+
+int disk_uring_rw(int fd, unsigned buffer, int cnt, off_t pos, int wr)
+{
+  return -1;
+}
+
+int disk_uring_pread(int fd, void *buf, int cnt, off_t pos)
+{
+  return -1;
+}
+
+int disk_uring_pwrite(int fd, const void *buf, int cnt, off_t pos)
+{
+  return -1;
+}
+
+#endif
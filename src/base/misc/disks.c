@@ -224,6 +224,372 @@ int read_mbr(const struct disk *dp, unsigned buffer)
  * combination.
  */
 
+/* read from the image, through the overlay if there is one */
+static ssize_t disk_pread(const struct disk *dp, void *buf, size_t len,
+    off_t ofs)
+{
+  ssize_t ret;
+
+  if (dp->cow)
+    return cow_pread(dp, buf, len, ofs);
+  if (disk_uring_avail()) {
+    ret = disk_uring_pread(dp->fdesc, buf, len, ofs);
+    if (ret != -2)
+      return ret;
+  }
+  return RPT_SYSCALL(pread(dp->fdesc, buf, len, ofs));
+}
+
+static ssize_t disk_pwrite_sync(const struct disk *dp, const void *buf,
+    size_t len, off_t ofs)
+{
+  if (dp->cow)
+    return cow_pwrite(dp, buf, len, ofs);
+  return RPT_SYSCALL(pwrite(dp->fdesc, buf, len, ofs));
+}
+
+static ssize_t disk_pwrite(const struct disk *dp, const void *buf, size_t len,
+    off_t ofs)
+{
+  ssize_t ret;
+
+  if (!dp->cow && disk_uring_avail()) {
+    ret = disk_uring_pwrite(dp->fdesc, buf, len, ofs);
+    if (ret != -2)
+      return ret;
+  }
+  return disk_pwrite_sync(dp, buf, len, ofs);
+}
+
+/*
+ * Sector cache.
+ *
+ * DOS does lots of small reads (FAT chains, directory sectors), each of
+ * which would otherwise be a separate host read. Image data is kept in
+ * DCACHE_BLK blocks of the image file, with LRU replacement, shared by
+ * all image, partition and floppy drives. Directory drives have their
+ * own cache in fatfs.
+ *
+ * A read that starts where the previous read of that drive ended is
+ * taken as sequential, and the read-ahead window grows up to
+ * DCACHE_RA_MAX blocks.
+ *
+ * Writes go through to the image, unless config.disk_cache_wb is set.
+ * Then the writes to fixed disks stay in the cache until the block is
+ * evicted, until the next periodic flush or until the disks are reset.
+ * Removable disks are always write-through. Their blocks are dropped
+ * when the motor is turned off, so a swapped floppy is noticed.
+ *
+ * With $_disk_uring the misses and the write-through writes go to the
+ * ring, and an interrupt handler can start a nested disk request while
+ * they wait. A fill that raced with a nested write is read again. The
+ * write-backs of the dirty blocks are synchronous, as they happen while
+ * walking the cache lists.
+ */
+#define DCACHE_BLK 4096
+#define DCACHE_HASH 1024
+#define DCACHE_RA_MAX 16
+#define DCACHE_FLUSH_TICKS 18
+#define DCACHE_MIN_BLKS (4 * DCACHE_RA_MAX)
+
+struct dcache_blk {
+  const struct disk *dp;
+  uint64_t blk;
+  struct dcache_blk *hnext;
+  struct dcache_blk *prev, *next;	/* LRU list, most recent first */
+  int len;			/* short at the end of the image */
+  int dirty;
+  int ra;			/* read ahead and not yet used */
+  unsigned char data[DCACHE_BLK];
+};
+
+static struct {
+  struct dcache_blk *hash[DCACHE_HASH];
+  struct dcache_blk lru;
+  int nblks;
+  /* sequential read detection, per drive */
+  off_t seq_next[MAX_FDISKS + MAX_HDISKS];
+  int ra_win[MAX_FDISKS + MAX_HDISKS];
+
+  unsigned wgen;			/* bumped on every write */
+
+  unsigned long long hits, misses, saved, ra_blks, ra_used, writebacks;
+} dcache = { .lru = { .prev = &dcache.lru, .next = &dcache.lru } };
+
+static int dcache_enabled(const struct disk *dp)
+{
+  return config.disk_cache > 0 && dp->type != DIR_TYPE;
+}
+
+static int disk_idx(const struct disk *dp)
+{
+  if (dp >= disktab && dp < &disktab[MAX_FDISKS])
+    return dp - disktab;
+  return MAX_FDISKS + (dp - hdisktab);
+}
+
+static unsigned dcache_hash(const struct disk *dp, uint64_t blk)
+{
+  return (blk * 31 + disk_idx(dp)) % DCACHE_HASH;
+}
+
+static void dcache_lru_del(struct dcache_blk *b)
+{
+  b->prev->next = b->next;
+  b->next->prev = b->prev;
+}
+
+static void dcache_lru_add(struct dcache_blk *b)
+{
+  b->next = dcache.lru.next;
+  b->prev = &dcache.lru;
+  dcache.lru.next->prev = b;
+  dcache.lru.next = b;
+}
+
+static struct dcache_blk *dcache_lookup(const struct disk *dp, uint64_t blk)
+{
+  struct dcache_blk *b;
+
+  for (b = dcache.hash[dcache_hash(dp, blk)]; b; b = b->hnext) {
+    if (b->dp == dp && b->blk == blk) {
+      dcache_lru_del(b);
+      dcache_lru_add(b);
+      return b;
+    }
+  }
+  return NULL;
+}
+
+static int dcache_writeback(struct dcache_blk *b)
+{
+  if (!b->dirty)
+    return 0;
+  b->dirty = 0;
+  dcache.writebacks++;
+  if (disk_pwrite_sync(b->dp, b->data, b->len, b->blk * DCACHE_BLK) !=
+      b->len) {
+    error("DISK: write-back to %s failed: %s\n", b->dp->dev_name,
+        strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+static void dcache_unlink(struct dcache_blk *b)
+{
+  struct dcache_blk **pp = &dcache.hash[dcache_hash(b->dp, b->blk)];
+
+  while (*pp != b)
+    pp = &(*pp)->hnext;
+  *pp = b->hnext;
+  dcache_lru_del(b);
+}
+
+/* get a free block for the new entry, evicting the LRU one if needed */
+static struct dcache_blk *dcache_new(const struct disk *dp, uint64_t blk)
+{
+  struct dcache_blk *b;
+  unsigned h;
+
+  if (dcache.nblks < _max(config.disk_cache * 1024 / DCACHE_BLK,
+      DCACHE_MIN_BLKS)) {
+    b = malloc(sizeof(*b));
+    dcache.nblks++;
+  } else {
+    b = dcache.lru.prev;
+    dcache_writeback(b);
+    dcache_unlink(b);
+  }
+  b->dp = dp;
+  b->blk = blk;
+  b->len = 0;
+  b->dirty = 0;
+  b->ra = 0;
+  h = dcache_hash(dp, blk);
+  b->hnext = dcache.hash[h];
+  dcache.hash[h] = b;
+  dcache_lru_add(b);
+  return b;
+}
+
+/* fill blocks [blk, blk + n) from the image */
+static int dcache_fill(const struct disk *dp, uint64_t blk, int n, int ra)
+{
+  unsigned char *buf = malloc(n * DCACHE_BLK);
+  struct dcache_blk *b;
+  ssize_t got;
+  unsigned gen;
+  int i;
+
+  do {
+    gen = dcache.wgen;
+    got = disk_pread(dp, buf, n * DCACHE_BLK, blk * DCACHE_BLK);
+    if (got == -1) {
+      free(buf);
+      return -1;
+    }
+  } while (gen != dcache.wgen);
+  for (i = 0; i < n && got > i * DCACHE_BLK; i++) {
+    /* don't replace the blocks that were written meanwhile */
+    if (dcache_lookup(dp, blk + i))
+      continue;
+    b = dcache_new(dp, blk + i);
+    b->len = _min(DCACHE_BLK, got - i * DCACHE_BLK);
+    memcpy(b->data, buf + i * DCACHE_BLK, b->len);
+    if (i >= ra) {
+      b->ra = 1;
+      dcache.ra_blks++;
+    }
+  }
+  free(buf);
+  return 0;
+}
+
+static ssize_t dcache_read(const struct disk *dp, void *buf, size_t len,
+    off_t pos)
+{
+  int idx = disk_idx(dp);
+  uint64_t blk, last = (pos + len - 1) / DCACHE_BLK, e;
+  struct dcache_blk *b;
+  size_t done = 0, n, ofs;
+  int hit;
+
+  if (!len)
+    return 0;
+  if (pos == dcache.seq_next[idx])
+    dcache.ra_win[idx] = _min(DCACHE_RA_MAX,
+        dcache.ra_win[idx] ? dcache.ra_win[idx] * 2 : 2);
+  else
+    dcache.ra_win[idx] = 0;
+  dcache.seq_next[idx] = pos + len;
+
+  while (done < len) {
+    blk = (pos + done) / DCACHE_BLK;
+    ofs = (pos + done) % DCACHE_BLK;
+    b = dcache_lookup(dp, blk);
+    hit = !!b;
+    if (b) {
+      dcache.hits++;
+      if (b->ra) {
+        b->ra = 0;
+        dcache.ra_used++;
+      }
+    } else {
+      dcache.misses++;
+      /* fetch the whole missing run, plus the read-ahead past the request */
+      for (e = blk + 1; e <= last && !dcache_lookup(dp, e); e++);
+      if (e > last)
+        e += dcache.ra_win[idx];
+      /* never more than the smallest cache can hold */
+      e = _min(e, blk + 2 * DCACHE_RA_MAX);
+      if (dcache_fill(dp, blk, e - blk, last + 1 - blk) == -1)
+        return done ? done : -1;
+      b = dcache_lookup(dp, blk);
+      if (!b)
+        break;		/* past the end of the image */
+    }
+    if (ofs >= b->len)
+      break;
+    n = _min(len - done, b->len - ofs);
+    memcpy((char *)buf + done, b->data + ofs, n);
+    if (hit)
+      dcache.saved += n;
+    done += n;
+    if (b->len < DCACHE_BLK)
+      break;
+  }
+  return done;
+}
+
+static ssize_t dcache_write(const struct disk *dp, const void *buf,
+    size_t len, off_t pos)
+{
+  int wb = config.disk_cache_wb && !dp->removable;
+  struct dcache_blk *b;
+  uint64_t blk;
+  size_t done = 0, n, ofs;
+
+  dcache.wgen++;
+  if (!wb && disk_pwrite(dp, buf, len, pos) != len)
+    return -1;
+
+  while (done < len) {
+    blk = (pos + done) / DCACHE_BLK;
+    ofs = (pos + done) % DCACHE_BLK;
+    n = _min(len - done, DCACHE_BLK - ofs);
+    b = dcache_lookup(dp, blk);
+    if (!b && wb) {
+      if (ofs || n < DCACHE_BLK) {
+        /* partial block: read the rest of it first */
+        if (dcache_fill(dp, blk, 1, 1) == -1)
+          return -1;
+        b = dcache_lookup(dp, blk);
+      }
+      if (!b)
+        b = dcache_new(dp, blk);
+    }
+    if (b) {
+      if (ofs > b->len)
+        memset(b->data + b->len, 0, ofs - b->len);
+      memcpy(b->data + ofs, (const char *)buf + done, n);
+      if (ofs + n > b->len)
+        b->len = ofs + n;
+      b->ra = 0;
+      if (wb) {
+        /* rewriting a dirty block costs no host I/O */
+        if (b->dirty)
+          dcache.saved += n;
+        b->dirty = 1;
+      }
+    }
+    done += n;
+  }
+  return len;
+}
+
+/* write back the dirty blocks of dp, or of all drives */
+static void dcache_flush(const struct disk *dp)
+{
+  struct dcache_blk *b;
+
+  for (b = dcache.lru.next; b != &dcache.lru; b = b->next)
+    if (!dp || b->dp == dp)
+      dcache_writeback(b);
+}
+
+/* drop the blocks of dp, or of all drives */
+static void dcache_inval(const struct disk *dp)
+{
+  struct dcache_blk *b, *next;
+
+  for (b = dcache.lru.next; b != &dcache.lru; b = next) {
+    next = b->next;
+    if (dp && b->dp != dp)
+      continue;
+    dcache_writeback(b);
+    dcache_unlink(b);
+    free(b);
+    dcache.nblks--;
+  }
+  if (dp)
+    dcache.seq_next[disk_idx(dp)] = -1;
+}
+
+static void dcache_stats(void)
+{
+  unsigned long long total = dcache.hits + dcache.misses;
+
+  if (!total)
+    return;
+  d_printf("DISK: cache: %llu hits, %llu misses (%.1f%% hit ratio), "
+      "%llu bytes of host I/O saved\n", dcache.hits, dcache.misses,
+      dcache.hits * 100.0 / total, dcache.saved);
+  d_printf("DISK: cache: %llu blocks read ahead, %llu of them used, "
+      "%llu written back\n", dcache.ra_blks, dcache.ra_used,
+      dcache.writebacks);
+}
+
 static off_t calc_pos(const struct disk *dp, int64_t sector)
 {
     off_t pos;
@@ -314,12 +680,36 @@ read_sectors(const struct disk *dp, unsigned buffer, uint64_t sector,
     if(tmpread == -2) return -DERR_ECCERR;
     tmpread *= SECTOR_SIZE;
   }
+  else if (dcache_enabled(dp)) {
+    long len = count * SECTOR_SIZE - already;
+    void *buf = malloc(len);
+
+    tmpread = dcache_read(dp, buf, len, pos);
+    if (tmpread > 0)
+      memcpy_2dos(buffer, buf, tmpread);
+    free(buf);
+  }
+  else if (dp->cow) {
+    long len = count * SECTOR_SIZE - already;
+    void *buf = malloc(len);
+
+    tmpread = cow_pread(dp, buf, len, pos);
+    if (tmpread > 0)
+      memcpy_2dos(buffer, buf, tmpread);
+    free(buf);
+  }
   else {
-    if(pos != lseek(dp->fdesc, pos, SEEK_SET)) {
-      error("Sector not found in read_sector, error = %s!\n", strerror(errno));
-      return -DERR_NOTFOUND;
+    tmpread = -2;
+    if (disk_uring_avail())
+      tmpread = disk_uring_rw(dp->fdesc, buffer, count * SECTOR_SIZE - already,
+          pos, 0);
+    if (tmpread == -2) {
+      if(pos != lseek(dp->fdesc, pos, SEEK_SET)) {
+        error("Sector not found in read_sector, error = %s!\n", strerror(errno));
+        return -DERR_NOTFOUND;
+      }
+      tmpread = dos_read(dp->fdesc, buffer, count * SECTOR_SIZE - already);
     }
-    tmpread = dos_read(dp->fdesc, buffer, count * SECTOR_SIZE - already);
   }
 
   if(tmpread != -1) {
@@ -395,12 +785,42 @@ write_sectors(struct disk *dp, unsigned buffer, uint64_t sector,
     if(tmpwrite == -1) return -DERR_WRITEFLT;
     tmpwrite *= SECTOR_SIZE;
   }
+  else if (dcache_enabled(dp)) {
+    long len = count * SECTOR_SIZE - already;
+    void *buf = malloc(len);
+
+    memcpy_2unix(buf, buffer, len);
+    tmpwrite = dcache_write(dp, buf, len, pos);
+    free(buf);
+    if (tmpwrite == -1) {
+      error("write to %s failed: %s\n", dp->dev_name, strerror(errno));
+      return -DERR_WRITEFLT;
+    }
+  }
+  else if (dp->cow) {
+    long len = count * SECTOR_SIZE - already;
+    void *buf = malloc(len);
+
+    memcpy_2unix(buf, buffer, len);
+    tmpwrite = cow_pwrite(dp, buf, len, pos);
+    free(buf);
+    if (tmpwrite == -1) {
+      error("write to overlay %s failed: %s\n", dp->overlay, strerror(errno));
+      return -DERR_WRITEFLT;
+    }
+  }
   else {
-    if(pos != lseek(dp->fdesc, pos, SEEK_SET)) {
-      error("Sector not found in write_sector!\n");
-      return -DERR_NOTFOUND;
+    tmpwrite = -2;
+    if (disk_uring_avail())
+      tmpwrite = disk_uring_rw(dp->fdesc, buffer,
+          count * SECTOR_SIZE - already, pos, 1);
+    if (tmpwrite == -2) {
+      if(pos != lseek(dp->fdesc, pos, SEEK_SET)) {
+        error("Sector not found in write_sector!\n");
+        return -DERR_NOTFOUND;
+      }
+      tmpwrite = dos_write(dp->fdesc, buffer, count * SECTOR_SIZE - already);
     }
-    tmpwrite = dos_write(dp->fdesc, buffer, count * SECTOR_SIZE - already);
   }
 
   /* this should make floppies a little safer...I would as soon use the
@@ -828,8 +1248,7 @@ static void image_auto(struct disk *dp)
 
   // Hard disk image
 
-  lseek(dp->fdesc, 0, SEEK_SET);
-  if (RPT_SYSCALL(read(dp->fdesc, &sect0.buf, sizeof(sect0))) != sizeof(sect0)) {
+  if (disk_pread(dp, &sect0.buf, sizeof(sect0), 0) != sizeof(sect0)) {
     error("could not read sector 0 in image_init\n");
     leavedos(19);
   }
@@ -905,7 +1324,7 @@ static void image_auto(struct disk *dp)
 static void MBR_setup(struct disk *dp)
 {
   ssize_t rd;
-  int ret, i;
+  int i;
 
   if (dp->floppy) {
     return;
@@ -913,12 +1332,8 @@ static void MBR_setup(struct disk *dp)
 
   /* Disk / Image already has MBR */
   dp->part_info.number = 1;
-  ret = lseek(dp->fdesc, dp->header, SEEK_SET);
-  if (ret == -1) {
-    error("MBR_setup: Can't seek '%s'\n", dp->dev_name);
-    leavedos(35);
-  }
-  rd = read(dp->fdesc, &dp->part_info.mbr, sizeof(dp->part_info.mbr));
+  rd = disk_pread(dp, &dp->part_info.mbr, sizeof(dp->part_info.mbr),
+      dp->header);
   if (rd != sizeof(dp->part_info.mbr)) {
     error("MBR_setup: Can't read MBR from '%s'\n", dp->dev_name);
     leavedos(35);
@@ -961,8 +1376,7 @@ static void partition_auto(struct disk *dp)
     dp->num_secs = sb.st_size / SECTOR_SIZE;
   }
 
-  lseek(dp->fdesc, 0, SEEK_SET);
-  if (RPT_SYSCALL(read(dp->fdesc, &vbr, sizeof(vbr))) != sizeof(vbr)) {
+  if (disk_pread(dp, &vbr, sizeof(vbr), 0) != sizeof(vbr)) {
     error("could not read first sector PARTITION %s\n", dp->dev_name);
     leavedos(22);
   }
@@ -1008,8 +1422,7 @@ static void VBR_setup(struct disk *dp)
     return;
   }
 
-  lseek(dp->fdesc, 0, SEEK_SET);
-  if (RPT_SYSCALL(read(dp->fdesc, &vbr, sizeof(vbr))) != sizeof(vbr)) {
+  if (disk_pread(dp, &vbr, sizeof(vbr), 0) != sizeof(vbr)) {
     d_printf("  BPB could not be read\n");
   } else {
     if (vbr.u.bpb7.num_sectors_small == 0 && (
@@ -1039,6 +1452,7 @@ disk_close(void)
   for (dp = disktab; dp < &disktab[FDISKS]; dp++) {
     if (dp->removable && dp->fdesc >= 0) {
       d_printf("DISK: Closing disk %s\n",dp->dev_name);
+      dcache_inval(dp);
       (void) close(dp->fdesc);
       dp->fdesc = -1;
     }
@@ -1143,6 +1557,7 @@ disk_close_all(void)
   if (!disks_initiated)
     return;  /* prevent idiocy */
 
+  dcache_inval(NULL);
   for (dp = disktab; dp < &disktab[FDISKS]; dp++) {
     if (dp->fdesc >= 0) {
       d_printf("Floppy disk Closing %x\n", dp->fdesc);
@@ -1150,8 +1565,11 @@ disk_close_all(void)
       dp->fdesc = -1;
     }
   }
+  disk_uring_done();
+  dcache_stats();
   FOR_EACH_HDISK(i, {
     if(hdisktab[i].type == DIR_TYPE) fatfs_done(&hdisktab[i]);
+    cow_close(&hdisktab[i]);
     if (hdisktab[i].fdesc >= 0) {
       d_printf("Hard disk Closing %x\n", hdisktab[i].fdesc);
       (void) close(hdisktab[i].fdesc);
@@ -1232,6 +1650,9 @@ static void disk_reset2(void)
   struct disk *dp;
   int i;
 
+  /* the images are reopened below */
+  dcache_inval(NULL);
+
   /*
    * Open floppy disks
    */
@@ -1277,8 +1698,9 @@ static void disk_reset2(void)
     dp = &hdisktab[i];
     if (dp->fdesc != -1)
       close(dp->fdesc);
+    /* with an overlay, the image itself is never written */
     dp->fdesc = open(dp->type == DIR_TYPE ? "/dev/null" : dp->dev_name,
-        (dp->rdonly ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+        (dp->rdonly || dp->overlay ? O_RDONLY : O_RDWR) | O_CLOEXEC);
     if (dp->fdesc < 0) {
       if (errno == EROFS || errno == EACCES) {
         dp->fdesc = open(dp->dev_name, O_RDONLY | O_CLOEXEC);
@@ -1296,6 +1718,9 @@ static void disk_reset2(void)
     }
     dp->removable = 0;
 
+    if (dp->overlay && dp->fdesc >= 0 && !dp->cow && cow_open(dp) == -1)
+      config.exitearly = 1;
+
     /* HACK: if unspecified geometry (-1) then try to get it from kernel.
        May only work on WD compatible disks (MFM/RLL/ESDI/IDE). */
     if (dp->sectors == -1)
@@ -2106,7 +2531,7 @@ int int13(void)
 void
 floppy_tick(void)
 {
-  static int ticks = 0;
+  static int ticks = 0, dcache_ticks = 0;
 
   /* some progs (InstallShield/win31) monitor these locations */
   WRITE_BYTE(BIOS_MOTOR_TIMEOUT, READ_BYTE(BIOS_MOTOR_TIMEOUT) - 1);
@@ -2118,6 +2543,10 @@ floppy_tick(void)
       d_printf("FLOPPY: flushing after %d ticks\n", ticks);
     ticks = 0;
   }
+  if (config.disk_cache_wb && ++dcache_ticks >= DCACHE_FLUSH_TICKS) {
+    dcache_flush(NULL);
+    dcache_ticks = 0;
+  }
 }
 
 fatfs_t *get_fat_fs_by_serial(unsigned long serial, int *r_idx, int *r_ro)
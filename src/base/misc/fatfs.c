@@ -62,6 +62,8 @@
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>			/* RxDOS.3 lsv uses types */
+#include <pthread.h>
+#include <wchar.h>
 #ifdef HAVE_LIBBSD
 #include <bsd/string.h>
 #endif
@@ -92,12 +94,21 @@ static unsigned make_dos_entry(fatfs_t *, const obj_t *, unsigned char **);
 static unsigned find_obj(fatfs_t *, unsigned);
 static void assign_clusters(fatfs_t *, unsigned, unsigned);
 static int read_cluster(fatfs_t *, unsigned, unsigned, unsigned char *buf);
+static int read_file_run(fatfs_t *, unsigned, unsigned, unsigned);
+static int open_obj(fatfs_t *, unsigned);
 static int read_file(fatfs_t *, unsigned, unsigned, unsigned,
 	unsigned char *buf);
 static int read_dir(fatfs_t *, unsigned, unsigned, unsigned,
 	unsigned char *buf);
 static unsigned next_cluster(fatfs_t *, unsigned);
 static void build_boot_blk(fatfs_t *m, unsigned char *b);
+static int wr_init(fatfs_t *);
+static void wr_done(fatfs_t *);
+static void wr_reap(fatfs_t *);
+static void wr_wait_renames(fatfs_t *);
+static int wr_write_sec(fatfs_t *, unsigned, const unsigned char *buf);
+static int wr_override(fatfs_t *, unsigned);
+static int wr_read_sec(fatfs_t *, unsigned, unsigned char *buf);
 
 static uint64_t sys_type;
 static int sys_done;
@@ -324,6 +335,8 @@ void fatfs_done(struct disk *dp)
 
   if(!(f = dp->fatfs)) return;
 
+  if(f->wr) wr_done(f);
+
   for(u = 1 ; u < f->objs; u++) {
     if(f->obj[u].name)
       free(f->obj[u].name);
@@ -334,6 +347,7 @@ void fatfs_done(struct disk *dp)
   if(f->ffn) free(f->ffn);
   if(f->boot_sec) free(f->boot_sec);
   if(f->obj) free(f->obj);
+  if(f->clu_obj) free(f->clu_obj);
 
   free(dp->fatfs); dp->fatfs = NULL;
 }
@@ -341,21 +355,36 @@ void fatfs_done(struct disk *dp)
 
 /*
  * Returns # of read sectors, -1 = sector not found, -2 = read error.
+ *
+ * File data is read straight into DOS memory, one read per run of
+ * sectors belonging to the same file. Other sectors are generated
+ * into a local buffer and copied in runs of up to FATFS_RUN_SECS.
  */
+#define FATFS_RUN_SECS 16
 int fatfs_read(fatfs_t *f, unsigned buf, unsigned pos, int len)
 {
-  int i, l = len;
-  unsigned char b[0x200];
+  int i, n = 0, l = len;
+  unsigned char b[0x200 * FATFS_RUN_SECS];
 
   fatfs_deb("read: dir %s, sec %u, len %d\n", f->dir, pos, l);
 
   if(!f->ok) return -1;
 
   while(l) {
-    if((i = read_sec(f, pos, b))) return i;
-    MEMCPY_2DOS(buf, b, 0x200);
-    e_invalidate(buf, 0x200);
-    buf += 0x200; pos++; l--;
+    i = read_file_run(f, buf + (n << 9), pos + n, l - n);
+    if(i < 0) return i;
+    if(i == 0) {
+      if((i = read_sec(f, pos + n, b + (n << 9)))) return i;
+      n++;
+      if(n < FATFS_RUN_SECS && n < l) continue;
+      i = 0;
+    }
+    if(n) {
+      memcpy_2dos(buf, b, n << 9);
+      buf += n << 9; pos += n; l -= n;
+      n = 0;
+    }
+    buf += i << 9; pos += i; l -= i;
   }
 
   return len;
@@ -363,13 +392,31 @@ int fatfs_read(fatfs_t *f, unsigned buf, unsigned pos, int len)
 
 
 /*
- * Returns # of written sectors, -1 = sector not found, -2 = read error.
+ * Returns # of written sectors, -1 = sector not found, -2 = write error.
+ *
+ * Unless $_fatfs_write is on, the sectors are dropped. See wr_write_sec()
+ * for how they make it to the host directory otherwise.
  */
 int fatfs_write(fatfs_t *f, unsigned buf, unsigned pos, int len)
 {
-  error("fatfs write ignored: dir %s, sec %u, len %d\n", f->dir, pos, len);
+  unsigned char b[0x200];
+  int i;
+
+  if(!config.fatfs_write) {
+    error("fatfs write ignored: dir %s, sec %u, len %d\n", f->dir, pos, len);
+    return f->ok ? len : -1;
+  }
+
+  fatfs_deb("write: dir %s, sec %u, len %d\n", f->dir, pos, len);
 
   if(!f->ok) return -1;
+  if(!f->wr && !wr_init(f)) return -2;
+
+  wr_reap(f);
+  for(i = 0; i < len; i++) {
+    memcpy_2unix(b, buf + (i << 9), 0x200);
+    if(wr_write_sec(f, pos + i, b)) return i ? i : -1;
+  }
 
   return len;
 }
@@ -391,6 +438,8 @@ int read_sec(fatfs_t *f, unsigned pos, unsigned char *buf)
 {
   unsigned u0, u1;
 
+  if(f->wr && wr_override(f, pos)) return wr_read_sec(f, pos, buf);
+
   if(pos == 0) return read_boot(f, buf);
 
   u0 = f->reserved_secs;
@@ -1378,23 +1427,41 @@ unsigned make_dos_entry(fatfs_t *f, const obj_t *o, unsigned char **e)
 }
 
 
+/*
+ * Clusters are handed out in increasing order, so clu_obj[] is sorted
+ * by the start cluster and can be bisected.
+ */
 unsigned find_obj(fatfs_t *f, unsigned clu)
 {
-  unsigned u;
+  unsigned lo, hi, mid;
+  obj_t *o;
 
   if(clu >= f->first_free_cluster) return 0;
 
-  for(u = 0; u < f->objs; u++) {
-    if(
-      !f->obj[u].is.not_real &&
-      clu >= f->obj[u].start &&
-      clu < f->obj[u].start + f->obj[u].len
-    ) break;
+  lo = 0;
+  hi = f->clu_objs;
+  while(lo < hi) {
+    mid = (lo + hi) / 2;
+    if(f->obj[f->clu_obj[mid]].start <= clu)
+      lo = mid + 1;
+    else
+      hi = mid;
   }
+  if(lo == 0) return 0;
 
-  if(u == f->objs) return 0;
+  o = f->obj + f->clu_obj[lo - 1];
+  if(clu >= o->start + o->len) return 0;
 
-  return u;
+  return f->clu_obj[lo - 1];
+}
+
+static void add_clu_obj(fatfs_t *f, unsigned oi)
+{
+  if(f->clu_objs == f->alloc_clu_objs) {
+    f->alloc_clu_objs = f->alloc_clu_objs ? f->alloc_clu_objs * 2 : 256;
+    f->clu_obj = realloc(f->clu_obj, f->alloc_clu_objs * sizeof(*f->clu_obj));
+  }
+  f->clu_obj[f->clu_objs++] = oi;
 }
 
 
@@ -1429,6 +1496,8 @@ void assign_clusters(fatfs_t *f, unsigned max_clu, unsigned max_obj)
           free(f->obj[k].full_name);
       }
       f->objs = u;
+    } else if(f->obj[u].len) {
+      add_clu_obj(f, u);
     }
     fatfs_deb("assign_clusters: obj %u, start %u, len %u (%s)\n",
 	u, f->obj[u].start, f->obj[u].len, f->obj[u].name);
@@ -1472,13 +1541,7 @@ int read_file(fatfs_t *f, unsigned oi, unsigned clu, unsigned pos,
   char *s;
   off_t ofs;
 
-  if(f->fd_obj && oi != f->fd_obj) {
-     close(f->fd);
-     f->fd = -1;
-     f->fd_obj = 0;
-  }
-
-  fatfs_deb2("read_file: obj %u, cluster %u, sec %u%s\n", oi, clu, pos, f->fd_obj ? " (fd cached)" : "");
+  fatfs_deb2("read_file: obj %u, cluster %u, sec %u%s\n", oi, clu, pos, f->fd_obj == oi ? " (fd cached)" : "");
 
   if(clu && o->start == 0) return -1;
   if(clu < o->start) return -1;
@@ -1493,13 +1556,7 @@ int read_file(fatfs_t *f, unsigned oi, unsigned clu, unsigned pos,
   s = o->full_name;
   fatfs_deb2("going to read 0x200 bytes from file \"%s\", ofs 0x%x \n", s, pos);
 
-  if(f->fd_obj == 0) {
-    if((f->fd = open(s, O_RDONLY | O_CLOEXEC)) == -1) {
-      fatfs_deb("fatfs: open %s failed\n", s);
-      return -1;
-    }
-    f->fd_obj = oi;
-  }
+  if(open_obj(f, oi) == -1) return -1;
 
   if((ofs = lseek(f->fd, pos, SEEK_SET)) == -1) return -1;
 
@@ -1511,6 +1568,79 @@ int read_file(fatfs_t *f, unsigned oi, unsigned clu, unsigned pos,
 }
 
 
+static int open_obj(fatfs_t *f, unsigned oi)
+{
+  if(f->fd_obj == oi) return 0;
+
+  if(f->fd_obj) {
+     close(f->fd);
+     f->fd = -1;
+     f->fd_obj = 0;
+  }
+
+  if(f->wr) wr_wait_renames(f);
+  if((f->fd = open(f->obj[oi].full_name, O_RDONLY | O_CLOEXEC)) == -1) {
+    fatfs_deb("fatfs: open %s failed\n", f->obj[oi].full_name);
+    return -1;
+  }
+  f->fd_obj = oi;
+
+  return 0;
+}
+
+
+/*
+ * Read a run of data sectors starting at sector pos, as long as they
+ * belong to the same file. The objects occupy contiguous clusters, so
+ * this is a single read into DOS memory; the part past the end of the
+ * file is zeroed.
+ * Returns # of read sectors, 0 if pos is not in a file, -1 = sector
+ * not found, -2 = read error.
+ */
+int read_file_run(fatfs_t *f, unsigned buf, unsigned pos, unsigned cnt)
+{
+  unsigned data_start, sec, clu, oi, end, bytes, fbytes, i;
+  off_t ofs;
+  obj_t *o;
+  int ret;
+
+  data_start = f->reserved_secs + f->fat_secs * f->fats + f->root_secs;
+  if(pos < data_start || pos >= f->total_secs) return 0;
+  if(cnt > f->total_secs - pos) cnt = f->total_secs - pos;
+
+  sec = pos - data_start;
+  clu = sec / f->cluster_secs + 2;
+  if(!f->got_all_objs && clu >= f->first_free_cluster) assign_clusters(f, clu, 0);
+  if(!(oi = find_obj(f, clu)) || f->obj[oi].is.dir) return 0;
+  o = f->obj + oi;
+
+  end = (o->start + o->len - 2) * f->cluster_secs;
+  if(cnt > end - sec) cnt = end - sec;
+  if(f->wr) {
+    /* sectors DOS has written to come from the write support */
+    for(i = 0; i < cnt && !wr_override(f, pos + i); i++);
+    if(!(cnt = i)) return 0;
+  }
+  ofs = (off_t)(sec - (o->start - 2) * f->cluster_secs) << 9;
+  bytes = cnt << 9;
+  fbytes = ofs >= o->size ? 0 : _min(bytes, o->size - ofs);
+
+  fatfs_deb2("read_file_run: obj %u, cluster %u, %u secs, ofs 0x%llx\n",
+	oi, clu, cnt, (unsigned long long)ofs);
+
+  if(fbytes) {
+    if(open_obj(f, oi) == -1) return -1;
+    ret = dos_pread(f->fd, buf, fbytes, ofs);
+    if(ret == -1) return -2;
+    /* the file may have shrunk since scanned */
+    if(ret < fbytes) fbytes = ret;
+  }
+  if(fbytes < bytes) memset_dos(buf + fbytes, 0, bytes - fbytes);
+
+  return cnt;
+}
+
+
 /*
  * This function may fail if an directory entry is longer than
  * 512 bytes. This is currently, however, impossible as all entries
@@ -1600,6 +1730,1022 @@ unsigned next_cluster(fatfs_t *f, unsigned clu)
   return clu + 1;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*
+ * Write support.
+ *
+ * Every sector written by DOS goes to an in-memory overlay that takes
+ * precedence over the generated image. Data sectors that can be
+ * attributed to a host file are written back to it and dropped from the
+ * overlay once the write is done; the others stay until a directory
+ * update tells which file they belong to. Boot, FAT and directory sectors
+ * always stay in the overlay. Changes of the directory entries are turned
+ * into create/rename/resize operations on the host files. A deleted
+ * file is removed once its clusters are freed as well, so that a file
+ * moved with a delete-then-create sequence can still be recovered.
+ *
+ * Host operations are done in order by a separate thread. Entries with
+ * names DOS can't make are ignored, and every host path is checked to
+ * stay inside the shared directory. Creates and renames only replace
+ * host files that are in the image: any other file with that name (one
+ * the DOS name rules filtered out, say) is left alone, and the file
+ * DOS made stays in the overlay.
+ */
+#define WR_HASH 1024
+#define WR_NAME_LEN (12 * MB_LEN_MAX + 1)
+
+struct wr_sec {
+  unsigned pos;
+  unsigned pend;		/* host writes in flight */
+  unsigned resolved :1;		/* content queued for the host */
+  unsigned full :1;		/* ... and it was a complete sector */
+  unsigned parsed :1;		/* directory entries interpreted */
+  struct wr_sec *next;
+  unsigned char data[0x200];
+};
+
+struct wr_node {
+  char *path;
+  unsigned oi;			/* object index, if obj is set */
+  unsigned start, size;
+  unsigned obj :1;		/* comes from the scanned host directory */
+  unsigned dir :1;
+  unsigned deleted :1;
+  unsigned unlink :1;		/* remove the host file when done */
+  unsigned slots_init :1;
+  struct wr_node *parent;	/* directory the entry is in */
+  unsigned slot;		/* entry index in the directory */
+  struct wr_node **slots;	/* directories: node of each entry */
+  unsigned nslots;
+  struct wr_node *next;
+};
+
+struct wr_clu {
+  struct wr_node *node;
+  unsigned idx;			/* cluster index in the node's chain */
+  unsigned freed :1;
+};
+
+enum { WR_WRITE, WR_TRUNC, WR_CREAT, WR_MKDIR, WR_RENAME, WR_UNLINK,
+  WR_RMDIR };
+
+struct wr_op {
+  int type;
+  char *path, *path2;
+  off_t ofs;
+  unsigned len;
+  unsigned pos;			/* WR_WRITE: overlay sector */
+  unsigned replace :1;		/* WR_CREAT, WR_RENAME: target is ours */
+  unsigned failed :1;
+  struct wr_op *next;
+  unsigned char data[];
+};
+
+struct fatfs_wr {
+  struct wr_sec *sec[WR_HASH];
+  struct wr_node *nodes;
+  struct wr_node *root;
+  struct wr_clu *clu;
+  unsigned data_start;
+
+  int fd;			/* read cache */
+  struct wr_node *fd_node;
+
+  unsigned char fat_buf[0x200];	/* generated FAT sector */
+  int fat_pos;
+
+  char *root_real;		/* realpath() of the shared directory */
+  unsigned renames;		/* queued renames not reaped yet */
+  char **busy;			/* write thread: host files it kept */
+  unsigned nbusy;
+
+  pthread_t thr;
+  pthread_mutex_t mtx;
+  pthread_cond_t cnd;
+  struct wr_op *head, *tail, *done;
+  int quit;
+};
+
+static void *wr_thread(void *arg);
+static int wr_known_path(fatfs_t *f, const char *path);
+
+static struct wr_sec *wr_sec_find(fatfs_t *f, unsigned pos)
+{
+  struct wr_sec *s;
+
+  for(s = f->wr->sec[pos % WR_HASH]; s; s = s->next)
+    if(s->pos == pos) return s;
+  return NULL;
+}
+
+static struct wr_sec *wr_sec_get(fatfs_t *f, unsigned pos)
+{
+  struct wr_sec *s = wr_sec_find(f, pos);
+
+  if(s) return s;
+  s = calloc(1, sizeof(*s));
+  s->pos = pos;
+  s->next = f->wr->sec[pos % WR_HASH];
+  f->wr->sec[pos % WR_HASH] = s;
+  return s;
+}
+
+static void wr_sec_drop(fatfs_t *f, struct wr_sec *s)
+{
+  struct wr_sec **p = &f->wr->sec[s->pos % WR_HASH];
+
+  while(*p != s) p = &(*p)->next;
+  *p = s->next;
+  free(s);
+}
+
+/* both FAT copies are kept in the sectors of the first one */
+static unsigned wr_key(fatfs_t *f, unsigned pos)
+{
+  unsigned u0 = f->reserved_secs;
+
+  if(pos >= u0 && pos < u0 + f->fat_secs * f->fats)
+    return u0 + (pos - u0) % f->fat_secs;
+  return pos;
+}
+
+static void wr_queue(fatfs_t *f, int type, const char *path,
+	const char *path2, off_t ofs, unsigned len, const struct wr_sec *s)
+{
+  struct fatfs_wr *w = f->wr;
+  struct wr_op *op = malloc(sizeof(*op) + (s ? len : 0));
+
+  op->type = type;
+  op->path = strdup(path);
+  op->path2 = path2 ? strdup(path2) : NULL;
+  op->ofs = ofs;
+  op->len = len;
+  op->pos = s ? s->pos : 0;
+  op->replace = (type == WR_CREAT || type == WR_RENAME) &&
+	wr_known_path(f, path2 ? path2 : path);
+  op->failed = 0;
+  op->next = NULL;
+  if(s) memcpy(op->data, s->data, len);
+  if(type == WR_RENAME) w->renames++;
+
+  pthread_mutex_lock(&w->mtx);
+  if(w->tail) w->tail->next = op;
+  else w->head = op;
+  w->tail = op;
+  pthread_cond_signal(&w->cnd);
+  pthread_mutex_unlock(&w->mtx);
+}
+
+static void wr_reap(fatfs_t *f)
+{
+  struct fatfs_wr *w = f->wr;
+  struct wr_op *op, *next;
+  struct wr_sec *s;
+
+  pthread_mutex_lock(&w->mtx);
+  op = w->done;
+  w->done = NULL;
+  pthread_mutex_unlock(&w->mtx);
+
+  for(; op; op = next) {
+    next = op->next;
+    if(op->type == WR_WRITE && (s = wr_sec_find(f, op->pos))) {
+      s->pend--;
+      /* the host doesn't have it, keep serving it from memory */
+      if(op->failed) s->full = 0;
+      if(!s->pend && s->resolved && s->full) wr_sec_drop(f, s);
+    }
+    if(op->type == WR_RENAME) w->renames--;
+    free(op->path);
+    free(op->path2);
+    free(op);
+  }
+}
+
+/* wait for the host to catch up */
+static void wr_wait(fatfs_t *f)
+{
+  struct fatfs_wr *w = f->wr;
+
+  pthread_mutex_lock(&w->mtx);
+  while(w->head) pthread_cond_wait(&w->cnd, &w->mtx);
+  pthread_mutex_unlock(&w->mtx);
+  wr_reap(f);
+}
+
+/* the paths are the new ones as soon as a rename is queued */
+void wr_wait_renames(fatfs_t *f)
+{
+  if(f->wr->renames) wr_wait(f);
+}
+
+static char *wr_join(const char *dir, const char *name)
+{
+  size_t l = strlen(dir);
+  char *s = malloc(l + 1 + strlen(name) + 1);
+
+  strcpy(s, dir);
+  if(!l || dir[l - 1] != '/') s[l++] = '/';
+  strcpy(s + l, name);
+  return s;
+}
+
+static struct wr_node *wr_node_new(fatfs_t *f, const char *path)
+{
+  struct wr_node *n = calloc(1, sizeof(*n));
+
+  n->path = strdup(path);
+  n->next = f->wr->nodes;
+  f->wr->nodes = n;
+  return n;
+}
+
+static struct wr_node *wr_obj_node(fatfs_t *f, unsigned oi)
+{
+  obj_t *o = f->obj + oi;
+  struct wr_node *n;
+
+  if(o->wn) return o->wn;
+  n = wr_node_new(f, o->full_name);
+  n->obj = 1;
+  n->oi = oi;
+  n->dir = o->is.dir;
+  n->start = o->start;
+  n->size = o->is.dir ? 0 : o->size;
+  o->wn = n;
+  return n;
+}
+
+static void wr_slot_set(struct wr_node *d, unsigned slot, struct wr_node *n)
+{
+  if(slot >= d->nslots) {
+    unsigned ns = d->nslots ? d->nslots : 16;
+    while(ns <= slot) ns *= 2;
+    d->slots = realloc(d->slots, ns * sizeof(*d->slots));
+    memset(d->slots + d->nslots, 0, (ns - d->nslots) * sizeof(*d->slots));
+    d->nslots = ns;
+  }
+  d->slots[slot] = n;
+  if(n) {
+    n->parent = d;
+    n->slot = slot;
+  }
+}
+
+/* the entries of a scanned directory are its child objects, in order */
+static void wr_dir_slots(fatfs_t *f, struct wr_node *d)
+{
+  unsigned i, k;
+  obj_t *o;
+
+  if(d->slots_init) return;
+  d->slots_init = 1;
+  if(!d->obj || !f->obj[d->oi].first_child) return;
+
+  for(i = f->obj[d->oi].first_child, k = 0;
+      i < f->objs && f->obj[i].parent == d->oi; i++, k++) {
+    o = f->obj + i;
+    if(o->is.this_dir || o->is.parent_dir || o->is.label) continue;
+    wr_slot_set(d, k, wr_obj_node(f, i));
+  }
+}
+
+static unsigned wr_fat_byte(fatfs_t *f, unsigned ofs)
+{
+  struct fatfs_wr *w = f->wr;
+  unsigned sec = ofs >> 9;
+  struct wr_sec *s = wr_sec_find(f, f->reserved_secs + sec);
+
+  if(s) return s->data[ofs & 0x1ff];
+  if(w->fat_pos != sec) {
+    read_fat(f, sec, w->fat_buf);
+    w->fat_pos = sec;
+  }
+  return w->fat_buf[ofs & 0x1ff];
+}
+
+static unsigned wr_fat_get(fatfs_t *f, unsigned clu)
+{
+  unsigned u;
+
+  if(f->fat_type == FAT_TYPE_FAT12) {
+    u = clu * 3 / 2;
+    u = wr_fat_byte(f, u) | (wr_fat_byte(f, u + 1) << 8);
+    return (clu & 1) ? u >> 4 : u & 0xfff;
+  }
+  return wr_fat_byte(f, clu * 2) | (wr_fat_byte(f, clu * 2 + 1) << 8);
+}
+
+static int wr_chain_end(fatfs_t *f, unsigned clu)
+{
+  if(clu < 2 || clu > f->last_cluster) return 1;
+  return f->fat_type == FAT_TYPE_FAT12 ? clu >= 0xff8 : clu >= 0xfff8;
+}
+
+static int entry_live(const unsigned char *e)
+{
+  return e[0] != 0 && e[0] != 0xe5 && e[0] != '.' &&
+	e[0x0b] != 0x0f && !(e[0x0b] & 0x08);
+}
+
+static unsigned entry_start(const unsigned char *e)
+{
+  return e[0x1a] | (e[0x1b] << 8);
+}
+
+static unsigned entry_size(const unsigned char *e)
+{
+  return e[0x1c] | (e[0x1d] << 8) | (e[0x1e] << 16) | ((unsigned)e[0x1f] << 24);
+}
+
+/* DOS never makes such names, and some would leave the directory */
+static int entry_name_ok(const unsigned char *e)
+{
+  int i;
+
+  if(e[0] == ' ') return 0;
+  for(i = 0; i < 11; i++) {
+    if(i == 0 && e[i] == 0x05) continue;
+    if(e[i] < 0x20 || e[i] == 0x7f || strchr("\"*+,./:;<=>?[\\]|", e[i]))
+      return 0;
+  }
+  return 1;
+}
+
+/* lower-cased host name of the 8.3 entry */
+static void entry_host_name(const unsigned char *e, char *s)
+{
+  mbstate_t st;
+  char name[8 + 1 + 3 + 1];
+  int i, j = 0;
+  size_t l;
+
+  for(i = 0; i < 8 && e[i] != ' '; i++)
+    name[j++] = (i == 0 && e[i] == 0x05) ? 0xe5 : e[i];
+  if(e[8] != ' ') {
+    name[j++] = '.';
+    for(i = 8; i < 11 && e[i] != ' '; i++)
+      name[j++] = e[i];
+  }
+  name[j] = 0;
+
+  memset(&st, 0, sizeof(st));
+  for(i = 0; name[i]; i++) {
+    l = wcrtomb(s, dos_to_unicode_table[(unsigned char)tolowerDOS(name[i])],
+	&st);
+    if(l == (size_t)-1) *s++ = '_';
+    else s += l;
+  }
+  *s = 0;
+}
+
+/* the path belongs to a file of the image or one DOS made */
+int wr_known_path(fatfs_t *f, const char *path)
+{
+  struct wr_node *n;
+  unsigned u;
+
+  for(n = f->wr->nodes; n; n = n->next)
+    if(!strcmp(n->path, path)) return 1;
+  for(u = 1; u < f->objs; u++)
+    if(f->obj[u].full_name && !strcmp(f->obj[u].full_name, path)) return 1;
+  return 0;
+}
+
+static void wr_cancel_unlink(fatfs_t *f, const char *path)
+{
+  struct wr_node *n;
+
+  for(n = f->wr->nodes; n; n = n->next)
+    if(n->unlink && !strcmp(n->path, path)) n->unlink = 0;
+}
+
+/* fix the paths of a renamed node and of everything below it */
+static void wr_rename_paths(fatfs_t *f, const char *old, const char *new)
+{
+  size_t l = strlen(old);
+  struct wr_node *n;
+  unsigned u;
+  char *s;
+
+  for(n = f->wr->nodes; n; n = n->next) {
+    if(strncmp(n->path, old, l) || (n->path[l] && n->path[l] != '/'))
+      continue;
+    s = malloc(strlen(new) + strlen(n->path + l) + 1);
+    strcpy(s, new);
+    strcat(s, n->path + l);
+    free(n->path);
+    n->path = s;
+  }
+  for(u = 1; u < f->objs; u++) {
+    char *p = f->obj[u].full_name;
+    if(!p || strncmp(p, old, l) || (p[l] && p[l] != '/'))
+      continue;
+    s = malloc(strlen(new) + strlen(p + l) + 1);
+    strcpy(s, new);
+    strcat(s, p + l);
+    free(p);
+    f->obj[u].full_name = s;
+  }
+  f->ffn_obj = 1;
+}
+
+static void wr_queue_data(fatfs_t *f, struct wr_node *n, struct wr_sec *s,
+	unsigned ofs)
+{
+  unsigned len;
+
+  if(ofs >= n->size) return;
+  len = _min(0x200, n->size - ofs);
+  wr_queue(f, WR_WRITE, n->path, NULL, ofs, len, s);
+  s->pend++;
+  s->resolved = 1;
+  s->full = (len == 0x200);
+}
+
+static void wr_parse_dir(fatfs_t *f, struct wr_node *d, unsigned sec,
+	const unsigned char *old, const unsigned char *new);
+
+/* tie the clusters of the node to it and flush what DOS wrote there */
+static void wr_sync(fatfs_t *f, struct wr_node *n)
+{
+  struct fatfs_wr *w = f->wr;
+  unsigned clu, idx, s, cnt, bytes = f->cluster_secs << 9;
+  unsigned char buf[0x200];
+  struct wr_sec *sec;
+
+  if(!n->start) return;
+  cnt = n->dir ? f->last_cluster : (n->size + bytes - 1) / bytes;
+  for(clu = n->start, idx = 0; idx < cnt; idx++) {
+    w->clu[clu].node = n;
+    w->clu[clu].idx = idx;
+    w->clu[clu].freed = 0;
+    for(s = 0; s < f->cluster_secs; s++) {
+      sec = wr_sec_find(f, w->data_start + (clu - 2) * f->cluster_secs + s);
+      if(!sec) continue;
+      if(n->dir) {
+        if(sec->parsed) continue;
+        memset(buf, 0, sizeof(buf));
+        if(n->obj && clu >= f->obj[n->oi].start &&
+            clu < f->obj[n->oi].start + f->obj[n->oi].len)
+          read_dir(f, n->oi, clu, s, buf);
+        sec->parsed = 1;
+        wr_parse_dir(f, n, idx * f->cluster_secs + s, buf, sec->data);
+      } else if(!sec->resolved || !sec->full) {
+        /* a partial sector may have grown with the file */
+        wr_queue_data(f, n, sec, (idx * f->cluster_secs + s) << 9);
+      }
+    }
+    clu = wr_fat_get(f, clu);
+    if(wr_chain_end(f, clu)) break;
+  }
+}
+
+static void wr_update(fatfs_t *f, struct wr_node *n, const unsigned char *e,
+	int renamed)
+{
+  char name[WR_NAME_LEN], *path;
+  unsigned size;
+
+  if(renamed) {
+    entry_host_name(e, name);
+    path = wr_join(n->parent->path, name);
+    fatfs_deb("write: rename %s -> %s\n", n->path, path);
+    wr_queue(f, WR_RENAME, n->path, path, 0, 0, NULL);
+    wr_cancel_unlink(f, path);
+    wr_rename_paths(f, n->path, path);
+    free(path);
+  }
+  n->start = entry_start(e);
+  if(!n->dir) {
+    size = entry_size(e);
+    if(size != n->size) {
+      fatfs_deb("write: resize %s, %u -> %u\n", n->path, n->size, size);
+      n->size = size;
+      if(n->obj) f->obj[n->oi].size = size;
+      wr_queue(f, WR_TRUNC, n->path, NULL, size, 0, NULL);
+    }
+  }
+  wr_sync(f, n);
+}
+
+/* remove the deleted node once DOS freed its clusters too */
+static void wr_try_unlink(fatfs_t *f, struct wr_node *n)
+{
+  if(!n->unlink) return;
+  if(n->start >= 2 && n->start <= f->last_cluster &&
+      !f->wr->clu[n->start].freed)
+    return;
+  fatfs_deb("write: remove %s\n", n->path);
+  wr_queue(f, n->dir ? WR_RMDIR : WR_UNLINK, n->path, NULL, 0, 0, NULL);
+  n->unlink = 0;
+}
+
+static void wr_delete(fatfs_t *f, struct wr_node *n)
+{
+  fatfs_deb("write: delete %s\n", n->path);
+  n->deleted = 1;
+  n->unlink = 1;
+  wr_try_unlink(f, n);
+}
+
+/* a non-empty entry with this start cluster can only be a moved one */
+static struct wr_node *wr_find_start(fatfs_t *f, unsigned start)
+{
+  struct wr_clu *c;
+  unsigned oi;
+
+  if(start < 2 || start > f->last_cluster) return NULL;
+  c = &f->wr->clu[start];
+  if(c->freed) return NULL;
+  if(c->node) return c->idx == 0 ? c->node : NULL;
+  oi = find_obj(f, start);
+  if(!oi || f->obj[oi].start != start || wr_obj_node(f, oi)->start != start)
+    return NULL;
+  return f->obj[oi].wn;
+}
+
+static void wr_entry(fatfs_t *f, struct wr_node *d, unsigned slot,
+	const unsigned char *oe, const unsigned char *ne)
+{
+  struct wr_node *n = slot < d->nslots ? d->slots[slot] : NULL;
+  int own = n && n->parent == d && n->slot == slot && entry_live(oe);
+  char name[WR_NAME_LEN], *path;
+  int live = entry_live(ne);
+
+  if(live && !entry_name_ok(ne)) {
+    error("fatfs: ignoring the bad name in entry %u of %s\n", slot, d->path);
+    live = 0;
+  }
+  if(own && live && (!memcmp(oe, ne, 11) ||
+      (entry_start(oe) && entry_start(oe) == entry_start(ne)))) {
+    wr_update(f, n, ne, memcmp(oe, ne, 11) != 0);
+    return;
+  }
+  if(own) wr_delete(f, n);
+  if(n) wr_slot_set(d, slot, NULL);
+  if(!live) return;
+
+  entry_host_name(ne, name);
+  path = wr_join(d->path, name);
+  n = wr_find_start(f, entry_start(ne));
+  if(n && n != d) {
+    fatfs_deb("write: move %s -> %s\n", n->path, path);
+    wr_queue(f, WR_RENAME, n->path, path, 0, 0, NULL);
+    wr_rename_paths(f, n->path, path);
+    n->deleted = n->unlink = 0;
+  } else {
+    int dir = !!(ne[0x0b] & 0x10);
+    fatfs_deb("write: create %s %s\n", dir ? "dir" : "file", path);
+    wr_queue(f, dir ? WR_MKDIR : WR_CREAT, path, NULL, 0, 0, NULL);
+    n = wr_node_new(f, path);
+    n->dir = dir;
+    n->slots_init = 1;
+  }
+  wr_cancel_unlink(f, path);
+  free(path);
+  wr_slot_set(d, slot, n);
+  wr_update(f, n, ne, 0);
+}
+
+void wr_parse_dir(fatfs_t *f, struct wr_node *d, unsigned sec,
+	const unsigned char *old, const unsigned char *new)
+{
+  unsigned k;
+
+  wr_dir_slots(f, d);
+  for(k = 0; k < 0x200 / 0x20; k++) {
+    if(memcmp(old + k * 0x20, new + k * 0x20, 0x20))
+      wr_entry(f, d, sec * 0x10 + k, old + k * 0x20, new + k * 0x20);
+  }
+}
+
+/* node owning the data cluster, NULL if DOS didn't tell yet */
+static struct wr_node *wr_data_node(fatfs_t *f, unsigned clu, unsigned *idx)
+{
+  struct wr_clu *c = &f->wr->clu[clu];
+  struct wr_node *n;
+  unsigned oi;
+
+  if(c->freed) return NULL;
+  if(!c->node) {
+    if(!(oi = find_obj(f, clu))) return NULL;
+    n = wr_obj_node(f, oi);
+    if(n->start != f->obj[oi].start) return NULL;
+    c->node = n;
+    c->idx = clu - n->start;
+  }
+  if(c->node->deleted) return NULL;
+  *idx = c->idx;
+  return c->node;
+}
+
+static void wr_write_fat(fatfs_t *f, unsigned pos, const unsigned char *buf)
+{
+  unsigned sec = pos - f->reserved_secs, c0, c1, c;
+  unsigned old[0x200];
+  struct wr_node *n;
+  int freed = 0;
+
+  if(f->fat_type == FAT_TYPE_FAT12) {
+    c0 = sec * 0x400 / 3;
+    c0 = c0 ? c0 - 1 : 0;
+    c1 = (sec + 1) * 0x400 / 3 + 1;
+  } else {
+    c0 = sec * 0x100;
+    c1 = c0 + 0x100;
+  }
+  if(c0 < 2) c0 = 2;
+  if(c1 > f->last_cluster + 1) c1 = f->last_cluster + 1;
+
+  for(c = c0; c < c1; c++)
+    old[c - c0] = wr_fat_get(f, c);
+  memcpy(wr_sec_get(f, pos)->data, buf, 0x200);
+  for(c = c0; c < c1; c++) {
+    if(old[c - c0] && !wr_fat_get(f, c)) {
+      f->wr->clu[c].freed = 1;
+      f->wr->clu[c].node = NULL;
+      freed++;
+    }
+  }
+  if(freed) {
+    for(n = f->wr->nodes; n; n = n->next)
+      wr_try_unlink(f, n);
+  }
+}
+
+static int wr_write_sec(fatfs_t *f, unsigned pos, const unsigned char *buf)
+{
+  struct fatfs_wr *w = f->wr;
+  unsigned char old[0x200];
+  struct wr_node *n;
+  struct wr_sec *s;
+  unsigned clu, sec, idx;
+
+  if(pos >= f->total_secs) return -1;
+  pos = wr_key(f, pos);
+
+  if(pos >= f->reserved_secs && pos < f->reserved_secs + f->fat_secs) {
+    wr_write_fat(f, pos, buf);
+    return 0;
+  }
+
+  if(pos >= w->data_start - f->root_secs && pos < w->data_start) {
+    sec = pos - (w->data_start - f->root_secs);
+    s = wr_sec_get(f, pos);
+    if(s->parsed) memcpy(old, s->data, 0x200);
+    else read_root(f, sec, old);
+    memcpy(s->data, buf, 0x200);
+    s->parsed = 1;
+    wr_parse_dir(f, w->root, sec, old, buf);
+    return 0;
+  }
+
+  s = wr_sec_get(f, pos);
+  if(pos < w->data_start) {
+    memcpy(s->data, buf, 0x200);
+    return 0;
+  }
+
+  clu = (pos - w->data_start) / f->cluster_secs + 2;
+  sec = (pos - w->data_start) % f->cluster_secs;
+  n = wr_data_node(f, clu, &idx);
+  if(n && n->dir) {
+    memset(old, 0, sizeof(old));
+    if(s->parsed) memcpy(old, s->data, 0x200);
+    else if(n->obj && clu - f->obj[n->oi].start < f->obj[n->oi].len)
+      read_dir(f, n->oi, clu, sec, old);
+    memcpy(s->data, buf, 0x200);
+    s->parsed = 1;
+    wr_parse_dir(f, n, idx * f->cluster_secs + sec, old, buf);
+    return 0;
+  }
+
+  memcpy(s->data, buf, 0x200);
+  s->resolved = 0;
+  s->parsed = 0;
+  if(n) wr_queue_data(f, n, s, (idx * f->cluster_secs + sec) << 9);
+  return 0;
+}
+
+/* sector whose content comes from the write support rather than the image */
+static int wr_override(fatfs_t *f, unsigned pos)
+{
+  struct fatfs_wr *w = f->wr;
+  struct wr_clu *c;
+
+  if(wr_sec_find(f, wr_key(f, pos))) return 1;
+  if(pos < w->data_start || pos >= f->total_secs) return 0;
+  c = &w->clu[(pos - w->data_start) / f->cluster_secs + 2];
+  return !c->freed && c->node && !c->node->dir;
+}
+
+static int wr_read_sec(fatfs_t *f, unsigned pos, unsigned char *buf)
+{
+  struct fatfs_wr *w = f->wr;
+  struct wr_sec *s = wr_sec_find(f, wr_key(f, pos));
+  struct wr_clu *c;
+  unsigned ofs;
+  int ret;
+
+  if(s) {
+    memcpy(buf, s->data, 0x200);
+    return 0;
+  }
+  c = &w->clu[(pos - w->data_start) / f->cluster_secs + 2];
+  ofs = (c->idx * f->cluster_secs + (pos - w->data_start) % f->cluster_secs) << 9;
+  memset(buf, 0, 0x200);
+  if(ofs >= c->node->size) return 0;
+
+  if(w->fd_node != c->node) {
+    if(w->fd != -1) close(w->fd);
+    /* the file may not be there until the queued renames are done */
+    wr_wait(f);
+    w->fd_node = c->node;
+    if((w->fd = open(c->node->path, O_RDONLY | O_CLOEXEC)) == -1) {
+      fatfs_deb("fatfs: open %s failed\n", c->node->path);
+      w->fd_node = NULL;
+      return -2;
+    }
+  }
+  ret = pread(w->fd, buf, _min(0x200, c->node->size - ofs), ofs);
+  return ret == -1 ? -2 : 0;
+}
+
+static int wr_init(fatfs_t *f)
+{
+  struct fatfs_wr *w;
+
+  /* everything has to have its clusters before DOS allocates any */
+  while(!f->got_all_objs) assign_clusters(f, f->last_cluster, f->objs);
+
+  w = calloc(1, sizeof(*w));
+  w->clu = calloc(f->last_cluster + 1, sizeof(*w->clu));
+  w->data_start = f->reserved_secs + f->fat_secs * f->fats + f->root_secs;
+  w->fd = -1;
+  w->fat_pos = -1;
+  w->root_real = realpath(f->dir, NULL);
+  if(!w->root_real) {
+    error("fatfs: can't resolve %s: %s\n", f->dir, strerror(errno));
+    free(w->clu);
+    free(w);
+    return 0;
+  }
+  pthread_mutex_init(&w->mtx, NULL);
+  pthread_cond_init(&w->cnd, NULL);
+  f->wr = w;
+  w->root = wr_obj_node(f, 0);
+
+  if(pthread_create(&w->thr, NULL, wr_thread, w)) {
+    error("fatfs: can't create write thread for %s\n", f->dir);
+    f->wr = NULL;
+    free(w->root_real);
+    free(w->clu);
+    free(w);
+    return 0;
+  }
+#if defined(HAVE_PTHREAD_SETNAME_NP) && defined(__GLIBC__)
+  pthread_setname_np(w->thr, "dosemu: fatfs");
+#endif
+  fatfs_msg("write support enabled for %s\n", f->dir);
+  return 1;
+}
+
+static int wr_under(const char *root, const char *path)
+{
+  size_t l = strlen(root);
+
+  if(l == 1 && root[0] == '/') return 1;
+  return !strncmp(path, root, l) && (!path[l] || path[l] == '/');
+}
+
+/*
+ * The host path must stay inside the shared directory, also through
+ * symlinks. follow: the operation follows a symlink in the last part.
+ */
+static int wr_path_ok(const char *root, const char *path, int follow)
+{
+  char *dir = strdup(path), *p, *real;
+  int ok = 0;
+
+  p = strrchr(dir, '/');
+  if(p && p[1] && strcmp(p + 1, ".") && strcmp(p + 1, "..")) {
+    if(p == dir) p++;
+    *p = 0;
+    real = realpath(dir, NULL);
+    ok = real && wr_under(root, real);
+    free(real);
+  }
+  free(dir);
+  if(ok && follow) {
+    real = realpath(path, NULL);
+    if(real) ok = wr_under(root, real);
+    else ok = (errno == ENOENT);
+    free(real);
+  }
+  return ok;
+}
+
+/* host files the write thread didn't replace, DOS's version is in memory */
+static int wr_busy_find(struct fatfs_wr *w, const char *path)
+{
+  unsigned u;
+
+  for(u = 0; u < w->nbusy; u++)
+    if(!strcmp(w->busy[u], path)) return u;
+  return -1;
+}
+
+static void wr_busy_add(struct fatfs_wr *w, const char *path)
+{
+  w->busy = realloc(w->busy, (w->nbusy + 1) * sizeof(*w->busy));
+  w->busy[w->nbusy++] = strdup(path);
+}
+
+static void wr_busy_del(struct fatfs_wr *w, int i)
+{
+  free(w->busy[i]);
+  w->busy[i] = w->busy[--w->nbusy];
+}
+
+static void wr_done(fatfs_t *f)
+{
+  struct fatfs_wr *w = f->wr;
+  struct wr_node *n, *next;
+  struct wr_sec *s, *snext;
+  int i, dirs;
+
+  pthread_mutex_lock(&w->mtx);
+  w->quit = 1;
+  pthread_cond_signal(&w->cnd);
+  pthread_mutex_unlock(&w->mtx);
+  pthread_join(w->thr, NULL);
+  wr_reap(f);
+
+  /* files first, then the directories from the deepest one */
+  for(dirs = 0; dirs < 2; dirs++) {
+    do {
+      struct wr_node *m = NULL;
+      for(n = w->nodes; n; n = n->next) {
+        if(n->unlink && n->dir == dirs &&
+            (!m || strlen(n->path) > strlen(m->path)))
+          m = n;
+      }
+      if(!m) break;
+      fatfs_deb("write: remove %s\n", m->path);
+      if(!wr_path_ok(w->root_real, m->path, 0))
+        error("fatfs: %s is outside of %s\n", m->path, w->root_real);
+      else if(wr_busy_find(w, m->path) != -1)
+        fatfs_deb("write: skip %s\n", m->path);
+      else if((dirs ? rmdir(m->path) : unlink(m->path)) == -1)
+        fatfs_msg("remove %s failed: %s\n", m->path, strerror(errno));
+      m->unlink = 0;
+    } while(1);
+  }
+
+  for(n = w->nodes; n; n = next) {
+    next = n->next;
+    if(n->obj) f->obj[n->oi].wn = NULL;
+    free(n->path);
+    free(n->slots);
+    free(n);
+  }
+  for(i = 0; i < WR_HASH; i++) {
+    for(s = w->sec[i]; s; s = snext) {
+      snext = s->next;
+      free(s);
+    }
+  }
+  for(i = 0; i < w->nbusy; i++) free(w->busy[i]);
+  free(w->busy);
+  if(w->fd != -1) close(w->fd);
+  pthread_mutex_destroy(&w->mtx);
+  pthread_cond_destroy(&w->cnd);
+  free(w->root_real);
+  free(w->clu);
+  free(w);
+  f->wr = NULL;
+}
+
+static void wr_do_op(struct fatfs_wr *w, struct wr_op *op, int *fd,
+	char **fd_path)
+{
+  int ret = 0, tfd, busy;
+  /* unlink, rename and mkdir don't follow a symlink in the last part */
+  int follow = (op->type == WR_WRITE || op->type == WR_TRUNC ||
+	op->type == WR_CREAT);
+
+  if(op->type != WR_WRITE && *fd != -1) {
+    close(*fd);
+    *fd = -1;
+  }
+  if(!wr_path_ok(w->root_real, op->path, follow) ||
+      (op->path2 && !wr_path_ok(w->root_real, op->path2, 0))) {
+    error("fatfs: %s is outside of %s\n",
+	wr_path_ok(w->root_real, op->path, follow) ? op->path2 : op->path,
+	w->root_real);
+    op->failed = 1;
+    return;
+  }
+  /* the path is someone else's file: leave it be */
+  if((busy = wr_busy_find(w, op->path)) != -1) {
+    fatfs_deb("write: skip %s\n", op->path);
+    if(op->type == WR_UNLINK || op->type == WR_RMDIR)
+      wr_busy_del(w, busy);
+    else if(op->type == WR_RENAME) {
+      wr_busy_del(w, busy);
+      wr_busy_add(w, op->path2);
+    }
+    op->failed = 1;
+    return;
+  }
+  switch(op->type) {
+  case WR_WRITE:
+    if(*fd == -1 || strcmp(*fd_path, op->path)) {
+      if(*fd != -1) close(*fd);
+      free(*fd_path);
+      *fd_path = strdup(op->path);
+      *fd = open(op->path, O_WRONLY | O_CLOEXEC);
+    }
+    if(*fd == -1) ret = -1;
+    else if(pwrite(*fd, op->data, op->len, op->ofs) != op->len) ret = -1;
+    break;
+  case WR_TRUNC:
+    ret = truncate(op->path, op->ofs);
+    break;
+  case WR_CREAT:
+    tfd = open(op->path, O_WRONLY | O_CREAT | O_CLOEXEC |
+	(op->replace ? O_TRUNC : O_EXCL), 0666);
+    if(tfd == -1) ret = -1;
+    else close(tfd);
+    break;
+  case WR_MKDIR:
+    ret = mkdir(op->path, 0777);
+    if(ret == -1 && errno == EEXIST) ret = 0;
+    break;
+  case WR_RENAME:
+    if(op->replace)
+      ret = rename(op->path, op->path2);
+    else {
+      struct stat st;
+      ret = renameat2(AT_FDCWD, op->path, AT_FDCWD, op->path2,
+	RENAME_NOREPLACE);
+      /* not every file system has it */
+      if(ret == -1 && (errno == EINVAL || errno == ENOSYS)) {
+        if(lstat(op->path2, &st) == 0) errno = EEXIST;
+        else ret = rename(op->path, op->path2);
+      }
+    }
+    break;
+  case WR_UNLINK:
+    ret = unlink(op->path);
+    break;
+  case WR_RMDIR:
+    ret = rmdir(op->path);
+    break;
+  }
+  if(ret == -1 && errno == EEXIST &&
+      (op->type == WR_CREAT || op->type == WR_RENAME)) {
+    error("fatfs: %s exists and is not in the image, not replaced\n",
+	op->path2 ? op->path2 : op->path);
+    wr_busy_add(w, op->path2 ? op->path2 : op->path);
+    op->failed = 1;
+  } else if(ret == -1) {
+    error("fatfs: %s %s failed: %s\n",
+	op->type == WR_RENAME ? "rename" :
+	op->type == WR_UNLINK || op->type == WR_RMDIR ? "remove" : "write to",
+	op->path, strerror(errno));
+    op->failed = 1;
+  }
+}
+
+void *wr_thread(void *arg)
+{
+  struct fatfs_wr *w = arg;
+  struct wr_op *op;
+  char *fd_path = NULL;
+  int fd = -1;
+
+  pthread_mutex_lock(&w->mtx);
+  while(1) {
+    while(!w->head && !w->quit) pthread_cond_wait(&w->cnd, &w->mtx);
+    if(!(op = w->head)) break;
+    pthread_mutex_unlock(&w->mtx);
+    wr_do_op(w, op, &fd, &fd_path);
+    pthread_mutex_lock(&w->mtx);
+    w->head = op->next;
+    if(!w->head) w->tail = NULL;
+    op->next = w->done;
+    w->done = op;
+    pthread_cond_broadcast(&w->cnd);
+  }
+  pthread_mutex_unlock(&w->mtx);
+  if(fd != -1) close(fd);
+  free(fd_path);
+  return NULL;
+}
+
+
 /*
  * This will be called by dos_helper (base/async/int.c)
  * when the bootsector is executed.
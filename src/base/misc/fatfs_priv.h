@@ -30,6 +30,7 @@ typedef struct {
   char *name;
   char *full_name;
   unsigned dos_dir_size;		/* size of the dos directory entry */
+  struct wr_node *wn;			/* write support state */
 } obj_t;
 
 enum { FAT_TYPE_NONE, FAT_TYPE_FAT12, FAT_TYPE_FAT16, FAT_TYPE_FAT32 };
@@ -59,6 +60,9 @@ struct fatfs_s {
   unsigned sys_objs;
   obj_t *obj;
 
+  unsigned clu_objs, alloc_clu_objs;
+  unsigned *clu_obj;			/* objects with clusters, by start */
+
   char *ffn, *ffn_ptr;			/* buffer for file names */
   unsigned ffn_obj;
 
@@ -67,6 +71,8 @@ struct fatfs_s {
   int fd;
   unsigned fd_obj;
 
+  struct fatfs_wr *wr;			/* write support, see fatfs_write() */
+
   int sys_found[MAX_SYS_IDX];
   struct sys_dsc sfiles[MAX_SYS_IDX];
 };
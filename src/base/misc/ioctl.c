@@ -14,6 +14,9 @@
 #include <sys/wait.h>
 #include <limits.h>
 #include <assert.h>
+#include <inttypes.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 #include <sys/socket.h>
 #include <sys/ioctl.h>
@@ -36,6 +39,7 @@
 #include "pic.h"
 #include "emudpmi.h"
 #include "ioselect.h"
+#include "utilities.h"
 
 #ifdef USE_MHPDBG
   #include "mhpdbg.h"
@@ -53,11 +57,20 @@ struct io_callback_s {
   int fd;
   unsigned flags;
 };
-#define MAX_FD FD_SETSIZE
-static struct io_callback_s io_callback_func[MAX_FD];
-static struct io_callback_s io_callback_stash[MAX_FD];
-static fd_set fds_sigio;
-static fd_set fds_masked;
+
+struct io_fd_s {
+  int fd;
+  struct io_callback_s cb;
+  struct io_callback_s stash;
+  int masked;
+  int registered;		/* in the epoll set */
+  int always;			/* can't be polled, so always ready */
+  unsigned gen;			/* tells the stale events */
+  uint64_t wakeups;
+  const char *stat_name;
+};
+static struct io_fd_s **io_fds;
+static int io_fds_num;
 
 #if defined(SIG)
 static inline int process_interrupt(SillyG_t *sg)
@@ -98,20 +111,129 @@ void irq_select(void)
 /*  */
 /* io_select @@@  24576 MOVED_CODE_BEGIN @@@ 01/23/96, ./src/base/misc/dosio.c --> src/base/misc/ioctl.c  */
 
-static int max_fd;
-static int syncpipe[2];
+/* The fds are in an epoll set with EPOLLONESHOT, so a ready fd is
+ * reported once and stays disarmed while masked. Unmasking re-arms it,
+ * and epoll_ctl() works while the io thread waits, so nothing has to
+ * wake it up.
+ * epoll refuses the regular files and some devices, like /dev/null,
+ * that select() reported as always ready. Those are dispatched on every
+ * pass of the io thread while unmasked, and unmasking one wakes the
+ * thread up through ctlfd. */
+
+#define MAX_EVENTS 16
+
+static int epfd = -1;
+static int ctlfd = -1;
+static int io_stop;
+static int always_num;		/* registered fds that are always ready */
 static pthread_t io_thr;
 static pthread_mutex_t fun_mtx = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t blk_mtx = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t fds_mtx = PTHREAD_MUTEX_INITIALIZER;
 
+static struct io_fd_s *get_fd(int fd)
+{
+    struct io_fd_s *f = NULL;
+
+    pthread_mutex_lock(&fds_mtx);
+    if (fd >= 0 && fd < io_fds_num)
+        f = io_fds[fd];
+    pthread_mutex_unlock(&fds_mtx);
+    return f;
+}
+
+static struct io_fd_s *alloc_fd(int fd)
+{
+    struct io_fd_s *f;
+
+    pthread_mutex_lock(&fds_mtx);
+    if (fd >= io_fds_num) {
+        int num = _max(fd + 1, io_fds_num ? io_fds_num * 2 : 64);
+        io_fds = realloc(io_fds, num * sizeof(io_fds[0]));
+        assert(io_fds);
+        memset(&io_fds[io_fds_num], 0,
+                (num - io_fds_num) * sizeof(io_fds[0]));
+        io_fds_num = num;
+    }
+    f = io_fds[fd];
+    if (!f) {
+        f = calloc(1, sizeof(*f));
+        assert(f);
+        f->fd = fd;
+        io_fds[fd] = f;
+    }
+    pthread_mutex_unlock(&fds_mtx);
+    return f;
+}
+
+static void io_wake(void)
+{
+    uint64_t one = 1;
+
+    write(ctlfd, &one, sizeof(one));
+}
+
+/* fds_mtx must be held */
+static void do_epoll_ctl(int op, struct io_fd_s *f, uint32_t events)
+{
+    struct epoll_event ev = {
+        .events = events | EPOLLONESHOT,
+        .data.u64 = ((uint64_t)f->gen << 32) | (unsigned)f->fd,
+    };
+
+    if (f->always) {
+        if (op == EPOLL_CTL_DEL) {
+            f->always = 0;
+            always_num--;
+        } else if (events) {
+            io_wake();
+        }
+        return;
+    }
+    if (epoll_ctl(epfd, op, f->fd, op == EPOLL_CTL_DEL ? NULL : &ev) == 0)
+        return;
+    if (op == EPOLL_CTL_ADD && errno == EPERM) {
+        g_printf("GEN: fd %i can't be polled, taking it as always ready\n",
+                f->fd);
+        f->always = 1;
+        always_num++;
+        if (events)
+            io_wake();
+        return;
+    }
+    /* the fd could be closed before it is removed */
+    if (errno != EBADF && errno != ENOENT)
+        error("epoll_ctl(%i) on fd %i failed: %s\n", op, f->fd,
+                strerror(errno));
+}
+
+/* re-enable the events of an unmasked fd, blk_mtx must be held */
+static void do_arm(struct io_fd_s *f)
+{
+    pthread_mutex_lock(&fds_mtx);
+    if (f->registered && !f->masked)
+        do_epoll_ctl(EPOLL_CTL_MOD, f, EPOLLIN);
+    pthread_mutex_unlock(&fds_mtx);
+}
+
+/* an unmasked fd with an always ready one, blk_mtx must be held */
+static int always_ready(struct io_fd_s *f)
+{
+    int ret;
+
+    pthread_mutex_lock(&fds_mtx);
+    ret = f->always && f->registered && !f->masked;
+    pthread_mutex_unlock(&fds_mtx);
+    return ret;
+}
+
 static void ioselect_demux(void *arg)
 {
-    struct io_callback_s *p = arg;
+    struct io_fd_s *p = arg;
     struct io_callback_s f;
 
     pthread_mutex_lock(&fun_mtx);
-    f = *p;
+    f = p->cb;
     pthread_mutex_unlock(&fun_mtx);
     /* check if not removed from other thread */
     if (f.func) {
@@ -121,55 +243,71 @@ static void ioselect_demux(void *arg)
     }
 }
 
-static void io_select(void)
+/* blk_mtx must be held */
+static void io_dispatch(struct io_fd_s *f)
 {
-  int selrtn, i;
-  fd_set fds;
-  int nfds;
+  f->wakeups++;
+  if (f->cb.flags & IOFLG_IMMED) {
+    if (f->cb.flags & IOFLG_MASKED)
+      f->masked = 1;
+    f->cb.func(f->fd, f->cb.arg);
+    do_arm(f);
+  } else {
+    f->masked = 1;
+    add_thread_callback(ioselect_demux, f, "ioselect");
+  }
+}
 
-  pthread_mutex_lock(&fds_mtx);
-  fds = fds_sigio;
-  nfds = max_fd + 1;
-  pthread_mutex_unlock(&fds_mtx);
+static void io_select(void)
+{
+  struct epoll_event ev[MAX_EVENTS];
+  struct io_fd_s *f;
+  int n, i, timeout = -1;
 
   pthread_mutex_lock(&blk_mtx);
-  for (i = 0; i < nfds; i++) {
-    if (FD_ISSET(i, &fds_masked))
-      FD_CLR(i, &fds);
+  for (i = 0; always_num && i < io_fds_num; i++) {
+    f = get_fd(i);
+    if (f && always_ready(f)) {
+      timeout = 0;
+      break;
+    }
   }
   pthread_mutex_unlock(&blk_mtx);
 
-  pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-  selrtn = RPT_SYSCALL(select(nfds, &fds, NULL, NULL, NULL));
-  pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
-
-  switch (selrtn) {
-    case 0:			/* none ready, nothing to do :-) */
-      return;
-
-    case -1:			/* error (not EINTR) */
-      error("bad io_select: %s\n", strerror(errno));
-      break;
+  n = RPT_SYSCALL(epoll_wait(epfd, ev, MAX_EVENTS, timeout));
+  if (n == -1) {
+    error("bad io_select: %s\n", strerror(errno));
+    return;
+  }
 
-    default:			/* has at least 1 descriptor ready */
-      pthread_mutex_lock(&blk_mtx);
-      for (i = 0; i < nfds; i++) {
-        if (FD_ISSET(i, &fds_masked))
-          continue;
-        if (FD_ISSET(i, &fds)) {
-          if (io_callback_func[i].flags & IOFLG_IMMED) {
-            if (io_callback_func[i].flags & IOFLG_MASKED)
-              FD_SET(i, &fds_masked);
-            io_callback_func[i].func(i, io_callback_func[i].arg);
-          } else {
-            FD_SET(i, &fds_masked);
-            add_thread_callback(ioselect_demux, &io_callback_func[i], "ioselect");
-          }
-        }
-      }
-      pthread_mutex_unlock(&blk_mtx);
-      break;
+  pthread_mutex_lock(&blk_mtx);
+  for (i = 0; i < n; i++) {
+    int fd = ev[i].data.u64 & 0xffffffff;
+    unsigned gen = ev[i].data.u64 >> 32;
+
+    if (fd == ctlfd) {
+      uint64_t cnt;
+      read(ctlfd, &cnt, sizeof(cnt));
+      continue;
+    }
+    f = get_fd(fd);
+    if (!f)
+      continue;
+    pthread_mutex_lock(&fds_mtx);
+    /* could be removed, or removed and added again, since the wait */
+    if (!f->registered || f->gen != gen)
+      f = NULL;
+    pthread_mutex_unlock(&fds_mtx);
+    if (!f || f->masked)
+      continue;
+    io_dispatch(f);
+  }
+  for (i = 0; always_num && !io_stop && i < io_fds_num; i++) {
+    f = get_fd(i);
+    if (f && always_ready(f))
+      io_dispatch(f);
   }
+  pthread_mutex_unlock(&blk_mtx);
 }
 
 /*
@@ -189,32 +327,33 @@ void
 add_to_io_select_new(int new_fd, void (*func)(int, void *), void *arg,
 	unsigned flags, const char *name)
 {
-    struct io_callback_s *f = &io_callback_func[new_fd];
+    struct io_fd_s *f;
 
-    if (new_fd >= MAX_FD) {
-	error("Too many IO fds used.\n");
+    if (new_fd < 0) {
+	error("Bad IO fd %i for %s.\n", new_fd, name);
 	leavedos(76);
     }
 
-    io_callback_stash[new_fd] = *f;
+    f = alloc_fd(new_fd);
+    f->stash = f->cb;
 
     g_printf("GEN: fd=%d gets SIGIO for %s\n", new_fd, name);
     pthread_mutex_lock(&fun_mtx);
-    f->func = func;
-    f->arg = arg;
-    f->name = name;
-    f->fd = new_fd;
-    f->flags = flags;
+    f->cb.func = func;
+    f->cb.arg = arg;
+    f->cb.name = name;
+    f->cb.fd = new_fd;
+    f->cb.flags = flags;
     pthread_mutex_unlock(&fun_mtx);
+    f->stat_name = name;
 
-    pthread_mutex_lock(&fds_mtx);
-    if (new_fd > max_fd)
-        max_fd = new_fd;
-    FD_SET(new_fd, &fds_sigio);
-    pthread_mutex_unlock(&fds_mtx);
-
-    if (!io_callback_stash[new_fd].func)
-	write(syncpipe[1], "+", 1);
+    if (!f->stash.func) {
+	pthread_mutex_lock(&fds_mtx);
+	f->gen++;
+	f->registered = 1;
+	do_epoll_ctl(EPOLL_CTL_ADD, f, f->masked ? 0 : EPOLLIN);
+	pthread_mutex_unlock(&fds_mtx);
+    }
 }
 
 /*
@@ -232,31 +371,37 @@ add_to_io_select_new(int new_fd, void (*func)(int, void *), void *arg,
  */
 void remove_from_io_select(int fd)
 {
-    if (fd < 0 || !io_callback_func[fd].func) {
+    struct io_fd_s *f = get_fd(fd);
+
+    if (!f || !f->cb.func) {
 	g_printf("GEN: removing bogus fd %d (ignoring)\n", fd);
 	return;
     }
 
     pthread_mutex_lock(&fun_mtx);
-    io_callback_func[fd] = io_callback_stash[fd];
+    f->cb = f->stash;
     pthread_mutex_unlock(&fun_mtx);
-    io_callback_stash[fd].func = NULL;
+    f->stash.func = NULL;
 
-    if (!io_callback_func[fd].func) {
+    if (!f->cb.func) {
 	pthread_mutex_lock(&fds_mtx);
-	FD_CLR(fd, &fds_sigio);
+	f->registered = 0;
+	do_epoll_ctl(EPOLL_CTL_DEL, f, 0);
 	pthread_mutex_unlock(&fds_mtx);
-	write(syncpipe[1], "-", 1);
 	g_printf("GEN: fd=%d removed from select SIGIO\n", fd);
     }
 }
 
 static void do_unmask(int fd)
 {
+    struct io_fd_s *f = get_fd(fd);
+
+    if (!f)
+	return;
     pthread_mutex_lock(&blk_mtx);
-    FD_CLR(fd, &fds_masked);
+    f->masked = 0;
+    do_arm(f);
     pthread_mutex_unlock(&blk_mtx);
-    write(syncpipe[1], "=", 1);
 }
 
 void ioselect_complete(int fd)
@@ -266,52 +411,44 @@ void ioselect_complete(int fd)
 
 void ioselect_block(int fd)
 {
-    assert(io_callback_func[fd].flags & IOFLG_IMMED);
+    struct io_fd_s *f = get_fd(fd);
+
+    assert(f && (f->cb.flags & IOFLG_IMMED));
+    /* an event that is already armed is dropped when it comes */
     pthread_mutex_lock(&blk_mtx);
-    FD_SET(fd, &fds_masked);
+    f->masked = 1;
     pthread_mutex_unlock(&blk_mtx);
 }
 
 void ioselect_unblock(int fd)
 {
-    assert(io_callback_func[fd].flags & IOFLG_IMMED);
+    struct io_fd_s *f = get_fd(fd);
+
+    assert(f && (f->cb.flags & IOFLG_IMMED));
     do_unmask(fd);
 }
 
 static void *ioselect_thread(void *arg)
 {
-    while (1) {
-	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    while (!io_stop)
 	io_select();
-	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-	pthread_testcancel();
-    }
     return NULL;
 }
 
-static void do_syncpipe(int fd, void *arg)
-{
-    char buf[4096];
-    read(fd, buf, sizeof(buf));
-}
-
 void ioselect_init(void)
 {
-    struct io_callback_s *f;
+    struct epoll_event ev = { .events = EPOLLIN };
     struct sched_param parm = { .sched_priority = 1 };
 
-    FD_ZERO(&fds_sigio);
-    FD_ZERO(&fds_masked);
-    pipe(syncpipe);
-    assert(syncpipe[0] < MAX_FD);
-    f = &io_callback_func[syncpipe[0]];
-    f->func = do_syncpipe;
-    f->arg = NULL;
-    f->name = "syncpipe";
-    f->fd = syncpipe[0];
-    f->flags = IOFLG_IMMED;
-    max_fd = syncpipe[0];
-    FD_SET(syncpipe[0], &fds_sigio);
+    epfd = epoll_create1(EPOLL_CLOEXEC);
+    ctlfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (epfd == -1 || ctlfd == -1) {
+	error("ioselect init failed: %s\n", strerror(errno));
+	leavedos(76);
+	return;
+    }
+    ev.data.u64 = ctlfd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, ctlfd, &ev);
     pthread_create(&io_thr, NULL, ioselect_thread, NULL);
     pthread_setschedparam(io_thr, SCHED_FIFO, &parm);
 #if defined(HAVE_PTHREAD_SETNAME_NP) && defined(__GLIBC__)
@@ -321,7 +458,20 @@ void ioselect_init(void)
 
 void ioselect_done(void)
 {
-    pthread_cancel(io_thr);
+    int i;
+
+    if (ctlfd == -1)
+	return;
+    io_stop = 1;
+    io_wake();
     pthread_join(io_thr, NULL);
-    close(syncpipe[1]);
+    close(ctlfd);
+    ctlfd = -1;
+
+    for (i = 0; i < io_fds_num; i++) {
+	struct io_fd_s *f = io_fds[i];
+	if (f && f->wakeups)
+	    g_printf("GEN: fd %i (%s): %"PRIu64" wakeups\n", i, f->stat_name,
+		    f->wakeups);
+    }
 }
@@ -2274,6 +2274,12 @@ static void mouse_curtick(void)
   mouse_update_cursor();
 }
 
+static int mouse_curtick_busy(void)
+{
+  return mice->intdrv && (mouse.cursor_on == 0 || dragged.cnt > 1 ||
+      dragged.skipped);
+}
+
 static enum VirqSwRet do_mouse_irq(void *arg)
 {
   int ret = VIRQ_SWRET_DONE;
@@ -2351,7 +2357,7 @@ static int int33_mouse_init(void)
 
   virq_register(VIRQ_MOUSE, do_mouse_fifo, do_mouse_irq, NULL);
   mouse_tid = coopth_create("mouse", call_mouse_event_handler);
-  sigalrm_register_handler(mouse_curtick);
+  sigalrm_register_idle_handler(mouse_curtick, mouse_curtick_busy);
   vtmr_register_idle(VTMR_PIT, do_mouse_idle);
 
   m_printf("MOUSE: INIT complete\n");
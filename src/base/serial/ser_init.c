@@ -355,6 +355,17 @@ static void serial_run(void)
   }
 }
 
+static int serial_busy(void)
+{
+  int i;
+
+  for (i = 0; i < config.num_ser; i++) {
+    if (com[i].opened > 0)
+      return 1;
+  }
+  return 0;
+}
+
 /* DANG_BEGIN_FUNCTION serial_init
  *
  * This is the master serial initialization function that is called
@@ -395,7 +406,7 @@ void serial_init(void)
   init_dmxs();
   fossil_init();
   comredir_init();
-  sigalrm_register_handler(serial_run);
+  sigalrm_register_idle_handler(serial_run, serial_busy);
 }
 
 /* Like serial_init, this is the master function that is called externally,
@@ -0,0 +1,169 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Purpose: wav file writer for the virtual time sound rendering.
+ *
+ * Unlike the libao file writer, this one is driven only by pcm_timer(),
+ * so the amount of samples written depends only on the emulated time.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <endian.h>
+#include "emu.h"
+#include "init.h"
+#include "sound/sound.h"
+
+#define wavf_name "Sound Output: wav writer"
+#define WAV_HDR_SIZE 44
+static FILE *fp;
+static struct player_params params;
+static int started;
+static uint32_t data_size;
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    v = htole16(v);
+    memcpy(p, &v, 2);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    v = htole32(v);
+    memcpy(p, &v, 4);
+}
+
+static void write_wav_header(void)
+{
+    uint8_t hdr[WAV_HDR_SIZE];
+    int ss = pcm_format_size(params.format);
+
+    memcpy(hdr, "RIFF", 4);
+    put32(hdr + 4, WAV_HDR_SIZE - 8 + data_size);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    put32(hdr + 16, 16);			/* fmt chunk size */
+    put16(hdr + 20, 1);				/* PCM */
+    put16(hdr + 22, params.channels);
+    put32(hdr + 24, params.rate);
+    put32(hdr + 28, params.rate * params.channels * ss);
+    put16(hdr + 32, params.channels * ss);
+    put16(hdr + 34, ss * 8);
+    memcpy(hdr + 36, "data", 4);
+    put32(hdr + 40, data_size);
+    fseek(fp, 0, SEEK_SET);
+    fwrite(hdr, sizeof(hdr), 1, fp);
+    fseek(fp, 0, SEEK_END);
+}
+
+static int wavf_open(void *arg)
+{
+    fp = fopen(config.wav_file, "w");
+    if (!fp) {
+	error("wav: opening %s failed\n", config.wav_file);
+	return 0;
+    }
+    params.rate = 44100;
+    params.format = PCM_FORMAT_S16_LE;
+    params.channels = 2;
+    data_size = 0;
+    write_wav_header();
+
+    pcm_setup_hpf(&params);
+
+    return 1;
+}
+
+static void wavf_close(void *arg)
+{
+    write_wav_header();
+    fclose(fp);
+    S_printf("wav: %u bytes written to %s\n", data_size, config.wav_file);
+}
+
+static void wavf_start(void *arg)
+{
+    started = 1;
+}
+
+static void wavf_stop(void *arg)
+{
+    started = 0;
+}
+
+static void wavf_timer(double dtime, void *arg)
+{
+    #define BUF_SIZE 4096
+    char buf[BUF_SIZE];
+    ssize_t size, size1, total;
+    if (!started)
+	return;
+    total = pcm_frag_size(dtime, &params);
+    while (total) {
+	size = total;
+	if (size > BUF_SIZE)
+	    size = BUF_SIZE;
+	size1 = pcm_data_get(buf, size, &params);
+	if (!size1)
+	    break;
+	fwrite(buf, size1, 1, fp);
+	data_size += size1;
+	if (size1 < size)
+	    break;
+	total -= size1;
+    }
+}
+
+static int wavf_get_cfg(void *arg)
+{
+    if (config.sound_vtime && config.wav_file && config.wav_file[0])
+	return PCM_CF_ENABLED;
+    return 0;
+}
+
+static const struct pcm_player player
+#ifdef __cplusplus
+{
+    wavf_name,
+    NULL,
+    wavf_get_cfg,
+    wavf_open,
+    wavf_close,
+    wavf_timer,
+    wavf_start,
+    wavf_stop,
+    PCM_F_PASSTHRU | PCM_F_EXPLICIT,
+    PCM_ID_P,
+    0
+};
+#else
+= {
+    .name = wavf_name,
+    .get_cfg = wavf_get_cfg,
+    .open = wavf_open,
+    .close = wavf_close,
+    .timer = wavf_timer,
+    .start = wavf_start,
+    .stop = wavf_stop,
+    .flags = PCM_F_PASSTHRU | PCM_F_EXPLICIT,
+    .id = PCM_ID_P,
+};
+#endif
+
+CONSTRUCTOR(static void wavf_init(void))
+{
+    params.handle = pcm_register_player(&player, NULL);
+}
@@ -35,6 +35,7 @@
 #include <limits.h>
 #include <pthread.h>
 #include <assert.h>
+#include <stdarg.h>
 #include "emu.h"
 #include "utilities.h"
 #include "ringbuf.h"
@@ -60,6 +61,7 @@
 #define WR_BUFFER_LW (BUFFER_DELAY / 2)
 #define MIN_READ_DELAY (MIN_BUFFER_DELAY + MIN_READ_GUARD_PERIOD)
 #define WRITE_INIT_POS (WRITE_AREA_SIZE / 2)
+#define STATS_LOG_PERIOD 10000000
 
 /*    Layout of our buffer is as follows:
  *
@@ -90,10 +92,24 @@ enum {
     SNDBUF_STATE_STALLED,
 };
 
+/* per-stream statistics, not cleared on stream reset */
+struct strm_stats {
+    long long frames_in;
+    long long frames_out;
+    long long frames_dropped;
+    long long interp_drops;
+    double fill_min;
+    double fill_max;
+    int underruns;
+    int overflows;
+    int stretches;
+    int raw_adjs;
+};
+
+/* samples are converted to S16 when written to the stream */
 struct sample {
-    int format;
     double tstamp;
-    unsigned char data[2];
+    sndbuf_t data;
 };
 
 struct stream {
@@ -121,6 +137,7 @@ struct stream {
     double last_fillup;
     /* --- */
     const char *name;
+    struct strm_stats st;
 };
 
 #define MAX_STREAMS 10
@@ -134,6 +151,15 @@ struct efp_link {
     struct pcm_holder *efp;
 };
 
+struct pl_stats {
+    long long frames;
+    int periods;
+    int late;
+    int early;
+    double render_tot;
+    double render_max;
+};
+
 struct pcm_player_wr {
     double time;
     long long last_cnt[MAX_STREAMS];
@@ -141,6 +167,7 @@ struct pcm_player_wr {
     double last_tstamp[MAX_STREAMS];
     struct efp_link efpl[MAX_EFP_LINKS];
     int num_efp_links;
+    struct pl_stats st;
 };
 
 
@@ -173,6 +200,7 @@ struct pcm_struct {
     struct pcm_holder efps[MAX_EFPS];
     int num_efps;
     double time;
+    double stats_time;
 };
 static struct pcm_struct pcm;
 
@@ -218,6 +246,9 @@ int pcm_init(void)
     pthread_mutex_init(&pcm.time_mtx, NULL);
 
 #ifdef USE_DL_PLUGINS
+    /* live output can't follow the virtual time, only the wav writer can */
+    if (config.sound_vtime)
+	goto skip_dl;
 #define LOAD_PLUGIN_C(x, c) do { \
     dl_handles[num_dl_handles] = load_plugin(x); \
     if (dl_handles[num_dl_handles]) { \
@@ -253,6 +284,7 @@ int pcm_init(void)
 #ifdef LADSPA_SUPPORT
     LOAD_PLUGIN("ladspa");
 #endif
+skip_dl:
 #endif
     assert(num_dl_handles <= MAX_DL_HANDLES);
 
@@ -272,10 +304,19 @@ int pcm_init(void)
 
 static void pcm_clear_stream(int strm_idx)
 {
-    pcm.stream[strm_idx].buf_cnt += rng_count(&pcm.stream[strm_idx].buffer);
+    int cnt = rng_count(&pcm.stream[strm_idx].buffer);
+    pcm.stream[strm_idx].st.frames_dropped +=
+	    cnt / pcm.stream[strm_idx].channels;
+    pcm.stream[strm_idx].buf_cnt += cnt;
     rng_clear(&pcm.stream[strm_idx].buffer);
 }
 
+static void reset_strm_stats(struct strm_stats *st)
+{
+    memset(st, 0, sizeof(*st));
+    st->fill_min = -1;
+}
+
 static void pcm_reset_stream(int strm_idx)
 {
     pcm_clear_stream(strm_idx);
@@ -304,6 +345,7 @@ int pcm_allocate_stream(int channels, const char *name, void *vol_arg)
     pcm.stream[index].buf_cnt = 0;
     pcm.stream[index].vol_arg = vol_arg;
     pcm_reset_stream(index);
+    reset_strm_stats(&pcm.stream[index].st);
     pthread_mutex_unlock(&pcm.strm_mtx);
     pcm_printf("PCM: Stream %i allocated for \"%s\"\n", index, name);
     return index;
@@ -393,40 +435,68 @@ int pcm_samp_cutoff(int val, int format)
 #define SS2SC(v) ((signed char)((v) / 256))
 #define SS2US(v) ((unsigned short)((v) + 32768))
 
-static short sample_to_S16(void *data, int format)
+/* Block converters. The format switch is done once per block, and the
+ * loops are specialized for mono and stereo at compile time. */
+#define CONV_LOOP(dst, src, frames, nch, CONV) do { \
+    int _i, _j; \
+    for (_i = 0; _i < (frames); _i++) \
+	for (_j = 0; _j < (nch); _j++) \
+	    dst[_i][_j] = CONV(&src[_i][_j]); \
+} while (0)
+
+#define CONV_BLOCK(dst, src, frames, nchans, CONV) do { \
+    if (nchans == 1) \
+	CONV_LOOP(dst, src, frames, 1, CONV); \
+    else \
+	CONV_LOOP(dst, src, frames, 2, CONV); \
+} while (0)
+
+#define SS2SS(v) (*(sndbuf_t *)(v))
+#define SS2UC_P(v) SS2UC(*(v))
+#define SS2SC_P(v) SS2SC(*(v))
+#define SS2US_P(v) SS2US(*(v))
+
+static void block_to_S16(sndbuf_t dst[][SNDBUF_CHANS],
+	sndbuf_t src[][SNDBUF_CHANS], int frames, int nchans, int format)
 {
     switch (format) {
     case PCM_FORMAT_U8:
-	return UC2SS(data);
+	CONV_BLOCK(dst, src, frames, nchans, UC2SS);
+	break;
     case PCM_FORMAT_S8:
-	return SC2SS(data);
+	CONV_BLOCK(dst, src, frames, nchans, SC2SS);
+	break;
     case PCM_FORMAT_U16_LE:
-	return US2SS(data);
+	CONV_BLOCK(dst, src, frames, nchans, US2SS);
+	break;
     case PCM_FORMAT_S16_LE:
-	return *(short *) data;
+	CONV_BLOCK(dst, src, frames, nchans, SS2SS);
+	break;
     default:
 	error("PCM: format %i is not supported\n", format);
-	return 0;
+	memset(dst, 0, frames * sizeof(dst[0]));
+	break;
     }
 }
 
-static void S16_to_sample(short sample, sndbuf_t *buf, int format)
+static void block_from_S16(sndbuf_t buf[][SNDBUF_CHANS], int frames,
+	int nchans, int format)
 {
     switch (format) {
     case PCM_FORMAT_U8:
-	*buf = SS2UC(sample);
+	CONV_BLOCK(buf, buf, frames, nchans, SS2UC_P);
 	break;
     case PCM_FORMAT_S8:
-	*buf = SS2SC(sample);
+	CONV_BLOCK(buf, buf, frames, nchans, SS2SC_P);
 	break;
     case PCM_FORMAT_U16_LE:
-	*buf = SS2US(sample);
+	CONV_BLOCK(buf, buf, frames, nchans, SS2US_P);
 	break;
     case PCM_FORMAT_S16_LE:
-	*buf = sample;
 	break;
     default:
 	error("PCM: format1 %i is not supported\n", format);
+	break;
     }
 }
 
@@ -514,6 +584,7 @@ static void pcm_stream_stretch(int strm_idx)
 	    s->state != SNDBUF_STATE_INACTIVE);
     s->start_time = now;
     s->stretch = 1;
+    s->st.stretches++;
 }
 
 static double calc_buffer_fillup(int strm_idx, double time)
@@ -600,6 +671,7 @@ static void handle_raw_adj(int strm_idx, double fillup, double time)
 	    (fillup < raw_delay / 1.5 &&
 	     fillup <= pcm.stream[strm_idx].last_fillup)) {
 	    pcm.stream[strm_idx].raw_speed_adj -= delta;
+	    pcm.stream[strm_idx].st.raw_adjs++;
 	    if (pcm.stream[strm_idx].raw_speed_adj > 5)
 		pcm.stream[strm_idx].raw_speed_adj = 5;
 	    if (pcm.stream[strm_idx].raw_speed_adj < 0.2)
@@ -628,6 +700,11 @@ static void pcm_handle_get(int strm_idx, double time)
 	break;
 
     case SNDBUF_STATE_PLAYING:
+	if (fillup < pcm.stream[strm_idx].st.fill_min ||
+		pcm.stream[strm_idx].st.fill_min < 0)
+	    pcm.stream[strm_idx].st.fill_min = fillup;
+	if (fillup > pcm.stream[strm_idx].st.fill_max)
+	    pcm.stream[strm_idx].st.fill_max = fillup;
 	if (pcm.stream[strm_idx].flags & PCM_FLAG_RAW)
 	    handle_raw_adj(strm_idx, fillup, stop_time);
 	if (rng_count(&pcm.stream[strm_idx].buffer) <
@@ -642,6 +719,7 @@ static void pcm_handle_get(int strm_idx, double time)
 		pcm_printf("PCM: ERROR: buffer on stream %i stalled (%s)\n",
 		      strm_idx, pcm.stream[strm_idx].name);
 	    pcm.stream[strm_idx].state = SNDBUF_STATE_STALLED;
+	    pcm.stream[strm_idx].st.underruns++;
 	}
 	if (pcm.stream[strm_idx].state == SNDBUF_STATE_PLAYING &&
 		!(pcm.stream[strm_idx].flags & PCM_FLAG_POST) &&
@@ -691,6 +769,7 @@ static void pcm_handle_write(int strm_idx, double time)
     switch (pcm.stream[strm_idx].state) {
     case SNDBUF_STATE_STALLED:
 	pcm.stream[strm_idx].stretch_tot += pcm.stream[strm_idx].stretch_per;
+	pcm.stream[strm_idx].st.stretches++;
 	pcm_printf("PCM: restarting stalled stream %s, str=%f strt=%f\n",
 		pcm.stream[strm_idx].name, pcm.stream[strm_idx].stretch_per,
 		pcm.stream[strm_idx].stretch_tot);
@@ -825,13 +904,14 @@ void pcm_write_interleaved(sndbuf_t ptr[][SNDBUF_CHANS], int frames,
     struct sample samp;
     double frame_per;
     struct stream *strm;
+    sndbuf_t s16[frames][SNDBUF_CHANS];
 
     strm = &pcm.stream[strm_idx];
     assert(nchans <= strm->channels);
     if (strm->flags & PCM_FLAG_RAW)
 	rate /= strm->raw_speed_adj;
 
-    samp.format = format;
+    block_to_S16(s16, ptr, frames, nchans, format);
     samp.tstamp = 0;
     frame_per = pcm_frame_period_us(rate);
     pthread_mutex_lock(&pcm.strm_mtx);
@@ -844,9 +924,10 @@ retry:
 	assert(!(l && samp.tstamp < s2.tstamp));
 	for (j = 0; j < strm->channels; j++) {
 	    int ch = j % nchans;
-	    memcpy(samp.data, &ptr[i][ch], pcm_format_size(format));
+	    samp.data = s16[i][ch];
 	    l = rng_put(&strm->buffer, &samp);
 	    if (!l) {
+		strm->st.overflows++;
 		if (!(strm->flags & PCM_FLAG_RAW)) {
 		    error("Sound buffer %i overflowed (%s)\n", strm_idx,
 			    strm->name);
@@ -862,6 +943,7 @@ retry:
 	}
 	pcm_handle_write(strm_idx, samp.tstamp);
 	strm->stop_time = samp.tstamp + frame_per;
+	strm->st.frames_in++;
     }
 
 cont:
@@ -891,6 +973,7 @@ static void pcm_remove_samples(double time)
 	    if (s.tstamp > time)
 		break;
 	    pcm.stream[i].buf_cnt += pcm.stream[i].channels;
+	    pcm.stream[i].st.frames_out++;
 	    rng_remove(&pcm.stream[i].buffer, pcm.stream[i].channels, NULL);
 	}
     }
@@ -899,8 +982,8 @@ static void pcm_remove_samples(double time)
 static sndbuf_t pcm_interpolate(struct sample s1, struct sample s2,
 		double time)
 {
-    sndbuf_t v1 = sample_to_S16(s1.data, s1.format);
-    sndbuf_t v2 = sample_to_S16(s2.data, s2.format);
+    sndbuf_t v1 = s1.data;
+    sndbuf_t v2 = s2.data;
     if (s2.tstamp <= s1.tstamp)
 	return v1;
     /* simple linear interpolation for now */
@@ -912,7 +995,7 @@ static void pcm_get_samples(double time,
 		int out_channels, int id)
 {
     int i, j;
-    int started;
+    int started, got;
     int have_prev;
     struct sample s[SNDBUF_CHANS], prev_s[SNDBUF_CHANS];
 
@@ -925,6 +1008,7 @@ static void pcm_get_samples(double time,
 
 	have_prev = 0;
 	started = 0;
+	got = 0;
 	if (idxs[i] >= pcm.stream[i].channels) {
 	    idxs[i] -= pcm.stream[i].channels;
 	    have_prev = 1;
@@ -943,17 +1027,23 @@ static void pcm_get_samples(double time,
 		}
 		for (j = 0; j < out_channels; j++)
 		    samp[i][j] = pcm_interpolate(prev_s[j], s[j], time);
+		got = 1;
 		break;
 	    }
 	    memcpy(prev_s, s, sizeof(struct sample) * out_channels);
 	    idxs[i] += pcm.stream[i].channels;
 	    started = 1;
 	}
+	/* a playing stream that ran dry, not one that didn't start yet */
+	if (!got && pcm.stream[i].state == SNDBUF_STATE_PLAYING &&
+		rng_count(&pcm.stream[i].buffer) - idxs[i] <
+		pcm.stream[i].channels)
+	    pcm.stream[i].st.interp_drops++;
     }
 }
 
 static void pcm_mix_samples(sndbuf_t in[][SNDBUF_CHANS],
-	sndbuf_t out[SNDBUF_CHANS], int channels, int format,
+	sndbuf_t out[SNDBUF_CHANS], int channels,
 	double volume[][SNDBUF_CHANS][SNDBUF_CHANS])
 {
     int i, j, k;
@@ -972,10 +1062,8 @@ static void pcm_mix_samples(sndbuf_t in[][SNDBUF_CHANS],
     }
     for (i = channels; i < SNDBUF_CHANS; i++)
 	value[0] += value[i];
-    for (i = 0; i < channels; i++) {
-	S16_to_sample(pcm_samp_cutoff(value[i], PCM_FORMAT_S16_LE),
-		&out[i], format);
-    }
+    for (i = 0; i < channels; i++)
+	out[i] = pcm_samp_cutoff(value[i], PCM_FORMAT_S16_LE);
 }
 
 static void calc_idxs(struct pcm_player_wr *pl, int idxs[MAX_STREAMS])
@@ -1033,6 +1121,8 @@ int pcm_data_get_interleaved(sndbuf_t buf[][SNDBUF_CHANS], int nframes,
 {
     int idxs[MAX_STREAMS], out_idx, handle, i;
     long long now;
+    hitimer_t t0;
+    double rt;
     double start_time, stop_time, frame_period, frag_period, time;
     sndbuf_t samp[MAX_STREAMS][SNDBUF_CHANS];
     double volume[MAX_STREAMS][SNDBUF_CHANS][SNDBUF_CHANS];
@@ -1050,12 +1140,14 @@ int pcm_data_get_interleaved(sndbuf_t buf[][SNDBUF_CHANS], int nframes,
 		  now - MAX_BUFFER_DELAY, now - MAX_BUFFER_DELAY - start_time);
 	start_time = now - INIT_BUFFER_DELAY;
 	stop_time = start_time + frag_period;
+	PL_PRIV(p)->st.late++;
     }
     if (start_time > now - MIN_READ_DELAY) {
 	pcm_printf("PCM: \"%s\" too small start delay, stop=%f max=%f d=%f\n",
 		  p->plugin->name, stop_time,
 		  now - MIN_BUFFER_DELAY, stop_time -
 		  (now - MIN_BUFFER_DELAY));
+	PL_PRIV(p)->st.early++;
 	return 0;
     }
     if (stop_time > now - MIN_BUFFER_DELAY) {
@@ -1081,21 +1173,28 @@ int pcm_data_get_interleaved(sndbuf_t buf[][SNDBUF_CHANS], int nframes,
 	pthread_mutex_unlock(&pcm.strm_mtx);
 	return 0;
     }
+    t0 = GETusSYSTIME();
     frame_period = pcm_frame_period_us(params->rate);
     time = start_time;
     calc_idxs(PL_PRIV(p), idxs);
     get_volumes(PLAYER(p)->id, volume);
     for (out_idx = 0; out_idx < nframes; out_idx++) {
 	pcm_get_samples(time, samp, idxs, params->channels, PLAYER(p)->id);
-	pcm_mix_samples(samp, buf[out_idx], params->channels, params->format,
-		volume);
+	pcm_mix_samples(samp, buf[out_idx], params->channels, volume);
 	time += frame_period;
     }
+    block_from_S16(buf, nframes, params->channels, params->format);
     if (fabs(time - stop_time) > frame_period)
 	error("PCM: time=%f stop_time=%f p=%f\n",
 		    time, stop_time, frame_period);
     PL_PRIV(p)->time = stop_time;
     save_idxs(PL_PRIV(p), idxs);
+    rt = GETusSYSTIME() - t0;
+    PL_PRIV(p)->st.frames += out_idx;
+    PL_PRIV(p)->st.periods++;
+    PL_PRIV(p)->st.render_tot += rt;
+    if (rt > PL_PRIV(p)->st.render_max)
+	PL_PRIV(p)->st.render_max = rt;
     pthread_mutex_unlock(&pcm.strm_mtx);
 
     for (i = 0; i < PL_PRIV(p)->num_efp_links; i++) {
@@ -1208,6 +1307,74 @@ void pcm_reset_player(int handle)
     memset(pl->last_cnt, 0, sizeof(pl->last_cnt));
 }
 
+static void log_stats_printf(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vlog_printf(-1, fmt, args);
+    va_end(args);
+}
+
+void pcm_reset_stats(void)
+{
+    int i;
+    pthread_mutex_lock(&pcm.strm_mtx);
+    for (i = 0; i < pcm.num_streams; i++)
+	reset_strm_stats(&pcm.stream[i].st);
+    for (i = 0; i < pcm.num_players; i++) {
+	struct pcm_holder *p = &pcm.players[i];
+	memset(&PL_PRIV(p)->st, 0, sizeof(struct pl_stats));
+    }
+    pthread_mutex_unlock(&pcm.strm_mtx);
+}
+
+void pcm_dump_stats(void (*print)(const char *, ...))
+{
+    int i, num_streams, num_players;
+    struct strm_stats sst[MAX_STREAMS];
+    double adj[MAX_STREAMS];
+    struct pl_stats pst[MAX_PLAYERS];
+    int opened[MAX_PLAYERS];
+    const char *sname[MAX_STREAMS], *pname[MAX_PLAYERS];
+
+    /* take a snapshot: print callback may re-enter dos */
+    pthread_mutex_lock(&pcm.strm_mtx);
+    num_streams = pcm.num_streams;
+    num_players = pcm.num_players;
+    for (i = 0; i < num_streams; i++) {
+	sst[i] = pcm.stream[i].st;
+	sname[i] = pcm.stream[i].name;
+	adj[i] = (pcm.stream[i].flags & PCM_FLAG_RAW) ?
+		pcm.stream[i].raw_speed_adj : 1.0;
+    }
+    for (i = 0; i < num_players; i++) {
+	struct pcm_holder *p = &pcm.players[i];
+	pst[i] = PL_PRIV(p)->st;
+	opened[i] = p->opened;
+	pname[i] = p->plugin->name;
+    }
+    pthread_mutex_unlock(&pcm.strm_mtx);
+
+    for (i = 0; i < num_streams; i++) {
+	(*print)("PCM: stream %i (%s): in=%lli out=%lli drop=%lli "
+		"fill=%.0f..%.0fus underruns=%i ovf=%i stretch=%i adj=%i "
+		"(%.3f) idrop=%lli\n", i, sname[i],
+		sst[i].frames_in, sst[i].frames_out, sst[i].frames_dropped,
+		sst[i].fill_min < 0 ? 0 : sst[i].fill_min, sst[i].fill_max,
+		sst[i].underruns, sst[i].overflows, sst[i].stretches,
+		sst[i].raw_adjs, adj[i], sst[i].interp_drops);
+    }
+    for (i = 0; i < num_players; i++) {
+	if (!opened[i])
+	    continue;
+	(*print)("PCM: player %s: frames=%lli periods=%i late=%i early=%i "
+		"render=%.1f/%.0fus\n", pname[i],
+		pst[i].frames, pst[i].periods, pst[i].late, pst[i].early,
+		pst[i].periods ? pst[i].render_tot / pst[i].periods : 0,
+		pst[i].render_max);
+    }
+}
+
 void pcm_timer(void)
 {
     int i;
@@ -1223,6 +1390,17 @@ void pcm_timer(void)
     pthread_mutex_lock(&pcm.time_mtx);
     pcm_advance_time(now);
     pthread_mutex_unlock(&pcm.time_mtx);
+
+    if (debug_level('S') && pcm.playing &&
+	    now - pcm.stats_time >= STATS_LOG_PERIOD) {
+	pcm.stats_time = now;
+	pcm_dump_stats(log_stats_printf);
+    }
+}
+
+int pcm_is_playing(void)
+{
+    return !!pcm.playing;
 }
 
 void pcm_done(void)
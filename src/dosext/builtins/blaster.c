@@ -20,6 +20,7 @@
 
 #include <string.h>
 #include <ctype.h>
+#include <stdarg.h>
 #include "builtins.h"
 #include "msetenv.h"
 
@@ -27,6 +28,7 @@
 
 #include "utilities.h"
 #include "sound.h"
+#include "sound/sound.h"
 #include "sound/midi.h"
 
 static const char *smode[] = { "gm", "gs", "mt32" };
@@ -94,6 +96,14 @@ static void show_settings(void)
 	com_printf("MIDI synth mode is %s\n", smode[get_mode_num()]);
 }
 
+static void stats_printf(const char *fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	com_vprintf(fmt, args);
+	va_end(args);
+}
+
 static void show_help(void)
 {
 	const char *name = "emusound";
@@ -104,6 +114,9 @@ static void show_help(void)
 			name);
 	com_printf("%s -es <mode> \t - set midi synth mode and update MIDI env\n",
 			name);
+	com_printf("%s -t\t\t - show PCM stream and player statistics\n",
+			name);
+	com_printf("%s -r\t\t - reset PCM statistics\n", name);
 	com_printf("%s -h \t\t - this help\n", name);
 }
 
@@ -125,7 +138,7 @@ int emusound_main(int argc, char **argv)
 	}
 
 	GETOPT_RESET();
-	while ((c = getopt(argc, argv, "cehs:")) != -1) {
+	while ((c = getopt(argc, argv, "cehrts:")) != -1) {
 	    switch (c) {
 		case 'c':
 			show_settings();
@@ -137,6 +150,12 @@ int emusound_main(int argc, char **argv)
 		case 'h':
 			show_help();
 			break;
+		case 't':
+			pcm_dump_stats(stats_printf);
+			break;
+		case 'r':
+			pcm_reset_stats();
+			break;
 		case 's':
 			if (strcmp(smode[get_mode_num()], optarg) == 0) {
 				com_printf("%s is already set\n", optarg);
@@ -9,6 +9,9 @@
 
 typedef struct dpmi_pm_block_stuct {
   struct   dpmi_pm_block_stuct *next;
+  struct   dpmi_pm_block_stuct *prev;
+  struct   dpmi_pm_block_stuct *hnext;	/* in the handle hash */
+  struct   dpmi_pm_block_stuct *hwnext;	/* in the hwram list */
   unsigned int handle;
   unsigned int size;
   dosaddr_t base;
@@ -24,8 +27,16 @@ typedef struct dpmi_pm_block_stuct {
   int mapped;
 } dpmi_pm_block;
 
+#define PM_BLOCK_HASH 64
+
 typedef struct dpmi_pm_block_root_struc {
   dpmi_pm_block *first_pm_block;
+  dpmi_pm_block *hash[PM_BLOCK_HASH];
+  /* mapped blocks except hwram, sorted by base; they never overlap */
+  dpmi_pm_block **by_addr;
+  int num_by_addr, max_by_addr;
+  /* hwram blocks can overlap, so they are looked up separately */
+  dpmi_pm_block *first_hwram;
 } dpmi_pm_block_root;
 
 dpmi_pm_block *lookup_pm_block(dpmi_pm_block_root *root, unsigned long h);
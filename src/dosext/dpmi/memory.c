@@ -55,8 +55,84 @@ static const int dpmi_reserved_space = 4 * 1024 * 1024; // reserve 4Mb
 
 /* utility routines */
 
-/* I don\'t think these function will ever become bottleneck, so just */
-/* keep it simple, --dong */
+/* The blocks are kept in a list, and also hashed by handle and indexed
+ * by address, as the clients like DJGPP programs can have thousands of
+ * them and the lookups are done on every page fault. */
+
+#define PM_HASH(h) ((h) & (PM_BLOCK_HASH - 1))
+
+/* the number of the indexed blocks with base <= addr */
+static int addr_idx_upper(dpmi_pm_block_root *root, dosaddr_t addr)
+{
+    int lo = 0, hi = root->num_by_addr;
+    while (lo < hi) {
+	int mid = (lo + hi) / 2;
+	if (root->by_addr[mid]->base <= addr)
+	    lo = mid + 1;
+	else
+	    hi = mid;
+    }
+    return lo;
+}
+
+static void index_addr(dpmi_pm_block_root *root, dpmi_pm_block *p)
+{
+    int pos;
+
+    if (!p->mapped)
+	return;
+    if (p->hwram) {
+	p->hwnext = root->first_hwram;
+	root->first_hwram = p;
+	return;
+    }
+    if (root->num_by_addr == root->max_by_addr) {
+	int max = root->max_by_addr ? root->max_by_addr * 2 : 64;
+	dpmi_pm_block **n = realloc(root->by_addr, max * sizeof(*n));
+	assert(n);
+	root->by_addr = n;
+	root->max_by_addr = max;
+    }
+    pos = addr_idx_upper(root, p->base);
+    memmove(&root->by_addr[pos + 1], &root->by_addr[pos],
+	    (root->num_by_addr - pos) * sizeof(root->by_addr[0]));
+    root->by_addr[pos] = p;
+    root->num_by_addr++;
+}
+
+/* does nothing if the block is not indexed */
+static void unindex_addr(dpmi_pm_block_root *root, dpmi_pm_block *p)
+{
+    int pos;
+
+    if (p->hwram) {
+	dpmi_pm_block **hp;
+	for (hp = &root->first_hwram; *hp; hp = &(*hp)->hwnext) {
+	    if (*hp == p) {
+		*hp = p->hwnext;
+		break;
+	    }
+	}
+	return;
+    }
+    pos = addr_idx_upper(root, p->base) - 1;
+    if (pos < 0 || root->by_addr[pos] != p)
+	return;
+    root->num_by_addr--;
+    memmove(&root->by_addr[pos], &root->by_addr[pos + 1],
+	    (root->num_by_addr - pos) * sizeof(root->by_addr[0]));
+}
+
+/* index_pm_block: make the block visible to the lookups, once its
+ * handle, base and size are set */
+static void index_pm_block(dpmi_pm_block_root *root, dpmi_pm_block *p)
+{
+    int h = PM_HASH(p->handle);
+    p->hnext = root->hash[h];
+    root->hash[h] = p;
+    index_addr(root, p);
+}
+
 /* alloc_pm_block: allocate a dpmi_pm_block struct and add it to the list */
 static dpmi_pm_block * alloc_pm_block(dpmi_pm_block_root *root, unsigned long size)
 {
@@ -70,6 +146,8 @@ static dpmi_pm_block * alloc_pm_block(dpmi_pm_block_root *root, unsigned long si
 	return NULL;
     }
     p->next = root->first_pm_block;	/* add it to list */
+    if (p->next)
+	p->next->prev = p;
     root->first_pm_block = p;
     p->mapped = 1;
     return p;
@@ -87,24 +165,25 @@ static void * realloc_pm_block(dpmi_pm_block *block, unsigned long newsize)
 /* free_pm_block free a dpmi_pm_block struct and delete it from list */
 static int free_pm_block(dpmi_pm_block_root *root, dpmi_pm_block *p)
 {
-    dpmi_pm_block *tmp = NULL;
-    dpmi_pm_block *next;
+    dpmi_pm_block **hp;
     if (!p) return -1;
-    if (p != root->first_pm_block) {
-	for(tmp = root->first_pm_block; tmp; tmp = tmp->next)
-	    if (tmp -> next == p)
-		break;
-	if (!tmp) return -1;
+    for (hp = &root->hash[PM_HASH(p->handle)]; *hp; hp = &(*hp)->hnext) {
+	if (*hp == p) {
+	    *hp = p->hnext;
+	    break;
+	}
     }
-    next = p->next;
+    unindex_addr(root, p);
+    if (p->prev)
+	p->prev->next = p->next;
+    else
+	root->first_pm_block = p->next;
+    if (p->next)
+	p->next->prev = p->prev;
     free(p->attrs);
     free(p->shmname);
     free(p->rshmname);
     free(p);
-    if (tmp)
-	tmp->next = next;
-    else
-	root->first_pm_block = next;
     return 0;
 }
 
@@ -112,7 +191,7 @@ static int free_pm_block(dpmi_pm_block_root *root, dpmi_pm_block *p)
 dpmi_pm_block *lookup_pm_block(dpmi_pm_block_root *root, unsigned long h)
 {
     dpmi_pm_block *tmp;
-    for(tmp = root->first_pm_block; tmp; tmp = tmp->next) {
+    for(tmp = root->hash[PM_HASH(h)]; tmp; tmp = tmp->hnext) {
 	if (tmp -> handle == h)
 	    return tmp;
     }
@@ -123,8 +202,14 @@ dpmi_pm_block *lookup_pm_block_by_addr(dpmi_pm_block_root *root,
 	dosaddr_t addr)
 {
     dpmi_pm_block *tmp;
-    for(tmp = root->first_pm_block; tmp; tmp = tmp->next) {
-	if (tmp->mapped && addr >= tmp->base && addr < tmp->base + tmp->size)
+    int pos = addr_idx_upper(root, addr) - 1;
+    if (pos >= 0) {
+	tmp = root->by_addr[pos];
+	if (addr < tmp->base + tmp->size)
+	    return tmp;
+    }
+    for(tmp = root->first_hwram; tmp; tmp = tmp->hwnext) {
+	if (addr >= tmp->base && addr < tmp->base + tmp->size)
 	    return tmp;
     }
     return NULL;
@@ -229,7 +314,10 @@ void dpmi_free_pool(void)
 	error("DPMI: leaked %i bytes (main pool)\n", leak);
 }
 
-static int SetAttribsForPage(unsigned int ptr, uint16_t attr, uint16_t *old_attr_p)
+/* SetAttribsForPage: update the attributes of one page. The protection
+ * to apply is returned in *prot_p, or -1 if it is not changed. */
+static int SetAttribsForPage(unsigned int ptr, uint16_t attr, uint16_t *old_attr_p,
+    int *prot_p)
 {
     uint16_t old_attr = *old_attr_p;
     int prot, change = 0, com = attr & 3, old_com = old_attr & 1;
@@ -339,44 +427,65 @@ static int SetAttribsForPage(unsigned int ptr, uint16_t attr, uint16_t *old_attr
 
     D_printf("Addr=%#x\n", ptr);
 
-    if (change) {
-      e_invalidate_full(ptr, PAGE_SIZE);
-      if (com) {
-        if (mprotect_mapping(MAPPING_DPMI, ptr, PAGE_SIZE, prot) == -1) {
-          leavedos(2);
-          return 0;
-        }
-      } else {
-        if (mprotect_mapping(MAPPING_DPMI, ptr, PAGE_SIZE, PROT_NONE) == -1) {
-          D_printf("mmap() failed: %s\n", strerror(errno));
-          return 0;
-        }
-      }
-    }
-
+    *prot_p = change ? (com ? prot : PROT_NONE) : -1;
     return 1;
 }
 
+static int ProtectPages(dosaddr_t addr, unsigned int size, int prot)
+{
+  e_invalidate_full(addr, size);
+  if (mprotect_mapping(MAPPING_DPMI, addr, size, prot) == -1) {
+    if (prot != PROT_NONE) {
+      leavedos(2);
+      return 0;
+    }
+    D_printf("mmap() failed: %s\n", strerror(errno));
+    return 0;
+  }
+  return 1;
+}
+
+/* The pages that get the same protection are changed with a single
+ * mprotect(), as DJGPP programs set the attributes of the large
+ * regions at once. */
 static int SetPageAttributes(dpmi_pm_block *block, int offs, uint16_t attrs[], int count)
 {
   u_short *attr;
-  int i;
+  dosaddr_t addr, run_addr = 0;
+  int i, prot, run_prot = -1, run_len = 0;
 
   for (i = 0; i < count; i++) {
     attr = block->attrs + (offs >> PAGE_SHIFT) + i;
-    if (*attr == attrs[i]) {
-      continue;
+    addr = block->base + offs + (i << PAGE_SHIFT);
+    prot = -1;
+    if (*attr != attrs[i]) {
+      if ((*attr & ATTR_SHR) && ((attrs[i] & 7) != 3)) {
+        D_printf("Disallow change type of shared page\n");
+        goto fail;
+      }
+      D_printf("%i\t", i);
+      if (!SetAttribsForPage(addr, attrs[i], attr, &prot))
+        goto fail;
     }
-    if ((*attr & ATTR_SHR) && ((attrs[i] & 7) != 3)) {
-      D_printf("Disallow change type of shared page\n");
-      return 0;
+    if (prot == run_prot && prot != -1) {
+      run_len += PAGE_SIZE;
+      continue;
     }
-    D_printf("%i\t", i);
-    if (!SetAttribsForPage(block->base + offs + (i << PAGE_SHIFT),
-	attrs[i], attr))
+    if (run_prot != -1 && !ProtectPages(run_addr, run_len, run_prot))
       return 0;
+    run_addr = addr;
+    run_len = PAGE_SIZE;
+    run_prot = prot;
   }
+  if (run_prot != -1 && !ProtectPages(run_addr, run_len, run_prot))
+    return 0;
   return 1;
+
+fail:
+  /* the pages before this one are already changed */
+  if (run_prot != -1)
+    ProtectPages(run_addr, run_len, run_prot);
+  return 0;
 }
 
 static void restore_page_protection(dpmi_pm_block *block)
@@ -414,6 +523,7 @@ dpmi_pm_block * DPMI_malloc(dpmi_pm_block_root *root, unsigned int size)
     mem_allocd += size;
     block->handle = pm_block_handle_used++;
     block->size = size;
+    index_pm_block(root, block);
     return block;
 }
 
@@ -469,6 +579,7 @@ dpmi_pm_block * DPMI_mallocLinear(dpmi_pm_block_root *root,
 	mem_allocd += size;
     block->handle = pm_block_handle_used++;
     block->size = size;
+    index_pm_block(root, block);
     return block;
 }
 
@@ -491,6 +602,7 @@ dpmi_pm_block * DPMI_mapHWRam(dpmi_pm_block_root *root,
 	block->attrs[i] = 9;
     block->handle = pm_block_handle_used++;
     block->size = size;
+    index_pm_block(root, block);
     return block;
 }
 
@@ -500,12 +612,13 @@ static void do_unmap_hwram(dpmi_pm_block_root *root, dpmi_pm_block *block)
     free_pm_block(root, block);
 }
 
-static void do_unmap_shm(dpmi_pm_block *block)
+static void do_unmap_shm(dpmi_pm_block_root *root, dpmi_pm_block *block)
 {
     int err = restore_mapping(MAPPING_DPMI, block->base, block->size);
     if (err)
         error("restore_mapping() failed\n");
     smfree(&mem_pool, MEM_BASE32(block->base));
+    unindex_addr(root, block);
     block->mapped = 0;
 }
 
@@ -518,7 +631,7 @@ int DPMI_unmapHWRam(dpmi_pm_block_root *root, dosaddr_t vbase)
         do_unmap_hwram(root, block);
     } else if (block->shm) {
         /* extension: allow unmap shared block as hwram */
-        do_unmap_shm(block);
+        do_unmap_shm(root, block);
         if (!block->shmname)
             free_pm_block(root, block);
     } else {
@@ -546,7 +659,7 @@ int DPMI_free(dpmi_pm_block_root *root, unsigned int handle)
     e_invalidate_full(block->base, block->size);
     if (block->shm) {
 	if (block->mapped)
-	    do_unmap_shm(block);
+	    do_unmap_shm(root, block);
     } else if (block->linear) {
 	for (i = 0; i < block->size >> PAGE_SHIFT; i++) {
 	    if ((block->attrs[i] & 3) == 2)   // mapped
@@ -661,6 +774,7 @@ dpmi_pm_block *DPMI_mallocShared(dpmi_pm_block_root *root,
     ptr->shmname = strdup(name);
     ptr->rshmname = shmname;
     ptr->shlock = shlock;
+    index_pm_block(root, ptr);
     D_printf("DPMI: map shm %s\n", ptr->shmname);
     return ptr;
 
@@ -685,7 +799,7 @@ int DPMI_freeShared(dpmi_pm_block_root *root, uint32_t handle)
     if (!ptr || !ptr->shmname)
         return -1;
     if (ptr->mapped)
-        do_unmap_shm(ptr);
+        do_unmap_shm(root, ptr);
 
     exlock = shlock_open(EXLOCK_DIR, ptr->shmname, 1, 1);
     assert(exlock);
@@ -796,8 +910,10 @@ dpmi_pm_block * DPMI_realloc(dpmi_pm_block_root *root,
 	return NULL;
 
     finish_realloc(block, newsize, 1);
+    unindex_addr(root, block);
     block->base = DOSADDR_REL(ptr);
     block->size = newsize;
+    index_addr(root, block);
     restore_page_protection(block);
     return block;
 }
@@ -842,8 +958,10 @@ dpmi_pm_block * DPMI_reallocLinear(dpmi_pm_block_root *root,
     }
 
     finish_realloc(block, newsize, committed);
+    unindex_addr(root, block);
     block->base = DOSADDR_REL(ptr);
     block->size = newsize;
+    index_addr(root, block);
     /* restore_page_protection() will set proper prots */
     mprotect_mapping(MAPPING_DPMI, block->base, block->size,
 		PROT_READ | PROT_WRITE | PROT_EXEC);
@@ -862,6 +980,9 @@ void DPMI_freeAll(dpmi_pm_block_root *root)
 	else
 	    DPMI_free(root, (*p)->handle);
     }
+    free(root->by_addr);
+    root->by_addr = NULL;
+    root->num_by_addr = root->max_by_addr = 0;
 }
 
 int DPMI_MapConventionalMemory(dpmi_pm_block_root *root,
@@ -129,6 +129,20 @@ static void lrhlp_thr(void *arg)
 	doshlp_quit_dpmi(scp);
 	return;
     }
+#ifdef DOSEMU
+    /* files on our drives are read right into the client's buffer */
+    done = mfs_lio_read(_LWORD(ebx), buf, len);
+    if (done >= 0) {
+        D_printf("MSDOS: read %i of %i bytes from fd %i directly\n",
+                done, len, _LWORD(ebx));
+        _eflags &= ~CF;
+        _eax = done;
+        if (lio_priv[DOSHLP_LR].post)
+            lio_priv[DOSHLP_LR].post(scp);
+        return;
+    }
+    done = 0;
+#endif
     pm_to_rm_regs(scp, &_rmreg, ~((1 << esi_INDEX) | (1 << edi_INDEX) |
 	    (1 << ebp_INDEX) | (1 << edx_INDEX)));
     RMREG(ds) = rm_seg;
@@ -193,6 +207,19 @@ static void lwhlp_thr(void *arg)
 	doshlp_quit_dpmi(scp);
 	return;
     }
+#ifdef DOSEMU
+    done = mfs_lio_write(_LWORD(ebx), buf, len);
+    if (done >= 0) {
+        D_printf("MSDOS: wrote %i of %i bytes to fd %i directly\n",
+                done, len, _LWORD(ebx));
+        _eflags &= ~CF;
+        _eax = done;
+        if (lio_priv[DOSHLP_LW].post)
+            lio_priv[DOSHLP_LW].post(scp);
+        return;
+    }
+    done = 0;
+#endif
     pm_to_rm_regs(scp, &_rmreg, ~((1 << esi_INDEX) | (1 << edi_INDEX) |
 	    (1 << ebp_INDEX) | (1 << edx_INDEX)));
     RMREG(ds) = rm_seg;
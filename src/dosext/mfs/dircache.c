@@ -0,0 +1,686 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/*
+ * Purpose: host directory cache for the redirector.
+ *
+ * Every directory read by MFS is kept as an immutable snapshot of its
+ * entries, together with the names already converted to the DOS charset
+ * and to the 8.3 form, so that the case-insensitive lookups done by
+ * scan_dir() and the FindFirst/FindNext scans don't have to re-read and
+ * re-convert the whole host directory each time.
+ *
+ * The snapshots are kept coherent with inotify: the event queue is drained
+ * synchronously before every lookup, so any change done to the directory
+ * (by DOS or by the host) before the lookup is seen by it. Namespace
+ * changes drop the snapshot, data/attribute changes drop the cached stat
+ * of a single entry. Filesystems that don't deliver inotify events for
+ * remote changes are not cached.
+ *
+ * FindFirst/FindNext stat the matching entries in batches, relative to
+ * a single directory fd, and keep the DOS attributes next to the stat.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <sys/vfs.h>
+#include "emu.h"
+#include "dos2linux.h"
+#include "mangle.h"
+#include "mfs.h"
+#include "dircache.h"
+
+#define DC_MAX_DIRS 128
+#define DC_DIR_HASH 256
+#define DC_NS_EVENTS (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO)
+#define DC_DATA_EVENTS (IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE)
+#define DC_SELF_EVENTS (IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT | \
+	IN_IGNORED)
+#define DC_WATCH_MASK (DC_NS_EVENTS | DC_DATA_EVENTS | IN_DELETE_SELF | \
+	IN_MOVE_SELF | IN_ONLYDIR)
+
+struct dcache_ent {
+  char *d_name;
+  char *d_long_name;	/* same pointer as d_name if no separate long name */
+  char *dos;		/* d_long_name in the DOS character set */
+  char *up;		/* dos, upper-cased */
+  char *up83;		/* 8.3 form of dos, upper-cased, or NULL */
+  char *mangled;	/* mangled 8.3 form, upper-cased, made on demand */
+  unsigned dos_ok:1;
+  unsigned have_st:1;
+  unsigned have_attr:1;	/* only valid with have_st */
+  struct stat st;
+  int attr;
+  int next_name;
+  int next_up;
+  int next_83;
+};
+
+struct dcache_snap {
+  int refs;
+  int vfat;
+  int nr;
+  unsigned mask;
+  struct dcache_ent *ent;
+  int *h_name;
+  int *h_up;
+  int *h_83;
+};
+
+struct dc_dir {
+  char *path;
+  int wd;
+  struct dcache_snap *snap;
+  struct dc_dir *hnext;
+  struct dc_dir *prev, *next;	/* LRU list, most recently used first */
+};
+
+static struct {
+  int fd;
+  int failed;
+  int nr_dirs;
+  struct dc_dir *hash[DC_DIR_HASH];
+  struct dc_dir *head, *tail;
+  struct {
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long index_hits;
+    unsigned long stat_hits;
+    unsigned long stat_misses;
+    unsigned long batches;
+    unsigned long batch_stats;
+    unsigned long invals;
+    unsigned long stat_invals;
+    unsigned long evictions;
+    unsigned long overflows;
+    unsigned long uncacheable;
+  } st;
+} dc = { .fd = -1 };
+
+static unsigned hash_str(const char *s, size_t len)
+{
+  unsigned h = 2166136261u;
+  size_t i;
+
+  for (i = 0; i < len; i++)
+    h = (h ^ (unsigned char)s[i]) * 16777619u;
+  return h;
+}
+
+/* directory keys have no trailing slashes, except for the "/" itself */
+static size_t key_len(const char *path, size_t len)
+{
+  while (len > 1 && path[len - 1] == '/')
+    len--;
+  return len;
+}
+
+static void snap_free(struct dcache_snap *snap)
+{
+  int i;
+
+  for (i = 0; i < snap->nr; i++) {
+    struct dcache_ent *e = &snap->ent[i];
+    if (e->d_long_name != e->d_name)
+      free(e->d_long_name);
+    free(e->d_name);
+    free(e->dos);
+    free(e->up);
+    free(e->up83);
+    free(e->mangled);
+  }
+  free(snap->ent);
+  free(snap->h_name);
+  free(snap->h_up);
+  free(snap->h_83);
+  free(snap);
+}
+
+void dcache_put(struct dcache_snap *snap)
+{
+  if (--snap->refs == 0)
+    snap_free(snap);
+}
+
+static int snap_find_name(struct dcache_snap *snap, const char *name,
+	size_t len)
+{
+  int i;
+
+  for (i = snap->h_name[hash_str(name, len) & snap->mask]; i != -1;
+	i = snap->ent[i].next_name) {
+    if (strncmp(snap->ent[i].d_name, name, len) == 0 &&
+	snap->ent[i].d_name[len] == '\0')
+      return i;
+  }
+  return -1;
+}
+
+static struct dcache_snap *snap_build(const char *path)
+{
+  struct mfs_dir *dir;
+  struct mfs_dirent *de;
+  struct dcache_snap *snap;
+  int i, alloced = 0;
+  unsigned size;
+
+  dir = dos_opendir_raw(path);
+  if (!dir)
+    return NULL;
+  snap = calloc(1, sizeof(*snap));
+  snap->vfat = dir->vfat;
+  while ((de = dos_readdir(dir))) {
+    struct dcache_ent *e;
+    char tmpname[NAME_MAX + 1];
+
+    if (strcmp(de->d_name, ".") == 0 || strcmp(de->d_name, "..") == 0)
+      continue;
+    if (snap->nr == alloced) {
+      alloced = alloced ? alloced * 2 : 64;
+      snap->ent = realloc(snap->ent, alloced * sizeof(*snap->ent));
+    }
+    e = &snap->ent[snap->nr++];
+    memset(e, 0, sizeof(*e));
+    e->d_name = strdup(de->d_name);
+    e->d_long_name = de->d_long_name == de->d_name ? e->d_name :
+	strdup(de->d_long_name);
+    e->dos_ok = name_ufs_to_dos(tmpname, e->d_long_name);
+    e->dos = strdup(tmpname);
+    e->up = strupperDOS(strdup(tmpname));
+    if (name_convert(tmpname, 0))
+      e->up83 = strupperDOS(strdup(tmpname));
+  }
+  dos_closedir(dir);
+
+  for (size = 16; size < snap->nr * 2; size <<= 1);
+  snap->mask = size - 1;
+  snap->h_name = malloc(size * sizeof(int));
+  snap->h_up = malloc(size * sizeof(int));
+  snap->h_83 = malloc(size * sizeof(int));
+  for (i = 0; i < size; i++)
+    snap->h_name[i] = snap->h_up[i] = snap->h_83[i] = -1;
+  for (i = snap->nr - 1; i >= 0; i--) {
+    struct dcache_ent *e = &snap->ent[i];
+    unsigned h;
+
+    h = hash_str(e->d_name, strlen(e->d_name)) & snap->mask;
+    e->next_name = snap->h_name[h];
+    snap->h_name[h] = i;
+    /* the scan skips the long names DOS can't represent */
+    e->next_up = -1;
+    if (e->dos_ok) {
+      h = hash_str(e->up, strlen(e->up)) & snap->mask;
+      e->next_up = snap->h_up[h];
+      snap->h_up[h] = i;
+    }
+    e->next_83 = -1;
+    if (e->up83) {
+      h = hash_str(e->up83, strlen(e->up83)) & snap->mask;
+      e->next_83 = snap->h_83[h];
+      snap->h_83[h] = i;
+    }
+  }
+  snap->refs = 1;
+  return snap;
+}
+
+static struct dc_dir *dir_find(const char *path, size_t len)
+{
+  struct dc_dir *d;
+
+  for (d = dc.hash[hash_str(path, len) % DC_DIR_HASH]; d; d = d->hnext) {
+    if (strncmp(d->path, path, len) == 0 && d->path[len] == '\0')
+      return d;
+  }
+  return NULL;
+}
+
+static void lru_unlink(struct dc_dir *d)
+{
+  if (d->prev)
+    d->prev->next = d->next;
+  else
+    dc.head = d->next;
+  if (d->next)
+    d->next->prev = d->prev;
+  else
+    dc.tail = d->prev;
+  d->prev = d->next = NULL;
+}
+
+static void lru_push(struct dc_dir *d)
+{
+  d->next = dc.head;
+  if (dc.head)
+    dc.head->prev = d;
+  dc.head = d;
+  if (!dc.tail)
+    dc.tail = d;
+}
+
+static void dir_drop_snap(struct dc_dir *d)
+{
+  if (!d->snap)
+    return;
+  dcache_put(d->snap);
+  d->snap = NULL;
+  dc.st.invals++;
+}
+
+static void dir_free(struct dc_dir *d)
+{
+  struct dc_dir **p, *d1;
+  int shared = 0;
+
+  p = &dc.hash[hash_str(d->path, strlen(d->path)) % DC_DIR_HASH];
+  while (*p != d)
+    p = &(*p)->hnext;
+  *p = d->hnext;
+  lru_unlink(d);
+  dc.nr_dirs--;
+
+  if (d->snap) {
+    dcache_put(d->snap);
+    d->snap = NULL;
+  }
+  /* the same directory may be reached via different paths */
+  for (d1 = dc.head; d1; d1 = d1->next) {
+    if (d1->wd == d->wd)
+      shared = 1;
+  }
+  if (d->wd != -1 && !shared)
+    inotify_rm_watch(dc.fd, d->wd);
+  free(d->path);
+  free(d);
+}
+
+static void process_event(const struct inotify_event *ev)
+{
+  struct dc_dir *d, *next;
+
+  if (ev->mask & IN_Q_OVERFLOW) {
+    Debug0((dbg_fd, "dircache: inotify queue overflow\n"));
+    dc.st.overflows++;
+    for (d = dc.head; d; d = d->next)
+      dir_drop_snap(d);
+    return;
+  }
+  for (d = dc.head; d; d = next) {
+    next = d->next;
+    if (d->wd != ev->wd)
+      continue;
+    if (ev->mask & DC_SELF_EVENTS) {
+      if (ev->mask & IN_IGNORED)
+	d->wd = -1;
+      dc.st.invals++;
+      dir_free(d);
+    } else if (ev->mask & DC_NS_EVENTS) {
+      dir_drop_snap(d);
+    } else if ((ev->mask & DC_DATA_EVENTS) && ev->len && d->snap) {
+      int i = snap_find_name(d->snap, ev->name, strlen(ev->name));
+      if (i != -1 && d->snap->ent[i].have_st) {
+	d->snap->ent[i].have_st = 0;
+	d->snap->ent[i].have_attr = 0;
+	dc.st.stat_invals++;
+      }
+    }
+  }
+}
+
+static void process_events(void)
+{
+  char buf[4096]
+      __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  ssize_t len;
+  char *p;
+
+  while ((len = read(dc.fd, buf, sizeof(buf))) > 0) {
+    for (p = buf; p < buf + len;
+	p += sizeof(struct inotify_event) + ((struct inotify_event *)p)->len)
+      process_event((struct inotify_event *)p);
+  }
+}
+
+static int dc_init(void)
+{
+  if (dc.fd != -1)
+    return 1;
+  if (dc.failed)
+    return 0;
+  dc.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (dc.fd == -1) {
+    Debug0((dbg_fd, "dircache: inotify_init1 failed: %s\n", strerror(errno)));
+    dc.failed = 1;
+    return 0;
+  }
+  return 1;
+}
+
+/* inotify doesn't see changes done by other hosts */
+static int fs_cacheable(const char *path)
+{
+  struct statfs sfs;
+
+  if (statfs(path, &sfs) != 0)
+    return 0;
+  switch ((unsigned)sfs.f_type) {
+  case 0x6969:		/* NFS */
+  case 0x517b:		/* SMB */
+  case 0xff534d42:	/* CIFS */
+  case 0xfe534d42:	/* SMB2 */
+  case 0x65735546:	/* FUSE */
+  case 0x01021997:	/* 9P */
+  case 0x00c36400:	/* CEPH */
+  case 0x5346414f:	/* AFS */
+    return 0;
+  }
+  return 1;
+}
+
+struct dcache_snap *dcache_get(const char *path)
+{
+  struct dc_dir *d;
+  size_t len = key_len(path, strlen(path));
+
+  if (!dc_init())
+    return NULL;
+  process_events();
+
+  d = dir_find(path, len);
+  if (d && d->snap) {
+    dc.st.hits++;
+    lru_unlink(d);
+    lru_push(d);
+    d->snap->refs++;
+    return d->snap;
+  }
+  dc.st.misses++;
+
+  if (!d) {
+    int wd;
+
+    if (!fs_cacheable(path)) {
+      dc.st.uncacheable++;
+      return NULL;
+    }
+    if (dc.nr_dirs >= DC_MAX_DIRS) {
+      dc.st.evictions++;
+      dir_free(dc.tail);
+    }
+    /* watch before reading, so that no change can be missed */
+    wd = inotify_add_watch(dc.fd, path, DC_WATCH_MASK);
+    if (wd == -1) {
+      Debug0((dbg_fd, "dircache: can't watch %s: %s\n", path,
+	  strerror(errno)));
+      dc.st.uncacheable++;
+      return NULL;
+    }
+    d = calloc(1, sizeof(*d));
+    d->path = strndup(path, len);
+    d->wd = wd;
+    d->hnext = dc.hash[hash_str(d->path, len) % DC_DIR_HASH];
+    dc.hash[hash_str(d->path, len) % DC_DIR_HASH] = d;
+    dc.nr_dirs++;
+  } else {
+    lru_unlink(d);
+  }
+  lru_push(d);
+
+  d->snap = snap_build(path);
+  if (!d->snap) {
+    dir_free(d);
+    return NULL;
+  }
+  Debug0((dbg_fd, "dircache: cached %s, %i entries\n", d->path, d->snap->nr));
+  d->snap->refs++;
+  return d->snap;
+}
+
+int dcache_nr_entries(const struct dcache_snap *snap)
+{
+  return snap->nr;
+}
+
+int dcache_is_vfat(const struct dcache_snap *snap)
+{
+  return snap->vfat;
+}
+
+struct dcache_ent *dcache_entry(struct dcache_snap *snap, int idx,
+	const char **d_name, const char **d_long_name)
+{
+  struct dcache_ent *e = &snap->ent[idx];
+
+  *d_name = e->d_name;
+  *d_long_name = e->d_long_name;
+  return e;
+}
+
+/* find the host name of the entry whose DOS name (or its 8.3 form)
+   is the given upper-cased name; mangled names are not looked up */
+const char *dcache_find(struct dcache_snap *snap, const char *updosname,
+	int is_8_3)
+{
+  unsigned h = hash_str(updosname, strlen(updosname)) & snap->mask;
+  int i;
+
+  if (is_8_3) {
+    for (i = snap->h_83[h]; i != -1; i = snap->ent[i].next_83) {
+      if (strcmp(snap->ent[i].up83, updosname) == 0)
+	break;
+    }
+  } else {
+    for (i = snap->h_up[h]; i != -1; i = snap->ent[i].next_up) {
+      if (strcmp(snap->ent[i].up, updosname) == 0)
+	break;
+    }
+  }
+  if (i == -1)
+    return NULL;
+  dc.st.index_hits++;
+  return snap->ent[i].d_name;
+}
+
+/* same as name_ufs_to_dos() of d_long_name */
+int dos_dirent_name(struct mfs_dirent *de, char *dest)
+{
+  if (!de->dc)
+    return name_ufs_to_dos(dest, de->d_long_name);
+  strcpy(dest, de->dc->dos);
+  return de->dc->dos_ok;
+}
+
+/* same as name_ufs_to_dos() + name_convert() of d_long_name,
+   but the result is upper-cased */
+int dos_dirent_83(struct mfs_dirent *de, char *dest, int mangle)
+{
+  struct dcache_ent *e = de->dc;
+
+  if (!e) {
+    name_ufs_to_dos(dest, de->d_long_name);
+    if (!name_convert(dest, mangle))
+      return 0;
+    strupperDOS(dest);
+    return 1;
+  }
+  if (e->up83) {
+    strcpy(dest, e->up83);
+    return 1;
+  }
+  if (!mangle)
+    return 0;
+  if (!e->mangled) {
+    char tmpname[NAME_MAX + 1];
+
+    strcpy(tmpname, e->dos);
+    name_convert(tmpname, mangle);
+    e->mangled = strupperDOS(strdup(tmpname));
+  }
+  strcpy(dest, e->mangled);
+  return 1;
+}
+
+/* stat() that uses the data cached with the directory entry, if any */
+int dcache_stat(const char *path, struct stat *st)
+{
+  const char *slash = strrchr(path, '/');
+  struct dc_dir *d;
+  struct dcache_ent *e;
+  int i;
+
+  if (dc.fd == -1 || !slash || !slash[1])
+    return stat(path, st);
+  process_events();
+  d = dir_find(path, key_len(path, slash - path + 1));
+  i = -1;
+  if (d && d->snap)
+    i = snap_find_name(d->snap, slash + 1, strlen(slash + 1));
+  if (i == -1)
+    return stat(path, st);
+
+  e = &d->snap->ent[i];
+  if (e->have_st) {
+    dc.st.stat_hits++;
+    *st = e->st;
+    return 0;
+  }
+  dc.st.stat_misses++;
+  if (lstat(path, st) != 0)
+    return -1;
+  if (S_ISLNK(st->st_mode))
+    return stat(path, st);
+  /* directories change mtime without notifying the parent, and
+     hardlinked files can be changed via the other directories */
+  if (S_ISREG(st->st_mode) && st->st_nlink == 1) {
+    e->st = *st;
+    e->have_st = 1;
+    e->have_attr = 0;
+  }
+  return 0;
+}
+
+struct dcache_batch {
+  int dirfd;
+  struct dcache_snap *snap;
+};
+
+/* start stat'ing a number of entries of the directory */
+struct dcache_batch *dcache_batch_open(const char *path)
+{
+  struct dcache_batch *b;
+  struct dc_dir *d;
+  int fd;
+
+  fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (fd == -1)
+    return NULL;
+  b = malloc(sizeof(*b));
+  b->dirfd = fd;
+  b->snap = NULL;
+  if (dc.fd != -1) {
+    /* the events are drained once for the whole batch */
+    process_events();
+    d = dir_find(path, key_len(path, strlen(path)));
+    if (d && d->snap) {
+      b->snap = d->snap;
+      b->snap->refs++;
+    }
+  }
+  dc.st.batches++;
+  return b;
+}
+
+/* lstat() of the entry, following symlinks; *attr is the cached
+   DOS attribute, or -1 */
+int dcache_batch_stat(struct dcache_batch *b, const char *name,
+	struct stat *st, int *attr)
+{
+  struct dcache_ent *e = NULL;
+  int i;
+
+  *attr = -1;
+  if (b->snap) {
+    i = snap_find_name(b->snap, name, strlen(name));
+    if (i != -1)
+      e = &b->snap->ent[i];
+  }
+  if (e && e->have_st) {
+    dc.st.stat_hits++;
+    *st = e->st;
+    if (e->have_attr)
+      *attr = e->attr;
+    return 0;
+  }
+  dc.st.batch_stats++;
+  if (fstatat(b->dirfd, name, st, AT_SYMLINK_NOFOLLOW) != 0)
+    return -1;
+  if (S_ISLNK(st->st_mode))
+    return fstatat(b->dirfd, name, st, 0);
+  /* same as in dcache_stat() */
+  if (e && S_ISREG(st->st_mode) && st->st_nlink == 1) {
+    e->st = *st;
+    e->have_st = 1;
+    e->have_attr = 0;
+  }
+  return 0;
+}
+
+/* remember the DOS attribute along with the stat of the entry */
+void dcache_batch_set_attr(struct dcache_batch *b, const char *name,
+	int attr)
+{
+  int i;
+
+  if (!b->snap)
+    return;
+  i = snap_find_name(b->snap, name, strlen(name));
+  if (i == -1 || !b->snap->ent[i].have_st)
+    return;
+  b->snap->ent[i].attr = attr;
+  b->snap->ent[i].have_attr = 1;
+}
+
+void dcache_batch_close(struct dcache_batch *b)
+{
+  if (b->snap)
+    dcache_put(b->snap);
+  close(b->dirfd);
+  free(b);
+}
+
+void dcache_done(void)
+{
+  if (dc.fd == -1)
+    return;
+  Debug0((dbg_fd, "dircache: %lu hits, %lu misses, %lu index hits, "
+      "%lu stat hits, %lu stat misses, %lu invalidations, "
+      "%lu stat invalidations, %lu evictions, %lu overflows, "
+      "%lu uncacheable, %lu stat batches of %lu entries\n",
+      dc.st.hits, dc.st.misses, dc.st.index_hits, dc.st.stat_hits,
+      dc.st.stat_misses, dc.st.invals, dc.st.stat_invals, dc.st.evictions,
+      dc.st.overflows, dc.st.uncacheable, dc.st.batches,
+      dc.st.batch_stats));
+  while (dc.head)
+    dir_free(dc.head);
+  close(dc.fd);
+  dc.fd = -1;
+  memset(&dc.st, 0, sizeof(dc.st));
+}
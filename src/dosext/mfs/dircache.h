@@ -0,0 +1,48 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+#ifndef DIRCACHE_H
+#define DIRCACHE_H
+
+#include <sys/stat.h>
+
+struct dcache_snap;
+struct dcache_ent;
+struct mfs_dirent;
+
+struct dcache_snap *dcache_get(const char *path);
+void dcache_put(struct dcache_snap *snap);
+int dcache_nr_entries(const struct dcache_snap *snap);
+int dcache_is_vfat(const struct dcache_snap *snap);
+struct dcache_ent *dcache_entry(struct dcache_snap *snap, int idx,
+	const char **d_name, const char **d_long_name);
+const char *dcache_find(struct dcache_snap *snap, const char *updosname,
+	int is_8_3);
+
+int dos_dirent_name(struct mfs_dirent *de, char *dest);
+int dos_dirent_83(struct mfs_dirent *de, char *dest, int mangle);
+
+int dcache_stat(const char *path, struct stat *st);
+
+struct dcache_batch;
+struct dcache_batch *dcache_batch_open(const char *path);
+int dcache_batch_stat(struct dcache_batch *b, const char *name,
+	struct stat *st, int *attr);
+void dcache_batch_set_attr(struct dcache_batch *b, const char *name,
+	int attr);
+void dcache_batch_close(struct dcache_batch *b);
+void dcache_done(void);
+
+#endif
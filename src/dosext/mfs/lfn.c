@@ -25,6 +25,7 @@
 #include "redirect.h"
 #include "mfs.h"
 #include "mangle.h"
+#include "dircache.h"
 #include "dos2linux.h"
 #include "bios.h"
 #include "int.h"
@@ -112,7 +113,7 @@ static int vfat_search(char *dest, const char *src, const char *path, int alias)
   if (dir == NULL)
     return 0;
 
-  if (dir->dir == NULL)
+  if (dir->vfat)
     while ((de = dos_readdir(dir)) != NULL) {
       d_printf("LFN: vfat_search (short='%s', long='%s')", de->d_name, de->d_long_name);
       if ((strcasecmp(de->d_long_name, src) == 0) || (strcasecmp(de->d_name, src) == 0)) {
@@ -580,12 +581,14 @@ static int wild_match(const char *pattern, char *string)
 
 static int lfn_sfn_match(const char *pattern, struct mfs_dirent *de, char *lfn, char *sfn)
 {
-	if (!name_ufs_to_dos(lfn, de->d_long_name)) {
-		name_convert(lfn, MANGLE);
-		strupperDOS(lfn);
+	if (!dos_dirent_name(de, lfn))
+		dos_dirent_83(de, lfn, MANGLE);
+	if (de->d_name == de->d_long_name) {
+		dos_dirent_83(de, sfn, MANGLE);
+	} else {
+		name_ufs_to_dos(sfn, de->d_name);
+		name_convert(sfn, MANGLE);
 	}
-	name_ufs_to_dos(sfn, de->d_name);
-	name_convert(sfn, MANGLE);
 	return wild_match(pattern, lfn) != 0 &&
 		wild_match(pattern, sfn) != 0;
 }
@@ -618,7 +621,7 @@ static int getfindnext(struct mfs_dirent *de, const struct lfndir *dir)
 	strcat(fpath, "/");
 	strcat(fpath, de->d_long_name);
 	d_printf("LFN: findnext %s\n", fpath);
-	if (stat(fpath, &st) != 0) {
+	if (dcache_stat(fpath, &st) != 0) {
 		free(fpath);
 		return 0;
 	}
@@ -197,6 +197,7 @@ TODO:
 #include "xattr.h"
 #include "rlocks.h"
 #include "mfs.h"
+#include "dircache.h"
 
 #ifdef __linux__
 #include <linux/msdos_fs.h>
@@ -288,7 +289,6 @@ static void RemoveRedirection(int drive, cds_t cds);
 
 static int drives_initialized = FALSE;
 
-struct file_fd open_files[MAX_OPENED_FILES];
 static int num_drives = 0;
 
 lol_t lol = 0;
@@ -885,11 +885,12 @@ void mfs_done(void)
 {
   int i;
 
-  for (i = 0; i < MAX_OPENED_FILES; i++) {
+  for (i = 0; i < max_opened_files; i++) {
     struct file_fd *f = &open_files[i];
     if (f->name)
       mfs_close(f);
   }
+  dcache_done();
 }
 
 void mfs_reset(void)
@@ -1067,6 +1068,7 @@ static struct dir_ent *make_entry(struct dir_list *dir_list)
   entry = &dir_list->de[dir_list->nr_entries];
   dir_list->nr_entries++;
   entry->long_path = FALSE;
+  entry->filled = FALSE;
   return entry;
 }
 
@@ -1114,7 +1116,8 @@ static void fill_entry(struct dir_ent *entry, const char *name, int drive)
 
   snprintf(buf, sizeof(buf), "%s/%s", name, entry->d_name);
 
-  if (!find_file(buf, &sbuf, drives[drive].root_len, NULL)) {
+  if (dcache_stat(buf, &sbuf) != 0 &&
+      !find_file(buf, &sbuf, drives[drive].root_len, NULL)) {
     Debug0((dbg_fd, "Can't findfile %s\n", buf));
     entry->mode = S_IFREG;
     entry->size = 0;
@@ -1131,10 +1134,66 @@ static void fill_entry(struct dir_ent *entry, const char *name, int drive)
     entry->time = sbuf.st_mtime;
     entry->attr = get_dos_attr(buf, entry->mode);
   }
+  entry->filled = TRUE;
+}
+
+#define FILL_BATCH 64
+
+/* fill_entry() for up to n entries, stat'ing them relative to a single
+   directory fd */
+static void fill_entries(struct dir_list *list, int first, int n,
+	const char *name, int drive)
+{
+  struct dcache_batch *b;
+  struct dir_ent *entry;
+  char buf[PATH_MAX];
+  struct stat sbuf;
+  int i, attr, on_fat = 0, no_xattr = 0;
+
+  n = _min(n, list->nr_entries - first);
+  b = dcache_batch_open(name);
+  if (!b) {
+    for (i = first; i < first + n; i++)
+      fill_entry(&list->de[i], name, drive);
+    return;
+  }
+#ifdef __linux__
+  on_fat = file_on_fat(name);
+#endif
+  for (i = first; i < first + n; i++) {
+    entry = &list->de[i];
+    if (entry->filled)
+      continue;
+    snprintf(buf, sizeof(buf), "%s/%s", name, entry->d_name);
+    if (is_dos_device(buf) ||
+	dcache_batch_stat(b, entry->d_name, &sbuf, &attr) != 0) {
+      fill_entry(entry, name, drive);
+      continue;
+    }
+    entry->mode = sbuf.st_mode;
+    entry->size = sbuf.st_size;
+    entry->time = sbuf.st_mtime;
+    if (attr == -1) {
+      if (on_fat) {
+	attr = get_dos_attr(buf, entry->mode);
+      } else {
+	/* don't ask again where xattrs are not supported */
+	errno = 0;
+	attr = no_xattr ? -1 : get_dos_xattr(buf);
+	if (attr == -1 && errno == EOPNOTSUPP)
+	  no_xattr = 1;
+	attr = handle_xattr(attr, entry->mode);
+      }
+      dcache_batch_set_attr(b, entry->d_name, attr);
+    }
+    entry->attr = attr;
+    entry->filled = TRUE;
+  }
+  dcache_batch_close(b);
 }
 
 /* converts d_name to DOS 8:3 and compares with the wildcard */
-static int convert_compare(const char *d_name, char *fname, char *fext,
+static int convert_compare(struct mfs_dirent *de, char *fname, char *fext,
 				 char *mname, char *mext, int in_root)
 {
   char tmpname[NAME_MAX + 1];
@@ -1143,9 +1202,14 @@ static int convert_compare(const char *d_name, char *fname, char *fext,
 
   maybe_mangled = (mname[5] == '~' || mname[5] == '?');
 
-  name_ufs_to_dos(tmpname, d_name);
-  if (!name_convert(tmpname, maybe_mangled))
-    return FALSE;
+  if (de->d_name == de->d_long_name) {
+    if (!dos_dirent_83(de, tmpname, maybe_mangled))
+      return FALSE;
+  } else {
+    name_ufs_to_dos(tmpname, de->d_name);
+    if (!name_convert(tmpname, maybe_mangled))
+      return FALSE;
+  }
 
   namlen = strlen(tmpname);
 
@@ -1207,6 +1271,7 @@ static struct dir_list *get_dir_ff(char *name, char *mname, char *mext,
     entry->size = 0;
     entry->time = time(NULL);
     entry->attr = REGULAR_FILE;
+    entry->filled = TRUE;
 
     dos_closedir(cur_dir);
     return (dir_list);
@@ -1230,6 +1295,7 @@ static struct dir_list *get_dir_ff(char *name, char *mname, char *mext,
       entry->size = sbuf.st_size;
       entry->time = sbuf.st_mtime;
       entry->attr = get_dos_attr(buf, entry->mode);
+      entry->filled = TRUE;
     }
     dos_closedir(cur_dir);
     return (dir_list);
@@ -1238,7 +1304,7 @@ static struct dir_list *get_dir_ff(char *name, char *mname, char *mext,
     int is_root = (strlen(name) == drives[drive].root_len);
     while ((cur_ent = dos_readdir(cur_dir))) {
       Debug0((dbg_fd, "get_dir(): `%s' \n", cur_ent->d_name));
-      if (!convert_compare(cur_ent->d_name, fname, fext, mname, mext, is_root))
+      if (!convert_compare(cur_ent, fname, fext, mname, mext, is_root))
 	continue;
       if (dir_list == NULL)
 	dir_list = make_dir_list(20);
@@ -1266,10 +1332,10 @@ static struct dir_list *get_dir(char *name, char *mname, char *mext, int drive)
   list = get_dir_ff(name, mname, mext, drive);
   if (!list)
     return NULL;
-  for (i = 0; i < list->nr_entries; i++) {
+  for (i = 0; i < list->nr_entries; i += FILL_BATCH) {
     if (signal_pending())
 	coopth_yield();
-    fill_entry(&list->de[i], name, drive);
+    fill_entries(list, i, FILL_BATCH, name, drive);
   }
   return list;
 }
@@ -1516,6 +1582,22 @@ static int init_dos_offsets(int ver)
 }
 
 struct mfs_dir *dos_opendir(const char *name)
+{
+  struct mfs_dir *dir;
+  struct dcache_snap *snap = dcache_get(name);
+
+  if (!snap)
+    return dos_opendir_raw(name);
+  dir = malloc(sizeof *dir);
+  dir->fd = -1;
+  dir->dir = NULL;
+  dir->snap = snap;
+  dir->vfat = dcache_is_vfat(snap);
+  dir->nr = 0;
+  return (dir);
+}
+
+struct mfs_dir *dos_opendir_raw(const char *name)
 {
   struct mfs_dir *dir;
   int fd = -1;
@@ -1547,14 +1629,22 @@ struct mfs_dir *dos_opendir(const char *name)
   dir = malloc(sizeof *dir);
   dir->fd = fd;
   dir->dir = d;
+  dir->snap = NULL;
+  dir->vfat = (fd != -1);
   dir->nr = 0;
   return (dir);
 }
 
 struct mfs_dirent *dos_readdir(struct mfs_dir *dir)
 {
+  dir->de.dc = NULL;
   if (dir->nr <= 1) {
     dir->de.d_name = dir->de.d_long_name = dir->nr ? ".." : ".";
+  } else if (dir->snap) {
+    if (dir->nr - 2 >= dcache_nr_entries(dir->snap))
+      return NULL;
+    dir->de.dc = dcache_entry(dir->snap, dir->nr - 2, &dir->de.d_name,
+	&dir->de.d_long_name);
   } else do {
     if (dir->dir) {
       struct direct *de = (struct direct *) readdir(dir->dir);
@@ -1588,9 +1678,11 @@ struct mfs_dirent *dos_readdir(struct mfs_dir *dir)
 
 int dos_closedir(struct mfs_dir *dir)
 {
-  int ret;
+  int ret = 0;
 
-  if (dir->dir)
+  if (dir->snap)
+    dcache_put(dir->snap);
+  else if (dir->dir)
     ret = closedir(dir->dir);
   else
     ret = close(dir->fd);
@@ -1842,15 +1934,30 @@ scan_dir(const char *path, char *name, int root_len)
 
   strupperDOS(dosname);
 
+  /* cached directories are indexed by the DOS names, only the
+     mangled names need the scan */
+  if (cur_dir->snap) {
+    const char *found = dcache_find(cur_dir->snap, dosname, is_8_3);
+    if (found) {
+      Debug0((dbg_fd, "scan_dir found %s in cache\n", found));
+      strcpy(name, found);
+      dos_closedir(cur_dir);
+      return (TRUE);
+    }
+    if (!maybe_mangled)
+      goto not_found;
+  }
+
   /* now scan for matching names */
   while ((cur_ent = dos_readdir(cur_dir))) {
     char tmpname[NAME_MAX + 1];
 
-    if (!name_ufs_to_dos(tmpname,cur_ent->d_long_name) && !is_8_3)
-      continue;
-
-    if (is_8_3 && !name_convert(tmpname,maybe_mangled))
+    if (is_8_3) {
+      if (!dos_dirent_83(cur_ent, tmpname, maybe_mangled))
+	continue;
+    } else if (!dos_dirent_name(cur_ent, tmpname)) {
       continue;
+    }
 
     /* tmpname now contains the readdir name in the DOS character set */
     if (!strequalDOS(tmpname, dosname)) {
@@ -1861,9 +1968,9 @@ scan_dir(const char *path, char *name, int root_len)
 	 can be represented in DOS; otherwise it is mangled.
 	 only used for the LFN code on VFAT partitions.
       */
-      if (name_ufs_to_dos(tmpname,cur_ent->d_long_name))
+      if (dos_dirent_name(cur_ent, tmpname))
 	continue;
-      name_convert(tmpname,MANGLE);
+      dos_dirent_83(cur_ent, tmpname, MANGLE);
       if (!strequalDOS(tmpname, dosname))
 	continue;
     }
@@ -1876,6 +1983,7 @@ scan_dir(const char *path, char *name, int root_len)
     return (TRUE);
   }
 
+not_found:
   dos_closedir(cur_dir);
 
   if (MANGLE && is_mangled(name))
@@ -2876,9 +2984,11 @@ static int find_again(int firstfind, int drive, char *fpath,
 
   while (sdb_dir_entry(sdb) < hlist->nr_entries) {
     de = &hlist->de[sdb_dir_entry(sdb)];
+    /* stat the next matches in one go, FindNext will use them */
+    if (!de->filled)
+      fill_entries(hlist, sdb_dir_entry(sdb), FILL_BATCH, fpath, drive);
     sdb_dir_entry(sdb)++;
     Debug0((dbg_fd, "find_again entered with %.8s.%.3s\n", de->name, de->ext));
-    fill_entry(de, fpath, drive);
     sdb_file_attr(sdb) = de->attr;
 
     if (de->mode & S_IFDIR) {
@@ -3186,6 +3296,157 @@ static void update_seek_from_dos(uint32_t seek_from_dos, uint64_t* p_seek) {
   }
 }
 
+#define RA_MIN_WIN (64 * 1024)
+#define RA_MAX_WIN (1024 * 1024)
+
+/* detect sequential reads and ask the kernel to read ahead of them */
+static void file_readahead(struct file_fd *f, int cnt)
+{
+  f->reads++;
+  if (f->seek != f->ra_next) {
+    if (f->ra_seq >= 2)
+      posix_fadvise(f->fd, 0, 0, POSIX_FADV_NORMAL);
+    f->ra_seq = 0;
+    f->ra_win = 0;
+    f->ra_end = 0;
+  } else if (f->reads > 1) {
+    f->ra_seq++;
+    f->seq_reads++;
+  }
+  f->ra_next = f->seek + cnt;
+  if (f->ra_seq < 2)
+    return;
+  if (f->ra_seq == 2)
+    posix_fadvise(f->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+  /* renew the hint when the reads get close to the end of the last one */
+  if (f->ra_next + RA_MIN_WIN / 2 > f->ra_end) {
+    f->ra_win = f->ra_win ? _min(f->ra_win * 2, RA_MAX_WIN) : RA_MIN_WIN;
+    f->ra_end = _max(f->ra_end, f->ra_next) + f->ra_win;
+    posix_fadvise(f->fd, f->ra_end - f->ra_win, f->ra_win,
+        POSIX_FADV_WILLNEED);
+    f->ra_hints++;
+  }
+}
+
+/* Find the open file behind a DOS handle of the current process.
+ * Only plain files we can access without DOS are returned. */
+static struct file_fd *lio_get_file(int handle, int wr, sft_t *r_sft)
+{
+  dosaddr_t psp, sftp = 0;
+  far_t fp;
+  sft_t sft;
+  struct file_fd *f;
+  int idx, cnt, drive, mode, i;
+
+  if (!sda || !lol || !sft_record_size)
+    return NULL;
+  psp = SEGOFF2LINEAR(sda_cur_psp(sda), 0);
+  if (handle >= READ_WORD(psp + 0x32))
+    return NULL;
+  fp = rFAR_FARt(READ_DWORD(psp + 0x34));
+  idx = READ_BYTE(SEGOFF2LINEAR(fp.segment, fp.offset) + handle);
+  if (idx == 0xff)
+    return NULL;
+  /* walk the SFT chain from the LoL */
+  fp = rFAR_FARt(READ_DWORD(lol + 4));
+  for (i = 0; i < 256 && fp.offset != 0xffff; i++) {
+    sftp = SEGOFF2LINEAR(fp.segment, fp.offset);
+    cnt = READ_WORD(sftp + 4);
+    if (idx < cnt)
+      break;
+    idx -= cnt;
+    fp = rFAR_FARt(READ_DWORD(sftp));
+  }
+  if (i == 256 || fp.offset == 0xffff)
+    return NULL;
+  sft = LINEAR2UNIX(sftp + 6 + idx * sft_record_size);
+  if (!sft_handle_cnt(sft))
+    return NULL;
+  drive = SFT_DRIVE(sft);
+  if (drive < 0 || drive >= MAX_DRIVES || !drives[drive].root)
+    return NULL;
+  if (sft_fd(sft) >= max_opened_files)
+    return NULL;
+  f = &open_files[sft_fd(sft)];
+  if (f->name == NULL || f->type == TYPE_PRINTER)
+    return NULL;
+  mode = sft_open_mode(sft) & 3;
+  if (wr ? (mode == 0 || read_only(drives[drive])) : mode == 1)
+    return NULL;
+  *r_sft = sft;
+  return f;
+}
+
+/* Read or write a file on our drive straight from/to the linear buffer
+ * of a DPMI client, in one go. Returns -1 if the DOS path is needed. */
+static int lio_rw(int handle, dosaddr_t buf, int len, int wr)
+{
+  sft_t sft;
+  struct file_fd *f;
+  int cnt = len, locked = 0, ret;
+
+  /* low memory is aliased page by page, the rest is contiguous */
+  if (len <= 0 || buf < LOWMEM_SIZE + HMASIZE)
+    return -1;
+  f = lio_get_file(handle, wr, &sft);
+  if (!f)
+    return -1;
+  update_seek_from_dos(sft_position(sft), &f->seek);
+  if (f->seek + len > 0xFFFFffff)
+    return -1;
+  if (!f->unshared &&
+      !region_is_fully_owned(f->fd, f->seek, len, wr, f->mlemu_fds[1])) {
+    cnt = region_lock_offs(f->fd, f->seek, len, 1);
+    if (cnt == 0)
+      return -1;  // let DOS report the lock violation
+    if (cnt > 0)
+      locked = 1;
+    else
+      cnt = len;
+  }
+  Debug0((dbg_fd, "lio: %s fd=%d pos=%"PRIu64" buf=%#x cnt=%d\n",
+      wr ? "write" : "read", f->fd, f->seek, buf, cnt));
+  if (wr) {
+    ret = RPT_SYSCALL(pwrite(f->fd, LINEAR2UNIX(buf), cnt, f->seek));
+  } else {
+    file_readahead(f, cnt);
+    ret = dos_pread(f->fd, buf, cnt, f->seek);
+  }
+  if (locked)
+    region_unlock_offs(f->fd);
+  if (ret < 0) {
+    Debug0((dbg_fd, "lio: %s\n", strerror(errno)));
+    return -1;
+  }
+
+  f->seek += ret;
+  set_32bit_size_or_position(&sft_position(sft), f->seek);
+  if (wr) {
+    if (f->seek > f->size) {
+      f->size = f->seek;
+      set_32bit_size_or_position(&sft_size(sft), f->size);
+    }
+    if (fstat(f->fd, &f->st) == 0)
+      time_to_dos(f->st.st_mtime, &sft_date(sft), &sft_time(sft));
+  } else if (f->seek > sft_size(sft)) {
+    /* someone else enlarged the file! refresh. */
+    fstat(f->fd, &f->st);
+    f->size = f->st.st_size;
+    set_32bit_size_or_position(&sft_size(sft), f->size);
+  }
+  return ret;
+}
+
+int mfs_lio_read(int handle, dosaddr_t buf, int len)
+{
+  return lio_rw(handle, buf, len, 0);
+}
+
+int mfs_lio_write(int handle, dosaddr_t buf, int len)
+{
+  return lio_rw(handle, buf, len, 1);
+}
+
 static struct file_fd *do_open_prn(const char *filename1, const char *fpath)
 {
     int fd;
@@ -3323,7 +3584,7 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
 
     case CLOSE_FILE: /* 0x06 */
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
       if (f->name == NULL) {
@@ -3343,6 +3604,7 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
       if (f->type == TYPE_PRINTER) {
         printer_close(f->fd);
         Debug0((dbg_fd, "printer %i closed\n", f->fd));
+        do_release_fd(f);
       } else {
         mfs_close(f);
       }
@@ -3374,7 +3636,7 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
       int locked = 0;
 
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
 
@@ -3385,7 +3647,10 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
 
       update_seek_from_dos(sft_position(sft), &f->seek);
       cnt = WORD(state->ecx);
-      if (cnt) {
+      if (cnt && f->unshared) {
+        /* no one else can lock it, so no need to check */
+        f->unlocked_reads++;
+      } else if (cnt) {
         int cnt1 = cnt;
         if (!region_is_fully_owned(f->fd, f->seek, cnt, 0, f->mlemu_fds[1]) &&
             f->seek <= 0xFFFFffff && f->seek + cnt <= 0xFFFFffff) {
@@ -3423,18 +3688,18 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
       Debug0((dbg_fd, "Read file fd=%d, dta=%#x, cnt=%d\n", f->fd, dta, cnt));
       Debug0((dbg_fd, "Read file pos = %"PRIu64"\n", f->seek));
       Debug0((dbg_fd, "Handle cnt %d\n", sft_handle_cnt(sft)));
-      s_pos = lseek(f->fd, f->seek, SEEK_SET);
-      if (s_pos < 0 && errno != ESPIPE) {
-        if (locked)
-          region_unlock_offs(f->fd);
+      s_pos = f->seek;
+      file_readahead(f, cnt);
+      ret = dos_pread(f->fd, dta, cnt, s_pos);
+      if (ret < 0 && errno == ESPIPE)
+        ret = dos_read(f->fd, dta, cnt);
+      if (locked)
+        region_unlock_offs(f->fd);
+      if (ret < 0 && errno == EINVAL) {
+        /* bad position */
         SETWORD(&state->ecx, 0);
         return TRUE;
       }
-      Debug0((dbg_fd, "Actual pos %"PRIu64"\n", (uint64_t)s_pos));
-
-      ret = dos_read(f->fd, dta, cnt);
-      if (locked)
-        region_unlock_offs(f->fd);
 
       Debug0((dbg_fd, "Read returned : %d\n", ret));
       if (ret < 0) {
@@ -3465,7 +3730,7 @@ static int dos_fs_redirect(struct vm86_regs *state, char *stk)
       int locked = 0;
 
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
       if (f->name == NULL || read_only(drives[drive])) {
@@ -4122,7 +4387,7 @@ do_create_truncate:
     case SEEK_FROM_EOF: { /* 0x21 */
       off_t offset = (int32_t)((WORD(state->ecx) << 16) | WORD(state->edx));
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
 
@@ -4190,7 +4455,7 @@ do_create_truncate:
       off_t start;
 
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
 
@@ -4283,7 +4548,7 @@ do_create_truncate:
     case COMMIT_FILE: /* 0x07 */
       Debug0((dbg_fd, "Commit\n"));
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
       if (f->name == NULL) {
@@ -4390,7 +4655,7 @@ do_create_truncate:
       uint64_t seek;
       d_printf("MFS: long seek\n");
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES) {
+      if (cnt >= max_opened_files) {
         d_printf("long seek: handle lookup failed (beyond table)\n");
         SETWORD(&state->eax, HANDLE_INVALID);
         return FALSE;
@@ -4449,7 +4714,7 @@ do_create_truncate:
 
       d_printf("MFS: get large file info\n");
       cnt = sft_fd(sft);
-      if (cnt >= MAX_OPENED_FILES)
+      if (cnt >= max_opened_files)
           return FALSE;
       f = &open_files[cnt];
       if (!f->name) {
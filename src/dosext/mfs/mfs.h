@@ -241,6 +241,7 @@ struct dir_ent {
   char d_name[256];             /* unix name as in readdir */
   u_short mode;			/* unix st_mode value */
   u_short long_path;            /* directory has long path */
+  u_short filled;               /* mode, size, time and attr are set */
   uint64_t size;		/* size of file */
   time_t time;			/* st_mtime */
   int attr;
@@ -261,13 +262,16 @@ struct mfs_dirent
 {
   const char *d_name;
   const char *d_long_name;
+  struct dcache_ent *dc;	/* cached names, NULL if not cached */
 };
 
 struct mfs_dir
 {
   DIR *dir;
+  struct dcache_snap *snap;
   struct mfs_dirent de;
   int fd;
+  int vfat;
   unsigned int nr;
 };
 
@@ -334,6 +338,7 @@ extern void time_to_dos(time_t clock, u_short *date, u_short *time);
 extern time_t time_to_unix(u_short dos_date, u_short dos_time);
 extern void extract_filename(const char *filestring0, char *name, char *ext);
 extern struct mfs_dir *dos_opendir(const char *name);
+extern struct mfs_dir *dos_opendir_raw(const char *name);
 extern struct mfs_dirent *dos_readdir(struct mfs_dir *);
 extern int dos_closedir(struct mfs_dir *dir);
 extern void get_volume_label(char *fname, char *fext, char *lfn, int drive);
@@ -367,7 +372,16 @@ struct file_fd
   uint64_t seek;
   uint64_t size;
   int lock_cnt;
+  struct file_fd *hnext;  // name hash chain, or the free list
+  int unshared;        // no one else can hold region locks
+  /* sequential read detection */
+  uint64_t ra_next;
+  uint64_t ra_end;
+  unsigned ra_win;
+  int ra_seq;
+  unsigned long reads, seq_reads, unlocked_reads, ra_hints;
 };
 
-#define MAX_OPENED_FILES 256
-extern struct file_fd open_files[MAX_OPENED_FILES];
+#define MAX_OPENED_FILES 65535  // sft_fd() is 16 bits
+extern struct file_fd *open_files;
+extern int max_opened_files;
@@ -104,43 +104,103 @@ static int is_locked_shlock(const char *name)
     return 0;
 }
 
-struct file_fd *do_claim_fd(const char *name)
+/*
+ * The open files are indexed by name, and the free slots are kept on a
+ * list, so neither open nor the share checks scan the whole table.
+ * The table is sized by $_file_open_limit on first use.
+ */
+struct file_fd *open_files;
+int max_opened_files;
+static struct file_fd **fd_hash;
+static unsigned fd_hash_size;
+static struct file_fd *fd_free;
+static void **shemu_pool;
+
+static unsigned name_hash(const char *name)
+{
+    unsigned h = 2166136261u;
+
+    while (*name)
+        h = (h ^ (unsigned char)*name++) * 16777619u;
+    return h & (fd_hash_size - 1);
+}
+
+static void open_files_init(void)
 {
     int i;
-    struct file_fd *ret = NULL;
 
-    for (i = 0; i < MAX_OPENED_FILES; i++) {
+    max_opened_files = config.file_open_limit;
+    if (max_opened_files <= 0)
+        max_opened_files = 1024;
+    if (max_opened_files > MAX_OPENED_FILES)
+        max_opened_files = MAX_OPENED_FILES;
+    open_files = calloc(max_opened_files, sizeof(struct file_fd));
+    shemu_pool = calloc(max_opened_files * lk_MAX, sizeof(void *));
+    for (fd_hash_size = 64; fd_hash_size < max_opened_files;
+            fd_hash_size <<= 1);
+    fd_hash = calloc(fd_hash_size, sizeof(struct file_fd *));
+    /* low slots first */
+    for (i = max_opened_files - 1; i >= 0; i--) {
         struct file_fd *f = &open_files[i];
-        if (!f->name) {
-            f->name = strdup(name);
-            f->shemu_locks = malloc(sizeof(void *) * lk_MAX);
-            f->idx = i;
-            ret = f;
-            break;
-        }
+        f->idx = i;
+        f->shemu_locks = &shemu_pool[i * lk_MAX];
+        f->hnext = fd_free;
+        fd_free = f;
     }
+}
+
+struct file_fd *do_claim_fd(const char *name)
+{
+    struct file_fd *ret;
+    unsigned h;
+
+    if (!open_files)
+        open_files_init();
+    ret = fd_free;
     if (!ret) {
         error("MFS: too many open files\n");
         leavedos(1);
         return NULL;
     }
+    fd_free = ret->hnext;
+    ret->name = strdup(name);
+    h = name_hash(name);
+    ret->hnext = fd_hash[h];
+    fd_hash[h] = ret;
     memset(ret->shemu_locks, 0, sizeof(void *) * lk_MAX);
     ret->seek = 0;
     ret->size = 0;
+    ret->unshared = 0;
+    ret->ra_next = ret->ra_end = 0;
+    ret->ra_win = 0;
+    ret->ra_seq = 0;
+    ret->reads = ret->seq_reads = ret->unlocked_reads = ret->ra_hints = 0;
     return ret;
 }
 
+void do_release_fd(struct file_fd *f)
+{
+    struct file_fd **pp = &fd_hash[name_hash(f->name)];
+
+    while (*pp != f)
+        pp = &(*pp)->hnext;
+    *pp = f->hnext;
+    free(f->name);
+    f->name = NULL;
+    f->hnext = fd_free;
+    fd_free = f;
+}
+
 static struct file_fd *do_find_fd(const char *name)
 {
-    int i;
-    struct file_fd *ret = NULL;
+    struct file_fd *f, *ret = NULL;
 
-    for (i = 0; i < MAX_OPENED_FILES; i++) {
-        struct file_fd *f = &open_files[i];
-        if (f->name && strcmp(name, f->name) == 0) {
+    if (!open_files)
+        return NULL;
+    /* the lowest slot wins, as with the linear scan */
+    for (f = fd_hash[name_hash(name)]; f; f = f->hnext) {
+        if (strcmp(name, f->name) == 0 && (!ret || f->idx < ret->idx))
             ret = f;
-            break;
-        }
     }
     return ret;
 }
@@ -262,6 +322,8 @@ static int do_mfs_open(struct file_fd *f, const char *fname,
     f->share_mode = share_mode;
     f->psp = sda_cur_psp(sda);
     f->is_writable = is_writable;
+    /* deny-all keeps out every other opener, local or not */
+    f->unshared = (share_mode == DENY_ALL);
     open_mlemu(f->mlemu_fds);
     return 0;
 
@@ -288,10 +350,7 @@ struct file_fd *mfs_open(const char *name, int flags,
         return NULL;
     err = do_mfs_open(f, name, flags, share_mode, r_err);
     if (err) {
-        free(f->name);
-        f->name = NULL;
-        free(f->shemu_locks);
-        f->shemu_locks = NULL;
+        do_release_fd(f);
         return NULL;
     }
     return f;
@@ -349,10 +408,7 @@ struct file_fd *mfs_creat(const char *name, mode_t mode)
         return NULL;
     err = do_mfs_creat(f, name, mode);
     if (err) {
-        free(f->name);
-        f->name = NULL;
-        free(f->shemu_locks);
-        f->shemu_locks = NULL;
+        do_release_fd(f);
         return NULL;
     }
     return f;
@@ -497,6 +553,10 @@ void mfs_close(struct file_fd *f)
 {
     int i;
 
+    if (f->reads)
+        Debug0((dbg_fd, "close %s: %lu reads, %lu sequential, %lu unlocked, "
+                "%lu readahead hints\n", f->name, f->reads, f->seq_reads,
+                f->unlocked_reads, f->ra_hints));
     close(f->fd);
     shlock_close(f->shlock);
     for (i = 0; i < lk_MAX; i++) {
@@ -507,7 +567,5 @@ void mfs_close(struct file_fd *f)
         close(f->mlemu_fds[0]);
     if (f->mlemu_fds[1] != -1)
         close(f->mlemu_fds[1]);
-    free(f->shemu_locks);
-    free(f->name);
-    f->name = NULL;
+    do_release_fd(f);
 }
@@ -19,6 +19,7 @@
 struct file_fd;
 
 struct file_fd *do_claim_fd(const char *name);
+void do_release_fd(struct file_fd *f);
 struct file_fd *mfs_creat(const char *name, mode_t mode);
 struct file_fd *mfs_open(const char *name, int flags,
         int share_mode, int *r_err);
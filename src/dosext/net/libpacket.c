@@ -17,6 +17,8 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include <sys/un.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
@@ -27,7 +29,7 @@
 #include "Linux/if_tun.h"
 #include <netinet/if_ether.h>
 #ifdef HAVE_NETPACKET_PACKET_H
-#include <netpacket/packet.h>
+#include <linux/if_packet.h>
 #endif
 #include <net/ethernet.h>
 #include <assert.h>
@@ -91,6 +93,171 @@ static struct pkt_ops *find_ops(int id)
  *	hell will break loose - unless you use virtual TCP/IP (dosnet).
  */
 
+/*
+ *	TPACKET_V3 rings. The kernel puts the received frames into blocks
+ *	and hands a block over once it is full or RING_RETIRE_MS expired,
+ *	so a burst of frames costs a single wakeup and no syscalls.
+ *	Frames to send are put into the TX ring and the kernel is kicked
+ *	with an empty send(). The kernel stops at a TX frame it finds
+ *	malformed, so the lengths are checked before a frame is queued
+ *	and PACKET_LOSS makes it skip any it rejects anyway.
+ */
+#define RING_BLOCK_SIZE (1 << 16)
+#define RING_RX_BLOCKS 16
+#define RING_TX_BLOCKS 4
+#define RING_FRAME_SIZE 2048
+#define RING_RETIRE_MS 1
+#define RING_TX_DATA (TPACKET3_HDRLEN - sizeof(struct sockaddr_ll))
+
+static struct {
+	int fd;
+	unsigned char *map;
+	size_t map_size;
+	unsigned rx_block;
+	unsigned rx_left;		/* frames not yet read in rx_block */
+	unsigned char *rx_pkt;
+	unsigned char *tx;		/* NULL if there is no TX ring */
+	unsigned tx_frame;
+	unsigned tx_frames;
+	size_t tx_max;			/* largest frame the link takes */
+} eth_ring = { .fd = -1 };
+
+static void eth_ring_drop(int s)
+{
+	struct tpacket_req3 req = {};
+
+	setsockopt(s, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+	setsockopt(s, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req));
+}
+
+static int eth_ring_open(int s, int mtu)
+{
+	int ver = TPACKET_V3;
+	int loss = 1;
+	struct tpacket_req3 req = {};
+	size_t rx_size = RING_BLOCK_SIZE * RING_RX_BLOCKS;
+	size_t tx_size = RING_BLOCK_SIZE * RING_TX_BLOCKS;
+	void *map;
+
+	if (setsockopt(s, SOL_PACKET, PACKET_VERSION, &ver, sizeof(ver)) == -1)
+		return -1;
+	if (setsockopt(s, SOL_PACKET, PACKET_LOSS, &loss, sizeof(loss)) == -1)
+		pd_printf("PKT: no PACKET_LOSS: %s\n", strerror(errno));
+	req.tp_block_size = RING_BLOCK_SIZE;
+	req.tp_block_nr = RING_RX_BLOCKS;
+	req.tp_frame_size = RING_FRAME_SIZE;
+	req.tp_frame_nr = rx_size / RING_FRAME_SIZE;
+	req.tp_retire_blk_tov = RING_RETIRE_MS;
+	if (setsockopt(s, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) == -1)
+		return -1;
+	req.tp_block_nr = RING_TX_BLOCKS;
+	req.tp_frame_nr = tx_size / RING_FRAME_SIZE;
+	req.tp_retire_blk_tov = 0;
+	if (setsockopt(s, SOL_PACKET, PACKET_TX_RING, &req, sizeof(req)) == -1) {
+		/* older kernels have no V3 TX ring, write() still works */
+		pd_printf("PKT: no TX ring: %s\n", strerror(errno));
+		tx_size = 0;
+	}
+	map = mmap(NULL, rx_size + tx_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+		s, 0);
+	if (map == MAP_FAILED) {
+		eth_ring_drop(s);
+		return -1;
+	}
+
+	eth_ring.fd = s;
+	eth_ring.map = map;
+	eth_ring.map_size = rx_size + tx_size;
+	eth_ring.rx_block = 0;
+	eth_ring.rx_left = 0;
+	eth_ring.tx = tx_size ? eth_ring.map + rx_size : NULL;
+	eth_ring.tx_frame = 0;
+	eth_ring.tx_frames = tx_size / RING_FRAME_SIZE;
+	/* the kernel allows a VLAN tag on top of the MTU */
+	eth_ring.tx_max = _min((size_t)mtu + ETH_HLEN + 4,
+		RING_FRAME_SIZE - RING_TX_DATA);
+	pd_printf("PKT: using rx ring of %zu bytes, tx ring of %zu bytes\n",
+		rx_size, tx_size);
+	return 0;
+}
+
+static void eth_ring_close(void)
+{
+	munmap(eth_ring.map, eth_ring.map_size);
+	eth_ring.fd = -1;
+}
+
+static ssize_t eth_ring_read(void *buf, size_t count)
+{
+	struct tpacket_block_desc *bd;
+	struct tpacket3_hdr *h;
+	size_t len;
+
+	bd = (void *)(eth_ring.map + eth_ring.rx_block * RING_BLOCK_SIZE);
+	while (!eth_ring.rx_left) {
+		if (!(__atomic_load_n(&bd->hdr.bh1.block_status, __ATOMIC_ACQUIRE) &
+				TP_STATUS_USER))
+			return 0;
+		eth_ring.rx_left = bd->hdr.bh1.num_pkts;
+		eth_ring.rx_pkt = (unsigned char *)bd +
+			bd->hdr.bh1.offset_to_first_pkt;
+		if (eth_ring.rx_left)
+			break;
+		/* empty block, give it back */
+		__atomic_store_n(&bd->hdr.bh1.block_status, TP_STATUS_KERNEL,
+			__ATOMIC_RELEASE);
+		eth_ring.rx_block = (eth_ring.rx_block + 1) % RING_RX_BLOCKS;
+		bd = (void *)(eth_ring.map + eth_ring.rx_block * RING_BLOCK_SIZE);
+	}
+
+	h = (struct tpacket3_hdr *)eth_ring.rx_pkt;
+	len = _min(h->tp_snaplen, count);
+	memcpy(buf, eth_ring.rx_pkt + h->tp_mac, len);
+	eth_ring.rx_pkt += h->tp_next_offset;
+	if (--eth_ring.rx_left == 0) {
+		__atomic_store_n(&bd->hdr.bh1.block_status, TP_STATUS_KERNEL,
+			__ATOMIC_RELEASE);
+		eth_ring.rx_block = (eth_ring.rx_block + 1) % RING_RX_BLOCKS;
+	}
+	return len;
+}
+
+static int eth_tx_busy(struct tpacket3_hdr *h)
+{
+	return __atomic_load_n(&h->tp_status, __ATOMIC_ACQUIRE) &
+		(TP_STATUS_SEND_REQUEST | TP_STATUS_SENDING);
+}
+
+static ssize_t eth_ring_write(const void *buf, size_t count)
+{
+	struct tpacket3_hdr *h;
+
+	if (count < ETH_HLEN || count > eth_ring.tx_max) {
+		errno = EMSGSIZE;
+		return -1;
+	}
+	h = (void *)(eth_ring.tx + eth_ring.tx_frame * RING_FRAME_SIZE);
+	if (eth_tx_busy(h)) {
+		/* the ring is full: kick the kernel but don't wait for the
+		 * link, DOS retries the send as with a busy write() */
+		send(eth_ring.fd, NULL, 0, MSG_DONTWAIT);
+		if (eth_tx_busy(h)) {
+			errno = EAGAIN;
+			return -1;
+		}
+	}
+	memcpy((unsigned char *)h + RING_TX_DATA, buf, count);
+	h->tp_len = count;
+	h->tp_snaplen = count;
+	h->tp_next_offset = 0;
+	__atomic_store_n(&h->tp_status, TP_STATUS_SEND_REQUEST, __ATOMIC_RELEASE);
+	eth_ring.tx_frame = (eth_ring.tx_frame + 1) % eth_ring.tx_frames;
+	/* DOS hands over one frame at a time, so send it right away */
+	if (send(eth_ring.fd, NULL, 0, MSG_DONTWAIT) == -1 && errno != EAGAIN)
+		return -1;
+	return count;
+}
+
 static int OpenNetworkLinkEth(const char *name, void (*cbk)(int, int))
 {
 	PRIV_SAVE_AREA
@@ -142,6 +309,12 @@ static int OpenNetworkLinkEth(const char *name, void (*cbk)(int, int))
 	receive_mode = (req.ifr_flags & IFF_PROMISC) ? 6 :
 		((req.ifr_flags & IFF_BROADCAST) ? 3 : 2);
 
+	ret = ioctl(s, SIOCGIFMTU, &req);
+	if (ret < 0)
+		req.ifr_mtu = ETH_DATA_LEN;
+	if (config.eth_ring && eth_ring_open(s, req.ifr_mtu) == -1)
+		error("PKT: cannot set up the packet rings, %s\n", strerror(errno));
+
 	cbk(s, receive_mode);
 	return 0;
 }
@@ -294,6 +467,10 @@ int OpenNetworkLink(void (*cbk)(int, int))
  */
 static void CloseNetworkLinkEth(int pkt_fd)
 {
+#ifdef HAVE_NETPACKET_PACKET_H
+	if (pkt_fd == eth_ring.fd)
+		eth_ring_close();
+#endif
 	close(pkt_fd);
 }
 
@@ -459,6 +636,11 @@ static ssize_t pkt_read_eth(int pkt_fd, void *buf, size_t count)
     struct timeval tv;
     fd_set readset;
 
+#ifdef HAVE_NETPACKET_PACKET_H
+    if (pkt_fd == eth_ring.fd)
+        return eth_ring_read(buf, count);
+#endif
+
     tv.tv_sec = 0;				/* set a (small) timeout */
     tv.tv_usec = 0;
 
@@ -515,8 +697,61 @@ ssize_t pkt_read(int fd, void *buf, size_t count)
     return find_ops(config.vnet)->pkt_read(fd, buf, count);
 }
 
+#ifdef HAVE_NETPACKET_PACKET_H
+static int pkt_read_multi_eth(int pkt_fd, struct iovec *iov, int *lens,
+	int cnt)
+{
+    struct mmsghdr msgs[cnt];
+    int i, ret;
+
+    if (pkt_fd == eth_ring.fd) {
+	/* the frames are in the ring already, no syscalls needed */
+	for (i = 0; i < cnt; i++) {
+	    ret = eth_ring_read(iov[i].iov_base, iov[i].iov_len);
+	    if (ret <= 0)
+		break;
+	    lens[i] = ret;
+	}
+	return i;
+    }
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < cnt; i++) {
+	msgs[i].msg_hdr.msg_iov = &iov[i];
+	msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    ret = recvmmsg(pkt_fd, msgs, cnt, MSG_DONTWAIT, NULL);
+    if (ret < 0)
+	return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    for (i = 0; i < ret; i++)
+	lens[i] = msgs[i].msg_len;
+    return ret;
+}
+#endif
+
+/* read up to cnt frames that are already there, returns their number */
+int pkt_read_multi(int fd, struct iovec *iov, int *lens, int cnt)
+{
+    struct pkt_ops *o = find_ops(config.vnet);
+    ssize_t ret;
+    int i;
+
+    if (o->pkt_read_multi)
+	return o->pkt_read_multi(fd, iov, lens, cnt);
+    for (i = 0; i < cnt; i++) {
+	ret = o->pkt_read(fd, iov[i].iov_base, iov[i].iov_len);
+	if (ret <= 0)
+	    return i ?: ret;
+	lens[i] = ret;
+    }
+    return i;
+}
+
 static ssize_t pkt_write_eth(int pkt_fd, const void *buf, size_t count)
 {
+#ifdef HAVE_NETPACKET_PACKET_H
+    if (pkt_fd == eth_ring.fd && eth_ring.tx)
+        return eth_ring_write(buf, count);
+#endif
     return write(pkt_fd, buf, count);
 }
 
@@ -548,6 +783,7 @@ static struct pkt_ops eth_ops = {
 	.get_hw_addr = GetDeviceHardwareAddressEth,
 	.get_MTU = GetDeviceMTUEth,
 	.pkt_read = pkt_read_eth,
+	.pkt_read_multi = pkt_read_multi_eth,
 	.pkt_write = pkt_write_eth,
 };
 #endif
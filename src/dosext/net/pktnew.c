@@ -42,6 +42,7 @@
 #include <errno.h>
 #include <sys/time.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <netinet/if_ether.h>
 #include "libpacket.h"
@@ -126,11 +127,28 @@ struct pkt_globs
     struct per_handle  handle[MAX_HANDLE];
 } pg;
 
-unsigned char pkt_buf[PKT_BUF_SIZE];
+/* The received frames wait in a ring for the DOS receiver. The ring is
+   filled with as many frames as the host has ready, and the receiver
+   thread passes all of them to DOS before the next fill. */
+#define PKT_RX_RING 32
+
+struct pkt_rx_frame {
+    int size;
+    short handle;
+    Bit16u rcvr_cs, rcvr_ip;
+    unsigned char buf[PKT_BUF_SIZE];
+};
+static struct pkt_rx_frame rx_ring[PKT_RX_RING];
+static int rx_head, rx_count;
+
+static struct {
+    unsigned fills;
+    unsigned frames;
+    unsigned max_batch;
+    unsigned max_depth;
+    unsigned refused;		/* the receiver gave no buffer */
+} rx_stats;
 
-short p_helper_size;
-Bit16u p_helper_receiver_cs, p_helper_receiver_ip;
-short p_helper_handle;
 struct pkt_param *p_param;
 struct pkt_statistics *p_stats;
 
@@ -173,7 +191,7 @@ pkt_init(void)
     p_param->length = sizeof(struct pkt_param);
     p_param->addr_len = ETH_ALEN;
     p_param->mtu = GetDeviceMTU();
-    p_param->rcv_bufs = 8 - 1;		/* a guess */
+    p_param->rcv_bufs = PKT_RX_RING - 1;
     p_param->xmt_bufs = 2 - 1;
 
     PKTRcvCall_TID = coopth_create("PKT_receiver_call",
@@ -192,12 +210,18 @@ pkt_reset(void)
     max_pkt_type_array = 0;
     for (handle = 0; handle < MAX_HANDLE; handle++)
         pg.handle[handle].in_use = 0;
+    rx_head = rx_count = 0;
 }
 
 void pkt_term(void)
 {
     if (!config.pktdrv)
       return;
+    if (rx_stats.fills)
+	pd_printf("PKT: %u frames received in %u batches, max batch %u, "
+		"max queue %u, %u refused by DOS\n", rx_stats.frames,
+		rx_stats.fills, rx_stats.max_batch, rx_stats.max_depth,
+		rx_stats.refused);
     remove_from_io_select(pkt_fd);
     CloseNetworkLink(pkt_fd);
 }
@@ -564,60 +588,61 @@ Remove_Type(int handle)
 
 static enum VirqSwRet pkt_receiver_callback(void *arg)
 {
-    if (p_helper_size) {
+    if (rx_count) {
         coopth_start(PKTRcvCall_TID, NULL);
         return VIRQ_SWRET_BH;
     }
     return VIRQ_SWRET_DONE;
 }
 
-static void pkt_receiver_callback_thr(void *arg)
+static void pkt_upcall(struct pkt_rx_frame *f)
 {
-    struct vm86_regs rcv_saved_regs;
-    rcv_saved_regs = REGS;
     _AX = 0;
-    _BX = p_helper_handle;
-    _CX = p_helper_size;
+    _BX = f->handle;
+    _CX = f->size;
     _DX = 0;	// no lookahead buffer
     _DI = 0;	// no error
-    do_call_back(p_helper_receiver_cs, p_helper_receiver_ip);
-    if ((_ES == 0 && _DI == 0) || (_CX && _CX < p_helper_size))
-      goto out;
-    MEMCPY_2DOS(SEGOFF2LINEAR(_ES, _DI), pkt_buf, p_helper_size);
+    do_call_back(f->rcvr_cs, f->rcvr_ip);
+    if ((_ES == 0 && _DI == 0) || (_CX && _CX < f->size)) {
+      p_stats->packets_lost++;
+      rx_stats.refused++;
+      return;
+    }
+    MEMCPY_2DOS(SEGOFF2LINEAR(_ES, _DI), f->buf, f->size);
     _DS = _ES;
     _SI = _DI;
     _AX = 1;
-    _BX = p_helper_handle;
-    _CX = p_helper_size;
-    do_call_back(p_helper_receiver_cs, p_helper_receiver_ip);
-
-out:
-    p_helper_size = 0;
-    REGS = rcv_saved_regs;
+    _BX = f->handle;
+    _CX = f->size;
+    do_call_back(f->rcvr_cs, f->rcvr_ip);
 }
 
-static int pkt_receive(void)
+static void pkt_receiver_callback_thr(void *arg)
 {
-    int size, handle;
-    struct per_handle *hdlp;
-
-    if (!config.pktdrv) {
-        pd_printf("Driver not initialized ...\n");
-	return 0;
+    struct vm86_regs rcv_saved_regs;
+    rcv_saved_regs = REGS;
+    while (rx_count) {
+	struct pkt_rx_frame *f = &rx_ring[rx_head];
+	/* the handle could be released by the previous upcall */
+	if (pg.handle[f->handle].in_use) {
+	    pkt_upcall(f);
+	    REGS = rcv_saved_regs;
+	} else {
+	    p_stats->packets_lost++;
+	}
+	rx_head = (rx_head + 1) % PKT_RX_RING;
+	rx_count--;
     }
-    if (local_receive_mode == 1)
-	return 0;
+}
 
-    size = pkt_read(pkt_fd, pkt_buf, PKT_BUF_SIZE);
-    if (size < 0) {
-        p_stats->errors_in++;		/* select() somehow lied */
-        return 0;
-    }
-    if (size == 0)
-	return 0;
+/* check the frame and fill in its receiver, returns 0 to drop it */
+static int pkt_accept(struct pkt_rx_frame *f, int size)
+{
+    int handle;
+    struct per_handle *hdlp;
 
     pd_printf("========Processing New packet======\n");
-    handle = Find_Handle(pkt_buf);
+    handle = Find_Handle(f->buf);
     if (handle == -1)
         return 0;
     pd_printf("Found handle %d\n", handle);
@@ -633,9 +658,9 @@ static int pkt_receive(void)
 		/* driver class! */
 
 		if (hdlp->cls == ETHER_CLASS)
-		    p = pkt_buf + 2 * ETH_ALEN;		/* Ethernet-II */
+		    p = f->buf + 2 * ETH_ALEN;		/* Ethernet-II */
 		else
-		    p = pkt_buf + 2 * ETH_ALEN + 2;	/* IEEE 802.3 */
+		    p = f->buf + 2 * ETH_ALEN + 2;	/* IEEE 802.3 */
 
 		*--p = (char)ETH_P_IPX; /* overwrite length with type */
 		*--p = (char)(ETH_P_IPX >> 8);
@@ -649,24 +674,18 @@ static int pkt_receive(void)
 	     */
 	    if (size < ETH_ZLEN) {
 		pd_printf("Fixing packet padding. Actual length: %d\n", size);
-		memset(pkt_buf + size, 0, ETH_ZLEN - size);
+		memset(f->buf + size, 0, ETH_ZLEN - size);
 		size = ETH_ZLEN;
 	    }
 
 	    p_stats->packets_in++;
 	    p_stats->bytes_in += size;
 
-	    printbuf("received packet:", (struct ethhdr *)pkt_buf, size);
-	    /* stuff things in global vars and queue a hardware */
-	    /* interrupt which will perform the upcall */
-	    if (p_helper_size)
-		error("PKT: Receiver is not ready, packet dropped (size=%i)\n",
-		  p_helper_size);
-	    p_helper_size = size;
-	    p_helper_receiver_cs = hdlp->rcvr_cs;
-	    p_helper_receiver_ip = hdlp->rcvr_ip;
-	    p_helper_handle = handle;
-	    pd_printf("Called the helpvector ... \n");
+	    printbuf("received packet:", (struct ethhdr *)f->buf, size);
+	    f->size = size;
+	    f->handle = handle;
+	    f->rcvr_cs = hdlp->rcvr_cs;
+	    f->rcvr_ip = hdlp->rcvr_ip;
 	    return 1;
     } else {
         p_stats->packets_lost++;	/* not really lost... */
@@ -676,10 +695,59 @@ static int pkt_receive(void)
     return 0;
 }
 
+/* read the ready frames into the free part of the ring */
+static int pkt_receive(void)
+{
+    struct iovec iov[PKT_RX_RING];
+    int lens[PKT_RX_RING];
+    int i, n, tail, space, kept = 0;
+
+    if (!config.pktdrv) {
+        pd_printf("Driver not initialized ...\n");
+	return 0;
+    }
+    if (local_receive_mode == 1)
+	return 0;
+
+    space = PKT_RX_RING - rx_count;
+    if (!space)
+	return 0;
+    tail = rx_head + rx_count;
+    for (i = 0; i < space; i++) {
+	iov[i].iov_base = rx_ring[(tail + i) % PKT_RX_RING].buf;
+	iov[i].iov_len = PKT_BUF_SIZE;
+    }
+    n = pkt_read_multi(pkt_fd, iov, lens, space);
+    if (n < 0) {
+        p_stats->errors_in++;		/* select() somehow lied */
+        return 0;
+    }
+
+    for (i = 0; i < n; i++) {
+	struct pkt_rx_frame *f = &rx_ring[(tail + i) % PKT_RX_RING];
+	if (!lens[i] || !pkt_accept(f, lens[i]))
+	    continue;
+	if (kept != i)
+	    rx_ring[(tail + kept) % PKT_RX_RING] = *f;
+	kept++;
+    }
+    rx_count += kept;
+
+    if (n) {
+	rx_stats.fills++;
+	rx_stats.frames += n;
+	if (n > rx_stats.max_batch)
+	    rx_stats.max_batch = n;
+	if (rx_count > rx_stats.max_depth)
+	    rx_stats.max_depth = rx_count;
+    }
+    return kept;
+}
+
 static enum VirqHwRet pkt_virq_receive(void *arg)
 {
-    int rc = pkt_receive();
-    if (rc)
+    pkt_receive();
+    if (rx_count)
         return VIRQ_HWRET_CONT;
     ioselect_complete(pkt_fd);
     return VIRQ_HWRET_DONE;
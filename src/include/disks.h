@@ -158,8 +158,14 @@ typedef enum {
 
 const char *floppy_t_str(floppy_t t);
 
+enum { COW_KEEP, COW_COMMIT, COW_DISCARD };
+struct disk_cow;
+
 struct disk {
   char *dev_name;		/* disk file */
+  char *overlay;		/* copy-on-write overlay of the image */
+  int overlay_mode;		/* what to do with the overlay on close */
+  struct disk_cow *cow;
   int diskcyl4096;		/* INT13 support for 4096 cylinders */
   int rdonly;			/* The way we opened the disk (only filled in if the disk is open) */
   int boot;			/* This is a boot disk */
@@ -257,6 +263,18 @@ extern struct disk *hdisk_find_by_path(const char *path);
 #endif
 
 int read_mbr(const struct disk *dp, unsigned buffer);
+
+void disk_uring_done(void);
+int disk_uring_avail(void);
+
+int cow_open(struct disk *dp);
+void cow_close(struct disk *dp);
+ssize_t cow_pread(const struct disk *dp, void *buf, size_t len, off_t ofs);
+ssize_t cow_pwrite(const struct disk *dp, const void *buf, size_t len,
+	off_t ofs);
+int disk_uring_rw(int fd, unsigned buffer, int cnt, off_t pos, int wr);
+int disk_uring_pread(int fd, void *buf, int cnt, off_t pos);
+int disk_uring_pwrite(int fd, const void *buf, int cnt, off_t pos);
 int read_sectors(const struct disk *, unsigned, uint64_t, long);
 int write_sectors(struct disk *, unsigned, uint64_t, long);
 
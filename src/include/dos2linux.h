@@ -356,8 +356,11 @@ void memset_dos(dosaddr_t dest, char ch, size_t n);
 
 int unix_read(int fd, void *data, int cnt);
 int dos_read(int fd, unsigned data, int cnt);
+int dos_pread(int fd, unsigned data, int cnt, off_t ofs);
 int unix_write(int fd, const void *data, int cnt);
 int dos_write(int fd, unsigned data, int cnt);
+int mfs_lio_read(int handle, dosaddr_t buf, int len);
+int mfs_lio_write(int handle, dosaddr_t buf, int len);
 int com_vsprintf(char *str, const char *format, va_list ap);
 int com_vsnprintf(char *str, size_t size, const char *format, va_list ap);
 int com_sprintf(char *str, const char *format, ...) FORMAT(printf, 2, 3);
@@ -148,6 +148,10 @@ typedef struct vesamode_type_struct {
 typedef struct config_info {
        int hdiskboot;
        boolean swap_bootdrv;
+       boolean disk_uring;
+       int disk_cache;		/* in K, 0 = off */
+       boolean disk_cache_wb;
+       boolean fatfs_write;	/* write back to the hdimage directories */
        boolean alt_drv_c;
        uint8_t drive_c_num;
        uint32_t drives_mask;
@@ -230,6 +234,7 @@ typedef struct config_info {
        long    ipx_net;
        int     vnet;
        char   *ethdev;
+       boolean eth_ring;	/* TPACKET_V3 rings for the eth backend */
        char   *tapdev;
        char   *vdeswitch;
        char   *slirp_args;
@@ -263,6 +268,7 @@ typedef struct config_info {
        unsigned long cpu_tick_spd;	/* (1.19318/speed)<<32 */
 
        int hogthreshold;
+       boolean tickless_idle;	/* stretch SIGALRM while the guest sleeps */
 
        int mem_size, ext_mem, xms_size, ems_size;
        int umb_a0, umb_b0, umb_f0, hma;
@@ -270,6 +276,7 @@ typedef struct config_info {
        int ems_uma_pages, ems_cnv_pages;
        int dpmi, pm_dos_api, no_null_checks;
        uint32_t dpmi_base;
+       boolean hugepages;	/* THP for the DPMI and extended memory */
        int dos_up;
 
        int sillyint;            /* IRQ numbers for Silly Interrupt Generator
@@ -288,6 +295,7 @@ typedef struct config_info {
 
        /* Lock File business */
        int file_lock_limit;
+       int file_open_limit;
        char *tty_lockdir;	/* The Lock directory  */
        char *tty_lockfile;	/* Lock file pretext ie LCK.. */
        boolean tty_lockbinary;	/* Binary lock files ? */
@@ -341,6 +349,7 @@ typedef struct config_info {
        boolean pcm_hpf;
        char *midi_file;
        char *wav_file;
+       boolean sound_vtime;
 
        /* joystick */
        char *joy_device[2];
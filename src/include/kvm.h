@@ -40,6 +40,7 @@ void kvm_leave(int pm);
 void kvm_update_fpu(void);
 void kvm_get_fpu(void);
 
+void kvm_print_stats(int top, void (*prn)(const char *, ...));
 void kvm_done(void);
 
 #else
@@ -61,6 +62,8 @@ static inline void kvm_enter(int pm) {}
 static inline void kvm_leave(int pm) {}
 static inline void kvm_update_fpu(void) {}
 static inline void kvm_get_fpu(void) {}
+static inline void kvm_print_stats(int top,
+    void (*prn)(const char *, ...)) {}
 static inline void kvm_done(void) {}
 #endif
 
@@ -12,4 +12,6 @@ int GetDeviceMTU(void);
 
 void pkt_io_select(void(*)(void *), void *);
 ssize_t pkt_read(int fd, void *buf, size_t count);
+struct iovec;
+int pkt_read_multi(int fd, struct iovec *iov, int *lens, int cnt);
 ssize_t pkt_write(int fd, const void *buf, size_t count);
@@ -92,6 +92,8 @@ void *alias_mapping_ux(int cap, size_t mapsize, int protect, void *source);
 int munmap_mapping(int cap, dosaddr_t targ, size_t mapsize);
 int mprotect_mapping(int cap, dosaddr_t targ, size_t mapsize, int protect);
 int restore_mapping(int cap, dosaddr_t targ, size_t mapsize);
+void mapping_hugepages(dosaddr_t base, uint32_t size);
+void mapping_report_hugepages(void);
 
 struct mappingdrivers {
   const char *key;
@@ -15,5 +15,6 @@ int pic_get_inum(void);
 
 extern void pic_reset(void);
 extern void pic_init(void);
+extern void pic_done(void);
 
 #endif	/* PIC_H */
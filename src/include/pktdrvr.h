@@ -90,6 +90,7 @@ extern void pkt_init (void);
 extern void pkt_reset (void);
 extern void pkt_term (void);
 
+struct iovec;
 struct pkt_ops {
     int id;
     int (*open)(const char *name, void (*cbk)(int, int));
@@ -97,6 +98,8 @@ struct pkt_ops {
     int (*get_hw_addr)(unsigned char *addr);
     int (*get_MTU)(void);
     ssize_t (*pkt_read)(int fd, void *buf, size_t count);
+    /* optional, pkt_read() is called in a loop if not set */
+    int (*pkt_read_multi)(int fd, struct iovec *iov, int *lens, int cnt);
     ssize_t (*pkt_write)(int fd, const void *buf, size_t count);
 #define PFLG_ASYNC 1
     unsigned flags;
@@ -175,6 +175,11 @@ extern int sigchld_register_handler(pid_t pid, void (*handler)(void*),
 extern int sigchld_enable_cleanup(pid_t pid);
 extern int sigchld_enable_handler(pid_t pid, int on);
 extern int sigalrm_register_handler(void (*handler)(void));
+extern int sigalrm_register_idle_handler(void (*handler)(void),
+	int (*busy)(void));
+extern void sigalrm_fast_forward(void);
+extern void sigalrm_idle_enter(void);
+extern void sigalrm_idle_leave(void);
 extern void registersig(int sig, void (*handler)(siginfo_t *));
 extern void registersig_std(int sig, void (*handler)(void *));
 extern void deinit_handler(sigcontext_t *scp, unsigned long *uc_flags);
@@ -203,6 +203,7 @@ extern void pcm_write_interleaved(sndbuf_t ptr[][SNDBUF_CHANS],
 	int frames, int rate, int format, int nchans, int strm_idx);
 extern int pcm_format_size(int format);
 extern void pcm_timer(void);
+extern int pcm_is_playing(void);
 extern void pcm_prepare_stream(int strm_idx);
 extern double pcm_get_stream_time(int strm_idx);
 extern int pcm_start_input(void *id);
@@ -210,6 +211,8 @@ extern void pcm_stop_input(void *id);
 extern void pcm_set_volume_cb(double (*get_vol)(int, int, int, void *));
 extern void pcm_set_connected_cb(int (*is_connected)(int, void *));
 extern void pcm_set_checkid2_cb(int (*checkid2)(void *, void *));
+extern void pcm_dump_stats(void (*print)(const char *, ...));
+extern void pcm_reset_stats(void);
 
 size_t pcm_data_get(void *data, size_t size, struct player_params *params);
 int pcm_data_get_interleaved(sndbuf_t buf[][SNDBUF_CHANS], int nframes,
@@ -128,6 +128,8 @@ int stop_cputime (int);
 int restart_cputime (int);
 extern int cpu_time_stop;	/* for dosdebug */
 void uncache_time(void);
+void vtime_advance(void);
+void vtime_io(void);
 
 void freeze_dosemu_manual(void);
 void freeze_dosemu(void);
@@ -0,0 +1,17 @@
+#ifndef TWHEEL_H
+#define TWHEEL_H
+
+#include "types.h"
+
+#define TWHEEL_NEVER ((hitimer_t)-1)
+
+void *twheel_create(const char *name, void (*cbk)(void *), void *arg);
+void twheel_arm(void *tmr, hitimer_t deadline);
+void twheel_arm_rel(void *tmr, hitimer_t us);
+void twheel_disarm(void *tmr);
+void twheel_run(void);
+hitimer_t twheel_next(void);
+void twheel_dump(void);
+void twheel_done(void);
+
+#endif
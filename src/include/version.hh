@@ -0,0 +1,9 @@
+#ifndef	VERSION_HH
+#define	VERSION_HH
+#define	VERSTR	"2.0pre9"
+#define	VERSION_NUM	2
+#define	SUBLEVEL	0
+#define	PATCHLEVEL1	"pre9"
+#define	REVISION	7076
+#define	VERDATE "2023-09-21"
+#endif /* VERSION_H */
@@ -223,6 +223,8 @@ static COMMAND cmds[] = {
    "ADDR              display the Device Driver Request Header at ADDR\n"},
   {"dpbs", NULL,
    "[ADDR]            display DPBs by walking the chain from LOL or ADDR\n"},
+  {"kvmstat", NULL,
+   "[N]               display the KVM exit statistics, top N entries\n"},
   {"kill", db_kill,
    "                  Kill the dosemu process\n"},
   {"quit", db_quit,
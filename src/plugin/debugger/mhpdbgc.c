@@ -103,6 +103,7 @@ static void mhp_mcbs    (int, char *[]);
 static void mhp_devs    (int, char *[]);
 static void mhp_ddrh    (int, char *[]);
 static void mhp_dpbs    (int, char *[]);
+static void mhp_kvmstat (int, char *[]);
 static void mhp_bplog   (int, char *[]);
 static void mhp_bclog   (int, char *[]);
 
@@ -175,6 +176,7 @@ static const struct cmd_db cmdtab[] = {
    {"devs",          mhp_devs},
    {"ddrh",          mhp_ddrh},
    {"dpbs",          mhp_dpbs},
+   {"kvmstat",       mhp_kvmstat},
    {"",              NULL}
 };
 
@@ -1609,6 +1611,19 @@ static void mhp_ddrh(int argc, char *argv[])
   mhp_printf("  status 0x%04x\n", req->status);
 }
 
+static void mhp_kvmstat(int argc, char *argv[])
+{
+  int top = 10;
+
+  if (config.cpu_vm != CPUVM_KVM && config.cpu_vm_dpmi != CPUVM_KVM) {
+    mhp_printf("KVM is not in use\n");
+    return;
+  }
+  if (argc > 1)
+    top = strtol(argv[1], NULL, 0);
+  kvm_print_stats(top, mhp_printf);
+}
+
 static void mhp_dpbs(int argc, char *argv[])
 {
   struct DPB *dpbp;
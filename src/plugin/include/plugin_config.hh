@@ -0,0 +1,4 @@
+#include "../plugin/Xkmaps/config/plugin_config.h"
+#include "../plugin/console/config/plugin_config.h"
+#include "../plugin/debugger/config/plugin_config.h"
+#include "../plugin/modemu/config/plugin_config.h"
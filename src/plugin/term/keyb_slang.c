@@ -1259,6 +1259,11 @@ static int get_modifiers(void)
 	return modifier;
 }
 
+static int slang_pending_busy(void)
+{
+	return keyb_state.KeyNot_Ready;
+}
+
 static void do_slang_pending(void)
 {
 	if (keyb_state.KeyNot_Ready && *keyb_state.kbp == 27) {
@@ -1590,7 +1595,7 @@ static int slang_keyb_init(void)
 		}
 		add_to_io_select(keyb_state.kbd_fd, do_slang_getkeys, NULL);
 	}
-	sigalrm_register_handler(do_slang_pending);
+	sigalrm_register_idle_handler(do_slang_pending, slang_pending_busy);
 
 	/* Enable cursor keys (DECCKM) */
 	printf("\033[?1h\r");
@@ -0,0 +1,89 @@
+def ds3_share_open_many(self, fstype):
+    testdir = self.mkworkdir('d')
+
+    self.mkfile("testit.bat", """\
+d:
+%s
+c:\\openmany
+rem end
+""" % ("rem Internal share" if self.version == "FDPP kernel" else "c:\\share"), newline="\r\n")
+
+    # compile sources
+    self.mkexe_with_djgpp("openmany", r"""
+#include <dos.h>
+#include <fcntl.h>
+#include <share.h>
+#include <stdio.h>
+
+#define NFILES 10
+#define ROUNDS 400
+
+int main(void) {
+  int h[NFILES], h2;
+  int i, r;
+  unsigned n;
+  char name[16], c;
+
+  for (i = 0; i < NFILES; i++) {
+    sprintf(name, "FILE%d.DAT", i);
+    if (_dos_creat(name, _A_NORMAL, &h[i]) != 0) {
+      printf("FAIL: create %s\n", name);
+      return 1;
+    }
+    c = '0' + i;
+    _dos_write(h[i], &c, 1, &n);
+    _dos_close(h[i]);
+  }
+
+  /* keep NFILES handles open, in a different order every round */
+  for (r = 0; r < ROUNDS; r++) {
+    for (i = 0; i < NFILES; i++) {
+      sprintf(name, "FILE%d.DAT", (i + r) % NFILES);
+      if (_dos_open(name, O_RDONLY | SH_DENYNO, &h[i]) != 0) {
+        printf("FAIL: open %s in round %d\n", name, r);
+        return 1;
+      }
+    }
+    for (i = 0; i < NFILES; i++) {
+      if (_dos_read(h[i], &c, 1, &n) != 0 || n != 1 ||
+          c != '0' + (i + r) % NFILES) {
+        printf("FAIL: read from FILE%d.DAT in round %d\n", (i + r) % NFILES, r);
+        return 1;
+      }
+      _dos_close(h[i]);
+    }
+  }
+
+  /* the share checks must still see the open file */
+  if (_dos_open("FILE0.DAT", O_RDONLY | SH_DENYRW, &h[0]) != 0) {
+    printf("FAIL: deny-all open denied\n");
+    return 1;
+  }
+  if (_dos_open("FILE0.DAT", O_RDONLY | SH_DENYNO, &h2) == 0) {
+    printf("FAIL: second open allowed\n");
+    return 1;
+  }
+  _dos_close(h[0]);
+  if (_dos_open("FILE0.DAT", O_RDONLY | SH_DENYRW, &h[0]) != 0) {
+    printf("FAIL: open after close denied\n");
+    return 1;
+  }
+  _dos_close(h[0]);
+
+  printf("PASS: %d opens\n", NFILES * ROUNDS);
+  return 0;
+}
+""")
+
+    config = """$_floppy_a = ""\n"""
+
+    if fstype == "MFS":
+        config += """$_hdimage = "dXXXXs/c:hdtype1 dXXXXs/d:hdtype1 +1"\n"""
+    else:       # FAT
+        name = self.mkimage("12", cwd=testdir)
+        config += """$_hdimage = "dXXXXs/c:hdtype1 %s +1"\n""" % name
+
+    results = self.runDosemu("testit.bat", config=config, timeout=120)
+
+    self.assertNotIn("FAIL:", results)
+    self.assertIn("PASS: 4000 opens", results)
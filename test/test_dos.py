@@ -30,6 +30,7 @@ from func_ds3_lock_readonly import ds3_lock_readonly
 from func_ds3_lock_twice import ds3_lock_twice
 from func_ds3_lock_writable import ds3_lock_writable
 from func_ds3_share_open_access import ds3_share_open_access
+from func_ds3_share_open_many import ds3_share_open_many
 from func_ds3_share_open_twice import ds3_share_open_twice
 from func_lfn_voln_info import lfn_voln_info
 from func_lfs_disk_info import lfs_disk_info
@@ -4598,6 +4599,14 @@ $_floppy_a = ""
         """FAT DOSv3 share open twice"""
         ds3_share_open_twice(self, "FAT")
 
+    def test_mfs_ds3_share_open_many(self):
+        """MFS DOSv3 share open many"""
+        ds3_share_open_many(self, "MFS")
+
+    def test_fat_ds3_share_open_many(self):
+        """FAT DOSv3 share open many"""
+        ds3_share_open_many(self, "FAT")
+
     def test_mfs_ds3_share_open_delete_one_process_ds2(self):
         """MFS DOSv3 share open delete one process DOSv2"""
         ds3_share_open_access(self, "ONE", "MFS", "DELPTH")